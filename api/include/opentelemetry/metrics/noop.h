@@ -47,6 +47,11 @@ class NoopCounter : public Counter<T>
            const common::KeyValueIterable & /* attributes */,
            const context::Context & /* context */) noexcept override
   {}
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+  void AddBatch(nostd::span<const T> /* values */,
+                const common::KeyValueIterable & /* attributes */) noexcept override
+  {}
+#endif
 #ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
   nostd::unique_ptr<BoundCounter<T>> Bind(
       const common::KeyValueIterable & /* attributes */) noexcept override
@@ -75,6 +80,10 @@ class NoopHistogram : public Histogram<T>
   {}
 
   void Record(T /*value*/) noexcept override {}
+
+  void RecordBatch(nostd::span<const T> /* values */,
+                   const common::KeyValueIterable & /* attributes */) noexcept override
+  {}
 #endif
 
 #ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
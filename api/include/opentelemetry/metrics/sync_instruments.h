@@ -160,6 +160,40 @@ class Counter : public SynchronousInstrument
               context);
   }
 
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+  /**
+   * @since ABI_VERSION 2
+   * Record a batch of values with a set of attributes. The attributes are resolved once for the
+   * whole batch, which is cheaper than recording the values one by one.
+   *
+   * @param values The increment amounts. MUST be non-negative.
+   * @param attributes A set of attributes to associate with the values.
+   */
+  virtual void AddBatch(nostd::span<const T> values,
+                        const common::KeyValueIterable &attributes) noexcept
+  {
+    for (const T &value : values)
+    {
+      this->Add(value, attributes);
+    }
+  }
+
+  template <class U,
+            nostd::enable_if_t<common::detail::is_key_value_iterable<U>::value> * = nullptr>
+  void AddBatch(nostd::span<const T> values, const U &attributes) noexcept
+  {
+    this->AddBatch(values, common::KeyValueIterableView<U>{attributes});
+  }
+
+  void AddBatch(nostd::span<const T> values,
+                std::initializer_list<std::pair<nostd::string_view, common::AttributeValue>>
+                    attributes) noexcept
+  {
+    this->AddBatch(values, nostd::span<const std::pair<nostd::string_view, common::AttributeValue>>{
+                               attributes.begin(), attributes.end()});
+  }
+#endif
+
 #ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
   /**
    * @since ABI_VERSION 2
@@ -226,6 +260,39 @@ class Histogram : public SynchronousInstrument
     this->Record(value, nostd::span<const std::pair<nostd::string_view, common::AttributeValue>>{
                             attributes.begin(), attributes.end()});
   }
+
+  /**
+   * @since ABI_VERSION 2
+   * Records a batch of values with a set of attributes. The attributes are resolved once for the
+   * whole batch, which is cheaper than recording the values one by one.
+   *
+   * @param values The measurement values. MUST be non-negative.
+   * @param attributes A set of attributes to associate with the values.
+   */
+  virtual void RecordBatch(nostd::span<const T> values,
+                           const common::KeyValueIterable &attributes) noexcept
+  {
+    for (const T &value : values)
+    {
+      this->Record(value, attributes);
+    }
+  }
+
+  template <class U,
+            nostd::enable_if_t<common::detail::is_key_value_iterable<U>::value> * = nullptr>
+  void RecordBatch(nostd::span<const T> values, const U &attributes) noexcept
+  {
+    this->RecordBatch(values, common::KeyValueIterableView<U>{attributes});
+  }
+
+  void RecordBatch(nostd::span<const T> values,
+                   std::initializer_list<std::pair<nostd::string_view, common::AttributeValue>>
+                       attributes) noexcept
+  {
+    this->RecordBatch(values,
+                      nostd::span<const std::pair<nostd::string_view, common::AttributeValue>>{
+                          attributes.begin(), attributes.end()});
+  }
 #endif
 
 #ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
@@ -71,6 +71,12 @@ class OStreamSpanExporter final : public opentelemetry::sdk::trace::SpanExporter
       const std::unordered_map<std::string, opentelemetry::sdk::common::OwnedAttributeValue> &map,
       const std::string &prefix = "\n\t");
 
+  void printAttributes(const opentelemetry::sdk::trace::SpanDataAttributes &map,
+                       const std::string &prefix = "\n\t");
+
+  void printAttributes(const opentelemetry::sdk::trace::SpanDataEventAttributes &map,
+                       const std::string &prefix = "\n\t");
+
   void printEvents(const std::vector<opentelemetry::sdk::trace::SpanDataEvent> &events);
 
   void printLinks(const std::vector<opentelemetry::sdk::trace::SpanDataLink> &links);
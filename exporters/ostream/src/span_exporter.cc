@@ -159,17 +159,40 @@ bool OStreamSpanExporter::isShutdown() const noexcept
   return is_shutdown_;
 }
 
-void OStreamSpanExporter::printAttributes(
-    const std::unordered_map<std::string, sdkcommon::OwnedAttributeValue> &map,
-    const std::string &prefix)
+namespace
+{
+
+template <class AttributeMap>
+void PrintAttributeMap(std::ostream &sout, const AttributeMap &map, const std::string &prefix)
 {
   for (const auto &kv : map)
   {
-    sout_ << prefix << kv.first << ": ";
-    opentelemetry::exporter::ostream_common::print_value(kv.second, sout_);
+    sout << prefix << kv.first << ": ";
+    opentelemetry::exporter::ostream_common::print_value(kv.second, sout);
   }
 }
 
+}  // namespace
+
+void OStreamSpanExporter::printAttributes(
+    const std::unordered_map<std::string, sdkcommon::OwnedAttributeValue> &map,
+    const std::string &prefix)
+{
+  PrintAttributeMap(sout_, map, prefix);
+}
+
+void OStreamSpanExporter::printAttributes(const trace_sdk::SpanDataAttributes &map,
+                                          const std::string &prefix)
+{
+  PrintAttributeMap(sout_, map, prefix);
+}
+
+void OStreamSpanExporter::printAttributes(const trace_sdk::SpanDataEventAttributes &map,
+                                          const std::string &prefix)
+{
+  PrintAttributeMap(sout_, map, prefix);
+}
+
 void OStreamSpanExporter::printEvents(const std::vector<trace_sdk::SpanDataEvent> &events)
 {
   for (const auto &event : events)
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <memory>
 
 #include "opentelemetry/exporters/otlp/otlp_http_client.h"
@@ -94,6 +95,12 @@ class OPENTELEMETRY_EXPORT OtlpHttpExporter final : public opentelemetry::sdk::t
       const nostd::span<std::unique_ptr<opentelemetry::sdk::trace::Recordable>> &spans) noexcept
       override;
 
+  /**
+   * Returns the maximum number of concurrent Export() calls: max_concurrent_requests with async
+   * export, 1 otherwise.
+   */
+  std::size_t GetMaxConcurrentExports() const noexcept override;
+
   /**
    * Force flush the exporter.
    * @param timeout an option timeout, default to max.
@@ -379,6 +379,16 @@ opentelemetry::sdk::common::ExportResult OtlpHttpExporter::Export(
 #endif
 }
 
+std::size_t OtlpHttpExporter::GetMaxConcurrentExports() const noexcept
+{
+#ifdef ENABLE_ASYNC_EXPORT
+  // Each Export() only waits until fewer than max_concurrent_requests requests are running.
+  return options_.max_concurrent_requests;
+#else
+  return 1;
+#endif
+}
+
 bool OtlpHttpExporter::ForceFlush(std::chrono::microseconds timeout) noexcept
 {
   return http_client_->ForceFlush(timeout);
@@ -1,6 +1,7 @@
 // Copyright The OpenTelemetry Authors
 // SPDX-License-Identifier: Apache-2.0
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -36,6 +37,19 @@ namespace otlp
 {
 namespace metric_sdk = opentelemetry::sdk::metrics;
 
+namespace
+{
+
+// The start time of a point is the start time of its metric, unless its series started later.
+std::chrono::nanoseconds::rep GetPointStartTime(std::chrono::nanoseconds::rep metric_start_ts,
+                                                const metric_sdk::PointDataAttributes &point)
+{
+  auto point_start_ts = point.start_ts.time_since_epoch().count();
+  return point_start_ts > metric_start_ts ? point_start_ts : metric_start_ts;
+}
+
+}  // namespace
+
 proto::metrics::v1::AggregationTemporality OtlpMetricUtils::GetProtoAggregationTemporality(
     const opentelemetry::sdk::metrics::AggregationTemporality &aggregation_temporality) noexcept
 {
@@ -54,7 +68,7 @@ metric_sdk::AggregationType OtlpMetricUtils::GetAggregationType(
   {
     return metric_sdk::AggregationType::kDrop;
   }
-  auto point_data_with_attributes = metric_data.point_data_attr_[0];
+  const auto &point_data_with_attributes = metric_data.point_data_attr_[0];
   if (nostd::holds_alternative<sdk::metrics::SumPointData>(point_data_with_attributes.point_data))
   {
     return metric_sdk::AggregationType::kSum;
@@ -90,7 +104,8 @@ void OtlpMetricUtils::ConvertSumMetric(const metric_sdk::MetricData &metric_data
   for (auto &point_data_with_attributes : metric_data.point_data_attr_)
   {
     proto::metrics::v1::NumberDataPoint *proto_sum_point_data = sum->add_data_points();
-    proto_sum_point_data->set_start_time_unix_nano(start_ts);
+    proto_sum_point_data->set_start_time_unix_nano(
+        GetPointStartTime(start_ts, point_data_with_attributes));
     proto_sum_point_data->set_time_unix_nano(ts);
     const auto &sum_data =
         nostd::get<sdk::metrics::SumPointData>(point_data_with_attributes.point_data);
@@ -124,7 +139,8 @@ void OtlpMetricUtils::ConvertHistogramMetric(
   {
     proto::metrics::v1::HistogramDataPoint *proto_histogram_point_data =
         histogram->add_data_points();
-    proto_histogram_point_data->set_start_time_unix_nano(start_ts);
+    proto_histogram_point_data->set_start_time_unix_nano(
+        GetPointStartTime(start_ts, point_data_with_attributes));
     proto_histogram_point_data->set_time_unix_nano(ts);
     const auto &histogram_data =
         nostd::get<sdk::metrics::HistogramPointData>(point_data_with_attributes.point_data);
@@ -166,11 +182,15 @@ void OtlpMetricUtils::ConvertHistogramMetric(
     }
     // buckets
 
+    proto_histogram_point_data->mutable_explicit_bounds()->Reserve(
+        static_cast<int>(histogram_data.boundaries_.size()));
     for (auto bound : histogram_data.boundaries_)
     {
       proto_histogram_point_data->add_explicit_bounds(bound);
     }
     // bucket counts
+    proto_histogram_point_data->mutable_bucket_counts()->Reserve(
+        static_cast<int>(histogram_data.counts_.size()));
     for (auto bucket_value : histogram_data.counts_)
     {
       proto_histogram_point_data->add_bucket_counts(bucket_value);
@@ -196,7 +216,8 @@ void OtlpMetricUtils::ConvertExponentialHistogramMetric(
   {
     proto::metrics::v1::ExponentialHistogramDataPoint *proto_histogram_point_data =
         histogram->add_data_points();
-    proto_histogram_point_data->set_start_time_unix_nano(start_ts);
+    proto_histogram_point_data->set_start_time_unix_nano(
+        GetPointStartTime(start_ts, point_data_with_attributes));
     proto_histogram_point_data->set_time_unix_nano(ts);
     const auto &histogram_data = nostd::get<sdk::metrics::Base2ExponentialHistogramPointData>(
         point_data_with_attributes.point_data);
@@ -256,7 +277,8 @@ void OtlpMetricUtils::ConvertGaugeMetric(const opentelemetry::sdk::metrics::Metr
   for (auto &point_data_with_attributes : metric_data.point_data_attr_)
   {
     proto::metrics::v1::NumberDataPoint *proto_gauge_point_data = gauge->add_data_points();
-    proto_gauge_point_data->set_start_time_unix_nano(start_ts);
+    proto_gauge_point_data->set_start_time_unix_nano(
+        GetPointStartTime(start_ts, point_data_with_attributes));
     proto_gauge_point_data->set_time_unix_nano(ts);
     const auto &gauge_data =
         nostd::get<sdk::metrics::LastValuePointData>(point_data_with_attributes.point_data);
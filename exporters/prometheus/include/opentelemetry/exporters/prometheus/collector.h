@@ -6,8 +6,10 @@
 #include <prometheus/collectable.h>
 #include <prometheus/metric_family.h>
 #include <mutex>
+#include <string>
 #include <vector>
 
+#include "opentelemetry/exporters/prometheus/exporter_utils.h"
 #include "opentelemetry/sdk/metrics/metric_reader.h"
 #include "opentelemetry/version.h"
 
@@ -43,6 +45,17 @@ class PrometheusCollector : public prometheus_client::Collectable
    */
   std::vector<prometheus_client::MetricFamily> Collect() const override;
 
+  /**
+   * Collects all metrics data and writes it in the given exposition format, without building
+   * Prometheus metric families.
+   *
+   * @param format the exposition format
+   * @param output the buffer the exposition is written to. It is cleared first but keeps its
+   * capacity, so that it can be reused across scrapes.
+   * @return false if the exporter is shutdown
+   */
+  bool CollectExposition(PrometheusExpositionFormat format, std::string &output) const;
+
 private:
   sdk::metrics::MetricReader *reader_;
   bool populate_target_info_;
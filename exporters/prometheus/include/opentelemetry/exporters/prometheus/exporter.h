@@ -6,6 +6,7 @@
 #include <prometheus/exposer.h>
 #include <chrono>
 #include <memory>
+#include <string>
 
 #include "opentelemetry/exporters/prometheus/collector.h"
 #include "opentelemetry/exporters/prometheus/exporter_options.h"
@@ -39,6 +40,16 @@ class PrometheusExporter : public sdk::metrics::MetricReader
   sdk::metrics::AggregationTemporality GetAggregationTemporality(
       sdk::metrics::InstrumentType instrument_type) const noexcept override;
 
+  /**
+   * Collects all metrics data and writes it in the given exposition format, for an HTTP server
+   * serving the scrapes itself.
+   *
+   * @param format the exposition format
+   * @param output the buffer the exposition is written to, reusable across scrapes
+   * @return false if the exporter is shutdown or could not be initialized
+   */
+  bool CollectExposition(PrometheusExpositionFormat format, std::string &output) const;
+
 private:
   // The configuration options associated with this exporter.
   const PrometheusExporterOptions options_;
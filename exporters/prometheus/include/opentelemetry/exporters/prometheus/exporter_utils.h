@@ -16,6 +16,18 @@ namespace exporter
 {
 namespace metrics
 {
+
+/**
+ * The exposition formats written by PrometheusExporterUtils::WriteExposition().
+ */
+enum class PrometheusExpositionFormat
+{
+  // Prometheus text format, version 0.0.4
+  kText,
+  // OpenMetrics text format, version 1.0.0
+  kOpenMetrics
+};
+
 /**
  * The Prometheus Utils contains utility functions for Prometheus Exporter
  */
@@ -43,6 +55,42 @@ class PrometheusExporterUtils
       bool without_units        = false,
       bool without_type_suffix  = false);
 
+  /**
+   * Write OpenTelemetry metrics data in a Prometheus exposition format, directly from the metric
+   * data and without translating it to Prometheus metric families first.
+   *
+   * The metric families are appended to output, so that a buffer can be reused across scrapes
+   * without being reallocated. A complete exposition ends with WriteExpositionEnd().
+   *
+   * @param data a collection of metrics in OpenTelemetry
+   * @param format the exposition format
+   * @param output the buffer the metric families are appended to
+   * @param populate_target_info whether to populate target_info
+   * @param without_otel_scope whether to populate otel_scope_name and otel_scope_version
+   * attributes
+   * @param without_units exporter configuration controlling whether to append unit suffix in
+   * the exported metrics.
+   * @param without_type_suffix exporter configuration controlling whether to append type suffix in
+   * the exported metrics.
+   */
+  static void WriteExposition(const sdk::metrics::ResourceMetrics &data,
+                              PrometheusExpositionFormat format,
+                              std::string &output,
+                              bool populate_target_info = true,
+                              bool without_otel_scope   = false,
+                              bool without_units        = false,
+                              bool without_type_suffix  = false);
+
+  /**
+   * Append the end of an exposition, after the metric families of all the collected data.
+   */
+  static void WriteExpositionEnd(PrometheusExpositionFormat format, std::string &output);
+
+  /**
+   * @return the HTTP content type of the given exposition format
+   */
+  static const char *GetExpositionContentType(PrometheusExpositionFormat format) noexcept;
+
 private:
   /**
    * Sanitize the given metric name or label according to Prometheus rule.
@@ -218,6 +266,38 @@ class PrometheusExporterUtils
                        const std::vector<uint64_t> &counts,
                        ::prometheus::ClientMetric *metric);
 
+  /**
+   * Write the target_info metric family of the resource attributes
+   */
+  static void WriteTarget(
+      const sdk::metrics::ResourceMetrics &data,
+      const opentelemetry::sdk::instrumentationscope::InstrumentationScope *scope,
+      PrometheusExpositionFormat format,
+      std::string &output,
+      std::string &labels);
+
+  /**
+   * Write the metric family of a metric
+   */
+  static void WriteMetricData(
+      const sdk::metrics::MetricData &metric_data,
+      const opentelemetry::sdk::instrumentationscope::InstrumentationScope *scope,
+      const opentelemetry::sdk::resource::Resource *resource,
+      PrometheusExpositionFormat format,
+      std::string &output,
+      std::string &labels,
+      bool without_units,
+      bool without_type_suffix);
+
+  /**
+   * Write the labels of a point, separated by commas, with the same rules as SetMetricBasic()
+   */
+  static void WriteLabels(
+      const opentelemetry::sdk::metrics::PointAttributes &labels,
+      const opentelemetry::sdk::instrumentationscope::InstrumentationScope *scope,
+      const opentelemetry::sdk::resource::Resource *resource,
+      std::string &output);
+
   // For testing
   friend class SanitizeNameTester;
 };
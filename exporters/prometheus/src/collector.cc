@@ -3,6 +3,7 @@
 
 #include <prometheus/metric_family.h>
 #include <mutex>
+#include <string>
 #include <vector>
 
 #include "opentelemetry/exporters/prometheus/collector.h"
@@ -66,6 +67,30 @@ std::vector<prometheus_client::MetricFamily> PrometheusCollector::Collect() cons
   return result;
 }
 
+bool PrometheusCollector::CollectExposition(PrometheusExpositionFormat format,
+                                            std::string &output) const
+{
+  if (reader_->IsShutdown())
+  {
+    OTEL_INTERNAL_LOG_WARN(
+        "[Prometheus Exporter] CollectExposition: "
+        "Exporter is shutdown, can not invoke collect operation.");
+    return false;
+  }
+  std::lock_guard<std::mutex> guard(collection_lock_);
+
+  output.clear();
+  reader_->Collect([&output, format, this](sdk::metrics::ResourceMetrics &metric_data) {
+    PrometheusExporterUtils::WriteExposition(metric_data, format, output,
+                                             this->populate_target_info_,
+                                             this->without_otel_scope_, this->without_units_,
+                                             this->without_type_suffix_);
+    return true;
+  });
+  PrometheusExporterUtils::WriteExpositionEnd(format, output);
+  return true;
+}
+
 }  // namespace metrics
 }  // namespace exporter
 OPENTELEMETRY_END_NAMESPACE
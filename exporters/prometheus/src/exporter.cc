@@ -55,6 +55,16 @@ sdk::metrics::AggregationTemporality PrometheusExporter::GetAggregationTemporali
   return sdk::metrics::AggregationTemporality::kCumulative;
 }
 
+bool PrometheusExporter::CollectExposition(PrometheusExpositionFormat format,
+                                           std::string &output) const
+{
+  if (collector_ == nullptr)
+  {
+    return false;
+  }
+  return collector_->CollectExposition(format, output);
+}
+
 bool PrometheusExporter::OnForceFlush(std::chrono::microseconds /* timeout */) noexcept
 {
   return true;
@@ -5,12 +5,15 @@
 #include <prometheus/metric_family.h>
 #include <prometheus/metric_type.h>
 #include <algorithm>
+#include <clocale>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
 #include <functional>
 #include <limits>
 #include <regex>
-#include <sstream>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -18,6 +21,7 @@
 #include <vector>
 
 #include "opentelemetry/exporters/prometheus/exporter_utils.h"
+#include "opentelemetry/nostd/string_view.h"
 #include "opentelemetry/nostd/variant.h"
 #include "opentelemetry/sdk/common/attribute_utils.h"
 #include "opentelemetry/sdk/common/global_log_handler.h"
@@ -102,6 +106,175 @@ std::string SanitizeLabel(std::string label_key)
   });
 }
 
+// Append a HELP text, escaping backslashes and new lines, and double quotes in OpenMetrics.
+void AppendEscapedHelp(std::string &output,
+                       const std::string &help,
+                       PrometheusExpositionFormat format)
+{
+  for (char c : help)
+  {
+    if (c == '\\')
+    {
+      output += "\\\\";
+    }
+    else if (c == '\n')
+    {
+      output += "\\n";
+    }
+    else if (c == '"' && format == PrometheusExpositionFormat::kOpenMetrics)
+    {
+      output += "\\\"";
+    }
+    else
+    {
+      output += c;
+    }
+  }
+}
+
+// Append a label value, escaping backslashes, double quotes and new lines.
+void AppendEscapedLabelValue(std::string &output, nostd::string_view value)
+{
+  for (char c : value)
+  {
+    if (c == '\\')
+    {
+      output += "\\\\";
+    }
+    else if (c == '"')
+    {
+      output += "\\\"";
+    }
+    else if (c == '\n')
+    {
+      output += "\\n";
+    }
+    else
+    {
+      output += c;
+    }
+  }
+}
+
+// Append a label key sanitized like SanitizeLabel() does, without allocating a new string.
+void AppendSanitizedLabel(std::string &output, const std::string &label_key)
+{
+  bool previous_replaced = false;
+  for (std::size_t i = 0; i < label_key.size(); ++i)
+  {
+    const char c = label_key[i];
+    if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9' && i > 0))
+    {
+      output += c;
+      previous_replaced = false;
+    }
+    else if (!previous_replaced)
+    {
+      // Consecutive replaced characters are collapsed to a single _.
+      output += '_';
+      previous_replaced = true;
+    }
+  }
+}
+
+// Append the shortest representation of value, with up to max_digits10 significant digits, which
+// parses back to value. The value is formatted into a stack buffer to avoid an allocation per
+// sample. snprintf and strtod use the decimal separator of the C locale, which is replaced by the
+// mandatory '.' when the global C locale is not the classic one.
+void AppendDouble(std::string &output, double value)
+{
+  if (std::isnan(value))
+  {
+    output += "NaN";
+    return;
+  }
+  if (std::isinf(value))
+  {
+    output += value < 0 ? "-Inf" : "+Inf";
+    return;
+  }
+
+  // Large enough for "-1.2345678901234567e-308".
+  char buffer[32];
+  int length = 0;
+  for (int precision = std::numeric_limits<double>::digits10;
+       precision <= std::numeric_limits<double>::max_digits10; ++precision)
+  {
+    length = std::snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+    if (precision == std::numeric_limits<double>::max_digits10 ||
+        std::strtod(buffer, nullptr) == value)
+    {
+      break;
+    }
+  }
+
+  const char decimal_point = std::localeconv()->decimal_point[0];
+  if (decimal_point != '.' && decimal_point != '\0')
+  {
+    std::replace(buffer, buffer + length, decimal_point, '.');
+  }
+  output.append(buffer, static_cast<std::size_t>(length));
+}
+
+void AppendUnsigned(std::string &output, std::uint64_t value)
+{
+  char buffer[20];
+  std::size_t position = sizeof(buffer);
+  do
+  {
+    buffer[--position] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  output.append(buffer + position, sizeof(buffer) - position);
+}
+
+double ToDouble(const metric_sdk::ValueType &value)
+{
+  if (nostd::holds_alternative<int64_t>(value))
+  {
+    return static_cast<double>(nostd::get<int64_t>(value));
+  }
+  return nostd::get<double>(value);
+}
+
+// Append the name of a sample and its labels, up to its value.
+void AppendSampleStart(std::string &output,
+                       const std::string &name,
+                       const char *suffix,
+                       const std::string &labels)
+{
+  output += name;
+  output += suffix;
+  if (!labels.empty())
+  {
+    output += '{';
+    output += labels;
+    output += '}';
+  }
+  output += ' ';
+}
+
+void AppendFamilyHeader(std::string &output,
+                        const std::string &name,
+                        const std::string &help,
+                        const char *type,
+                        PrometheusExpositionFormat format)
+{
+  if (!help.empty())
+  {
+    output += "# HELP ";
+    output += name;
+    output += ' ';
+    AppendEscapedHelp(output, help, format);
+    output += '\n';
+  }
+  output += "# TYPE ";
+  output += name;
+  output += ' ';
+  output += type;
+  output += '\n';
+}
+
 }  // namespace
 
 /**
@@ -145,7 +318,7 @@ std::vector<prometheus_client::MetricFamily> PrometheusExporterUtils::TranslateT
     {
       prometheus_client::MetricFamily metric_family;
       metric_family.help = metric_data.instrument_descriptor.description_;
-      auto front         = metric_data.point_data_attr_.front();
+      const auto &front  = metric_data.point_data_attr_.front();
       auto kind          = getAggregationType(front.point_data);
       bool is_monotonic  = true;
       if (kind == sdk::metrics::AggregationType::kSum)
@@ -164,11 +337,11 @@ std::vector<prometheus_client::MetricFamily> PrometheusExporterUtils::TranslateT
       {
         if (type == prometheus_client::MetricType::Histogram)  // Histogram
         {
-          auto histogram_point_data =
+          const auto &histogram_point_data =
               nostd::get<sdk::metrics::HistogramPointData>(point_data_attr.point_data);
-          auto boundaries = histogram_point_data.boundaries_;
-          auto counts     = histogram_point_data.counts_;
-          double sum      = 0.0;
+          const auto &boundaries = histogram_point_data.boundaries_.GetBoundaries();
+          const auto &counts     = histogram_point_data.counts_;
+          double sum             = 0.0;
           if (nostd::holds_alternative<double>(histogram_point_data.sum_))
           {
             sum = nostd::get<double>(histogram_point_data.sum_);
@@ -231,6 +404,305 @@ std::vector<prometheus_client::MetricFamily> PrometheusExporterUtils::TranslateT
   return output;
 }
 
+void PrometheusExporterUtils::WriteExposition(const sdk::metrics::ResourceMetrics &data,
+                                              PrometheusExpositionFormat format,
+                                              std::string &output,
+                                              bool populate_target_info,
+                                              bool without_otel_scope,
+                                              bool without_units,
+                                              bool without_type_suffix)
+{
+  if (data.scope_metric_data_.empty())
+  {
+    return;
+  }
+
+  // The labels of the current point, reused for all the points.
+  std::string labels;
+  if (populate_target_info)
+  {
+    WriteTarget(data, without_otel_scope ? nullptr : data.scope_metric_data_.front().scope_,
+                format, output, labels);
+  }
+
+  for (const auto &instrumentation_info : data.scope_metric_data_)
+  {
+    const opentelemetry::sdk::instrumentationscope::InstrumentationScope *scope =
+        without_otel_scope ? nullptr : instrumentation_info.scope_;
+    for (const auto &metric_data : instrumentation_info.metric_data_)
+    {
+      WriteMetricData(metric_data, scope, data.resource_, format, output, labels, without_units,
+                      without_type_suffix);
+    }
+  }
+}
+
+void PrometheusExporterUtils::WriteExpositionEnd(PrometheusExpositionFormat format,
+                                                 std::string &output)
+{
+  if (format == PrometheusExpositionFormat::kOpenMetrics)
+  {
+    output += "# EOF\n";
+  }
+}
+
+const char *PrometheusExporterUtils::GetExpositionContentType(
+    PrometheusExpositionFormat format) noexcept
+{
+  if (format == PrometheusExpositionFormat::kOpenMetrics)
+  {
+    return "application/openmetrics-text; version=1.0.0; charset=utf-8";
+  }
+  return "text/plain; version=0.0.4; charset=utf-8";
+}
+
+void PrometheusExporterUtils::WriteTarget(
+    const sdk::metrics::ResourceMetrics &data,
+    const opentelemetry::sdk::instrumentationscope::InstrumentationScope *scope,
+    PrometheusExpositionFormat format,
+    std::string &output,
+    std::string &labels)
+{
+  if (data.resource_ == nullptr)
+  {
+    return;
+  }
+
+  // Same metric family as SetTarget(), which the text format has no info type for.
+  AppendFamilyHeader(output, "target", "Target metadata",
+                     format == PrometheusExpositionFormat::kOpenMetrics ? "info" : "gauge", format);
+  labels.clear();
+  metric_sdk::PointAttributes empty_attributes;
+  WriteLabels(empty_attributes, scope, data.resource_, labels);
+  for (auto &label : data.resource_->GetAttributes())
+  {
+    if (!labels.empty())
+    {
+      labels += ',';
+    }
+    labels += SanitizeNames(label.first);
+    labels += "=\"";
+    AppendEscapedLabelValue(labels, AttributeValueToString(label.second));
+    labels += '"';
+  }
+  AppendSampleStart(output, "target", "_info", labels);
+  output += "1\n";
+}
+
+void PrometheusExporterUtils::WriteMetricData(
+    const sdk::metrics::MetricData &metric_data,
+    const opentelemetry::sdk::instrumentationscope::InstrumentationScope *scope,
+    const opentelemetry::sdk::resource::Resource *resource,
+    PrometheusExpositionFormat format,
+    std::string &output,
+    std::string &labels,
+    bool without_units,
+    bool without_type_suffix)
+{
+  if (metric_data.point_data_attr_.empty())
+  {
+    return;
+  }
+  const auto &front = metric_data.point_data_attr_.front();
+  auto kind         = getAggregationType(front.point_data);
+  bool is_monotonic = true;
+  if (kind == sdk::metrics::AggregationType::kSum)
+  {
+    is_monotonic = nostd::get<sdk::metrics::SumPointData>(front.point_data).is_monotonic_;
+  }
+  const prometheus_client::MetricType type = TranslateType(kind, is_monotonic);
+  const std::string name = MapToPrometheusName(metric_data.instrument_descriptor.name_,
+                                               metric_data.instrument_descriptor.unit_, type,
+                                               without_units, without_type_suffix);
+  const bool open_metrics = format == PrometheusExpositionFormat::kOpenMetrics;
+
+  // In OpenMetrics, the samples of a counter are named after the family with a _total suffix.
+  std::string family_name   = name;
+  const char *sample_suffix = "";
+  const char *type_name     = open_metrics ? "unknown" : "untyped";
+  if (type == prometheus_client::MetricType::Counter)
+  {
+    type_name = "counter";
+    if (open_metrics)
+    {
+      const std::string total = "_total";
+      if (family_name.size() > total.size() &&
+          family_name.compare(family_name.size() - total.size(), total.size(), total) == 0)
+      {
+        family_name.resize(family_name.size() - total.size());
+      }
+      sample_suffix = "_total";
+    }
+  }
+  else if (type == prometheus_client::MetricType::Gauge)
+  {
+    type_name = "gauge";
+  }
+  else if (type == prometheus_client::MetricType::Histogram)
+  {
+    type_name = "histogram";
+  }
+  AppendFamilyHeader(output, family_name, metric_data.instrument_descriptor.description_,
+                     type_name, format);
+
+  for (const auto &point_data_attr : metric_data.point_data_attr_)
+  {
+    labels.clear();
+    WriteLabels(point_data_attr.attributes, scope, resource, labels);
+    if (type == prometheus_client::MetricType::Histogram)
+    {
+      const auto &histogram_point_data =
+          nostd::get<sdk::metrics::HistogramPointData>(point_data_attr.point_data);
+      const auto &boundaries = histogram_point_data.boundaries_;
+      const auto &counts     = histogram_point_data.counts_;
+      AppendSampleStart(output, name, "_count", labels);
+      AppendUnsigned(output, histogram_point_data.count_);
+      output += '\n';
+      AppendSampleStart(output, name, "_sum", labels);
+      AppendDouble(output, ToDouble(histogram_point_data.sum_));
+      output += '\n';
+      std::uint64_t cumulative = 0;
+      for (std::size_t i = 0; i < counts.size(); ++i)
+      {
+        cumulative += counts[i];
+        output += name;
+        output += "_bucket{";
+        if (!labels.empty())
+        {
+          output += labels;
+          output += ',';
+        }
+        output += "le=\"";
+        AppendDouble(output, i < boundaries.size() ? boundaries[i]
+                                                   : std::numeric_limits<double>::infinity());
+        output += "\"} ";
+        AppendUnsigned(output, cumulative);
+        output += '\n';
+      }
+    }
+    else if (nostd::holds_alternative<sdk::metrics::SumPointData>(point_data_attr.point_data))
+    {
+      AppendSampleStart(output, family_name, sample_suffix, labels);
+      AppendDouble(
+          output,
+          ToDouble(nostd::get<sdk::metrics::SumPointData>(point_data_attr.point_data).value_));
+      output += '\n';
+    }
+    else if (type == prometheus_client::MetricType::Gauge &&
+             nostd::holds_alternative<sdk::metrics::LastValuePointData>(
+                 point_data_attr.point_data))
+    {
+      AppendSampleStart(output, family_name, sample_suffix, labels);
+      AppendDouble(output, ToDouble(nostd::get<sdk::metrics::LastValuePointData>(
+                                        point_data_attr.point_data)
+                                        .value_));
+      output += '\n';
+    }
+    else
+    {
+      OTEL_INTERNAL_LOG_WARN(
+          "[Prometheus Exporter] WriteMetricData - "
+          "invalid point data type");
+    }
+  }
+}
+
+void PrometheusExporterUtils::WriteLabels(
+    const metric_sdk::PointAttributes &labels,
+    const opentelemetry::sdk::instrumentationscope::InstrumentationScope *scope,
+    const opentelemetry::sdk::resource::Resource *resource,
+    std::string &output)
+{
+  if (labels.empty() && nullptr == resource)
+  {
+    return;
+  }
+
+  auto append_value = [&output](const opentelemetry::sdk::common::OwnedAttributeValue &value) {
+    if (nostd::holds_alternative<std::string>(value))
+    {
+      AppendEscapedLabelValue(output, nostd::get<std::string>(value));
+    }
+    else
+    {
+      AppendEscapedLabelValue(output, AttributeValueToString(value));
+    }
+    output += '"';
+  };
+
+  // The keys are sanitized in place in the output, and compared with the previous key there, with
+  // the same handling of collisions and order inversions as SetMetricBasic().
+  const std::size_t start   = output.size();
+  std::size_t previous_key  = 0;
+  std::size_t previous_size = 0;
+  for (auto const &label : labels)
+  {
+    const std::size_t label_start = output.size();
+    if (label_start != start)
+    {
+      output += ',';
+    }
+    const std::size_t key = output.size();
+    AppendSanitizedLabel(output, label.first);
+    const std::size_t size = output.size() - key;
+    const int comparison =
+        label_start == start ? -1
+                             : output.compare(previous_key, previous_size, output, key, size);
+    if (comparison < 0)  // new key
+    {
+      previous_key  = key;
+      previous_size = size;
+      output += "=\"";
+      append_value(label.second);
+    }
+    else if (comparison == 0)  // key collision after sanitation
+    {
+      // Append the value to the one of the previous label, before its closing quote.
+      output.resize(label_start - 1);
+      output += ';';
+      append_value(label.second);
+    }
+    else  // order inversion introduced by sanitation
+    {
+      OTEL_INTERNAL_LOG_WARN(
+          "[Prometheus Exporter] WriteLabels - "
+          "the sort order of labels has changed because of sanitization: '"
+          << label.first << "' became '" << output.substr(key, size)
+          << "' which is less than '" << output.substr(previous_key, previous_size)
+          << "'. Ignoring this label.");
+      output.resize(label_start);
+    }
+  }
+  if (!scope)
+  {
+    return;
+  }
+  auto scope_name = scope->GetName();
+  if (!scope_name.empty())
+  {
+    if (output.size() != start)
+    {
+      output += ',';
+    }
+    output += kScopeNameKey;
+    output += "=\"";
+    AppendEscapedLabelValue(output, scope_name);
+    output += '"';
+  }
+  auto scope_version = scope->GetVersion();
+  if (!scope_version.empty())
+  {
+    if (output.size() != start)
+    {
+      output += ',';
+    }
+    output += kScopeVersionKey;
+    output += "=\"";
+    AppendEscapedLabelValue(output, scope_version);
+    output += '"';
+  }
+}
+
 void PrometheusExporterUtils::AddPrometheusLabel(
     std::string name,
     std::string value,
@@ -8,6 +8,8 @@
 #include <cstddef>
 #include <limits>
 #include <list>
+#include <locale>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -15,6 +17,7 @@
 #include "opentelemetry/common/timestamp.h"
 #include "opentelemetry/exporters/prometheus/exporter_utils.h"
 #include "opentelemetry/nostd/unique_ptr.h"
+#include "opentelemetry/nostd/variant.h"
 #include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
 #include "opentelemetry/sdk/metrics/data/metric_data.h"
 #include "opentelemetry/sdk/metrics/export/metric_producer.h"
@@ -286,6 +289,137 @@ TEST(PrometheusExporterUtils, TranslateToPrometheusHistogramNormal)
   ASSERT_EQ(checked_label_num, 3);
 }
 
+TEST(PrometheusExporterUtils, WriteExpositionCounter)
+{
+  TestDataPoints dp;
+  metric_sdk::ResourceMetrics metrics_data = dp.CreateSumPointData();
+
+  std::string output;
+  PrometheusExporterUtils::WriteExposition(
+      metrics_data, exportermetrics::PrometheusExpositionFormat::kText, output, false);
+  PrometheusExporterUtils::WriteExpositionEnd(exportermetrics::PrometheusExpositionFormat::kText,
+                                              output);
+  EXPECT_EQ(output,
+            "# HELP library_name_unit_total description\n"
+            "# TYPE library_name_unit_total counter\n"
+            "library_name_unit_total{a1=\"b1\",otel_scope_name=\"library_name\","
+            "otel_scope_version=\"1.2.0\"} 10\n"
+            "library_name_unit_total{a2=\"b2\",otel_scope_name=\"library_name\","
+            "otel_scope_version=\"1.2.0\"} 20\n");
+
+  output.clear();
+  PrometheusExporterUtils::WriteExposition(
+      metrics_data, exportermetrics::PrometheusExpositionFormat::kOpenMetrics, output, false, true);
+  PrometheusExporterUtils::WriteExpositionEnd(
+      exportermetrics::PrometheusExpositionFormat::kOpenMetrics, output);
+  EXPECT_EQ(output,
+            "# HELP library_name_unit description\n"
+            "# TYPE library_name_unit counter\n"
+            "library_name_unit_total{a1=\"b1\"} 10\n"
+            "library_name_unit_total{a2=\"b2\"} 20\n"
+            "# EOF\n");
+}
+
+TEST(PrometheusExporterUtils, WriteExpositionLastValue)
+{
+  TestDataPoints dp;
+  metric_sdk::ResourceMetrics metrics_data = dp.CreateLastValuePointData();
+
+  std::string output;
+  PrometheusExporterUtils::WriteExposition(
+      metrics_data, exportermetrics::PrometheusExpositionFormat::kText, output, false, true);
+  EXPECT_EQ(output,
+            "# HELP library_name_unit description\n"
+            "# TYPE library_name_unit gauge\n"
+            "library_name_unit{a1=\"b1\"} 10\n"
+            "library_name_unit{a2=\"b2\"} 20\n");
+}
+
+TEST(PrometheusExporterUtils, WriteExpositionDoubleRoundTrip)
+{
+  TestDataPoints dp;
+  metric_sdk::ResourceMetrics metrics_data = dp.CreateLastValuePointData();
+  auto &points = metrics_data.scope_metric_data_[0].metric_data_[0].point_data_attr_;
+  points.resize(1);
+
+  // The values are written with the fewest digits which parse back to the same double.
+  const double values[] = {0.1 + 0.2, 1.0 / 3, 123456789012345678.0, -1e-300};
+  for (double value : values)
+  {
+    opentelemetry::nostd::get<metric_sdk::LastValuePointData>(points[0].point_data).value_ = value;
+    std::string output;
+    PrometheusExporterUtils::WriteExposition(
+        metrics_data, exportermetrics::PrometheusExpositionFormat::kText, output, false, true);
+    const std::string prefix = "library_name_unit{a1=\"b1\"} ";
+    const auto position      = output.find(prefix);
+    ASSERT_NE(position, std::string::npos);
+    std::istringstream stream(output.substr(position + prefix.size()));
+    stream.imbue(std::locale::classic());
+    double parsed = 0;
+    stream >> parsed;
+    EXPECT_EQ(parsed, value);
+  }
+  std::string output;
+  opentelemetry::nostd::get<metric_sdk::LastValuePointData>(points[0].point_data).value_ =
+      0.1 + 0.2;
+  PrometheusExporterUtils::WriteExposition(
+      metrics_data, exportermetrics::PrometheusExpositionFormat::kText, output, false, true);
+  EXPECT_NE(output.find("} 0.30000000000000004\n"), std::string::npos);
+}
+
+TEST(PrometheusExporterUtils, WriteExpositionHistogram)
+{
+  TestDataPoints dp;
+  metric_sdk::ResourceMetrics metrics_data = dp.CreateHistogramPointData();
+  metrics_data.scope_metric_data_[0].metric_data_[0].point_data_attr_.resize(1);
+
+  std::string output;
+  PrometheusExporterUtils::WriteExposition(
+      metrics_data, exportermetrics::PrometheusExpositionFormat::kText, output, false, true);
+  EXPECT_EQ(output,
+            "# HELP library_name_unit description\n"
+            "# TYPE library_name_unit histogram\n"
+            "library_name_unit_count{a1=\"b1\"} 3\n"
+            "library_name_unit_sum{a1=\"b1\"} 900.5\n"
+            "library_name_unit_bucket{a1=\"b1\",le=\"10.1\"} 200\n"
+            "library_name_unit_bucket{a1=\"b1\",le=\"20.2\"} 500\n"
+            "library_name_unit_bucket{a1=\"b1\",le=\"30.2\"} 900\n"
+            "library_name_unit_bucket{a1=\"b1\",le=\"+Inf\"} 1400\n");
+}
+
+TEST(PrometheusExporterUtils, WriteExpositionTargetAndLabels)
+{
+  opentelemetry::sdk::resource::Resource resource = opentelemetry::sdk::resource::Resource::Create(
+      {{"service.name", "test_service"}, {"custom_resource_attr", "custom_resource_value"}});
+  TestDataPoints dp;
+  metric_sdk::ResourceMetrics metrics_data = dp.CreateSumPointData();
+  metrics_data.resource_                   = &resource;
+  auto &points = metrics_data.scope_metric_data_[0].metric_data_[0].point_data_attr_;
+  points.resize(1);
+  points[0].attributes =
+      metric_sdk::PointAttributes{{"foo.a", "quote\"back\\slash\nline"}, {"foo_a", "value2"}};
+
+  std::string output;
+  PrometheusExporterUtils::WriteExposition(
+      metrics_data, exportermetrics::PrometheusExpositionFormat::kOpenMetrics, output);
+  EXPECT_EQ(output.find("# HELP target Target metadata\n# TYPE target info\ntarget_info{"
+                        "otel_scope_name=\"library_name\",otel_scope_version=\"1.2.0\""),
+            0);
+  EXPECT_NE(output.find(",custom_resource_attr=\"custom_resource_value\""), std::string::npos);
+  EXPECT_NE(output.find(",service_name=\"test_service\""), std::string::npos);
+  EXPECT_NE(output.find("\nlibrary_name_unit_total{foo_a=\"quote\\\"back\\\\slash\\nline;value2\","
+                        "otel_scope_name=\"library_name\",otel_scope_version=\"1.2.0\"} 10\n"),
+            std::string::npos);
+
+  points[0].attributes =
+      metric_sdk::PointAttributes{{"foo.a", "value1"}, {"foo.b", "value2"}, {"foo__a", "value3"}};
+  output.clear();
+  PrometheusExporterUtils::WriteExposition(
+      metrics_data, exportermetrics::PrometheusExpositionFormat::kText, output, false, true);
+  EXPECT_NE(output.find("\nlibrary_name_unit_total{foo_a=\"value1\",foo_b=\"value2\"} 10\n"),
+            std::string::npos);
+}
+
 namespace
 {
 class SanitizeTest : public ::testing::Test
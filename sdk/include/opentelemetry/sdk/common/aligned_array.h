@@ -0,0 +1,79 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace common
+{
+/*
+ * A fixed size array of default constructed elements, allocated at the alignment of T.
+ *
+ * Before C++17, new T[n] does not honor an alignment of T larger than the one of
+ * std::max_align_t, e.g. for elements aligned to a cache line with alignas(64). The buffer is
+ * over-allocated instead, and the elements constructed at its first aligned address.
+ */
+template <class T>
+class AlignedArray
+{
+public:
+  static_assert(std::is_nothrow_default_constructible<T>::value,
+                "AlignedArray elements must be nothrow default constructible");
+
+  explicit AlignedArray(size_t size)
+      : size_{size}, buffer_{::operator new(size * sizeof(T) + alignof(T) - 1)}
+  {
+    const uintptr_t address = reinterpret_cast<uintptr_t>(buffer_);
+    const uintptr_t aligned = (address + alignof(T) - 1) & ~static_cast<uintptr_t>(alignof(T) - 1);
+    data_                   = reinterpret_cast<T *>(aligned);
+    for (size_t i = 0; i < size_; ++i)
+    {
+      new (data_ + i) T();
+    }
+  }
+
+  AlignedArray(const AlignedArray &)            = delete;
+  AlignedArray &operator=(const AlignedArray &) = delete;
+
+  ~AlignedArray()
+  {
+    for (size_t i = 0; i < size_; ++i)
+    {
+      data_[i].~T();
+    }
+    ::operator delete(buffer_);
+  }
+
+  T &operator[](size_t i) noexcept { return data_[i]; }
+  const T &operator[](size_t i) const noexcept { return data_[i]; }
+
+  T *begin() noexcept { return data_; }
+  T *end() noexcept { return data_ + size_; }
+  const T *begin() const noexcept { return data_; }
+  const T *end() const noexcept { return data_ + size_; }
+
+  size_t size() const noexcept { return size_; }
+
+  /**
+   * @return the memory allocated for the array, in bytes.
+   */
+  size_t MemoryUsage() const noexcept { return size_ * sizeof(T) + alignof(T) - 1; }
+
+private:
+  size_t size_;
+  void *buffer_;
+  T *data_;
+};
+
+}  // namespace common
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
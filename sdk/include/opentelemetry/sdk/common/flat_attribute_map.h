@@ -0,0 +1,264 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "opentelemetry/common/attribute_value.h"
+#include "opentelemetry/nostd/string_view.h"
+#include "opentelemetry/sdk/common/attribute_utils.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace common
+{
+
+/**
+ * Class for storing the few attributes of a span, an event or a link.
+ *
+ * The attributes are stored contiguously in insertion order, inline up to InlineCapacity
+ * attributes and on the heap beyond, and a key is looked up linearly. This avoids one allocation
+ * per attribute, and is faster than hashing for the small number of attributes typical of a span.
+ *
+ * The interface is the subset of the std::unordered_map one used to read attributes, and the
+ * iteration yields std::pair<std::string, OwnedAttributeValue> elements, so the code iterating the
+ * attributes works with both containers.
+ */
+template <std::size_t InlineCapacity>
+class FlatAttributeMap
+{
+public:
+  using key_type        = std::string;
+  using mapped_type     = OwnedAttributeValue;
+  using value_type      = std::pair<std::string, OwnedAttributeValue>;
+  using size_type       = std::size_t;
+  using reference       = value_type &;
+  using const_reference = const value_type &;
+  using iterator        = value_type *;
+  using const_iterator  = const value_type *;
+
+  FlatAttributeMap() noexcept : data_(InlineData()) {}
+
+  FlatAttributeMap(const FlatAttributeMap &other) : FlatAttributeMap() { CopyFrom(other); }
+
+  FlatAttributeMap(FlatAttributeMap &&other) noexcept : FlatAttributeMap() { MoveFrom(other); }
+
+  FlatAttributeMap &operator=(const FlatAttributeMap &other)
+  {
+    if (this != &other)
+    {
+      clear();
+      CopyFrom(other);
+    }
+    return *this;
+  }
+
+  FlatAttributeMap &operator=(FlatAttributeMap &&other) noexcept
+  {
+    if (this != &other)
+    {
+      clear();
+      ReleaseHeapData();
+      MoveFrom(other);
+    }
+    return *this;
+  }
+
+  ~FlatAttributeMap()
+  {
+    clear();
+    ReleaseHeapData();
+  }
+
+  size_type size() const noexcept { return size_; }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  iterator begin() noexcept { return data_; }
+  iterator end() noexcept { return data_ + size_; }
+  const_iterator begin() const noexcept { return data_; }
+  const_iterator end() const noexcept { return data_ + size_; }
+  const_iterator cbegin() const noexcept { return data_; }
+  const_iterator cend() const noexcept { return data_ + size_; }
+
+  iterator find(nostd::string_view key) noexcept
+  {
+    for (iterator it = begin(); it != end(); ++it)
+    {
+      if (key == it->first)
+      {
+        return it;
+      }
+    }
+    return end();
+  }
+
+  const_iterator find(nostd::string_view key) const noexcept
+  {
+    return const_cast<FlatAttributeMap *>(this)->find(key);
+  }
+
+  size_type count(nostd::string_view key) const noexcept { return find(key) != end() ? 1 : 0; }
+
+  const OwnedAttributeValue &at(nostd::string_view key) const
+  {
+    const_iterator it = find(key);
+    if (it == end())
+    {
+#if OPENTELEMETRY_HAVE_EXCEPTIONS
+      throw std::out_of_range{"opentelemetry::sdk::common::FlatAttributeMap"};
+#else
+      std::terminate();
+#endif
+    }
+    return it->second;
+  }
+
+  /**
+   * Make room for capacity attributes, so that adding them does not allocate.
+   */
+  void reserve(size_type capacity)
+  {
+    if (capacity > capacity_)
+    {
+      Reallocate(capacity);
+    }
+  }
+
+  /**
+   * Remove all the attributes, keeping the memory allocated for them.
+   */
+  void clear() noexcept
+  {
+    for (iterator it = begin(); it != end(); ++it)
+    {
+      it->~value_type();
+    }
+    size_ = 0;
+  }
+
+  // Set the value of an attribute, adding the attribute if it is not present
+  void InsertOrAssign(nostd::string_view key, OwnedAttributeValue &&value)
+  {
+    iterator it = find(key);
+    if (it != end())
+    {
+      it->second = std::move(value);
+      return;
+    }
+    if (size_ == capacity_)
+    {
+      Reallocate(capacity_ * 2);
+    }
+    new (data_ + size_) value_type(std::string(key), std::move(value));
+    ++size_;
+  }
+
+  // Convert non-owning key-value to owning std::string(key) and OwnedAttributeValue(value)
+  bool SetAttribute(nostd::string_view key,
+                    const opentelemetry::common::AttributeValue &value,
+                    std::size_t max_length = (std::numeric_limits<std::size_t>::max)()) noexcept
+  {
+    std::pair<OwnedAttributeValue, bool> result =
+        VisitVariant(AttributeConverter(max_length), value);
+    if (result.second)
+    {
+#if OPENTELEMETRY_HAVE_EXCEPTIONS
+      try
+      {
+#endif
+        InsertOrAssign(key, std::move(result.first));
+        return true;
+#if OPENTELEMETRY_HAVE_EXCEPTIONS
+      }
+      catch (const std::bad_alloc &)
+      {}
+#endif
+    }
+    return false;
+  }
+
+private:
+  static_assert(InlineCapacity > 0, "the inline capacity can not be 0");
+
+  value_type *InlineData() noexcept { return reinterpret_cast<value_type *>(inline_data_); }
+
+  bool IsInline() const noexcept
+  {
+    return data_ == reinterpret_cast<const value_type *>(inline_data_);
+  }
+
+  void ReleaseHeapData() noexcept
+  {
+    if (!IsInline())
+    {
+      ::operator delete(data_);
+      data_     = InlineData();
+      capacity_ = InlineCapacity;
+    }
+  }
+
+  void Reallocate(size_type capacity)
+  {
+    value_type *data = static_cast<value_type *>(::operator new(capacity * sizeof(value_type)));
+    for (size_type i = 0; i < size_; ++i)
+    {
+      new (data + i) value_type(std::move(data_[i]));
+      data_[i].~value_type();
+    }
+    ReleaseHeapData();
+    data_     = data;
+    capacity_ = capacity;
+  }
+
+  void CopyFrom(const FlatAttributeMap &other)
+  {
+    reserve(other.size_);
+    for (const_iterator it = other.begin(); it != other.end(); ++it)
+    {
+      new (data_ + size_) value_type(*it);
+      ++size_;
+    }
+  }
+
+  // Take the attributes of other. This map must be empty, with its inline data.
+  void MoveFrom(FlatAttributeMap &other) noexcept
+  {
+    if (other.IsInline())
+    {
+      for (iterator it = other.begin(); it != other.end(); ++it)
+      {
+        new (data_ + size_) value_type(std::move(*it));
+        ++size_;
+      }
+      other.clear();
+      return;
+    }
+    data_           = other.data_;
+    size_           = other.size_;
+    capacity_       = other.capacity_;
+    other.data_     = other.InlineData();
+    other.size_     = 0;
+    other.capacity_ = InlineCapacity;
+  }
+
+  value_type *data_;
+  size_type size_     = 0;
+  size_type capacity_ = InlineCapacity;
+  alignas(value_type) unsigned char inline_data_[InlineCapacity * sizeof(value_type)];
+};
+
+}  // namespace common
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include "opentelemetry/nostd/span.h"
 #include "opentelemetry/sdk/metrics/data/metric_data.h"
 #include "opentelemetry/version.h"
 
@@ -20,6 +22,29 @@ class Aggregation
 
   virtual void Aggregate(double value, const PointAttributes &attributes = {}) noexcept = 0;
 
+  /**
+   * Aggregates a batch of values recorded for the same attribute set, with the same result as
+   * aggregating them one by one in order. The default implementation does exactly that, while
+   * aggregations may override it to only synchronize once for the whole batch.
+   *
+   * @param values the values to aggregate.
+   */
+  virtual void AggregateBatch(nostd::span<const int64_t> values) noexcept
+  {
+    for (int64_t value : values)
+    {
+      Aggregate(value);
+    }
+  }
+
+  virtual void AggregateBatch(nostd::span<const double> values) noexcept
+  {
+    for (double value : values)
+    {
+      Aggregate(value);
+    }
+  }
+
   /**
    * Returns the result of the merge of the two aggregations.
    *
@@ -32,6 +57,16 @@ class Aggregation
 
   virtual std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept = 0;
 
+  /**
+   * Merges the given aggregation into this one, with the same result as replacing this
+   * aggregation with the result of Merge(delta), but without allocating a new aggregation.
+   *
+   * @param delta the newly captured (delta) aggregation, which must not be this aggregation.
+   * @return false if the aggregation can not be merged in place, in which case Merge() should be
+   * used instead.
+   */
+  virtual bool MergeFrom(const Aggregation & /* delta */) noexcept { return false; }
+
   /**
    * Returns a new delta aggregation by comparing two cumulative measurements.
    *
@@ -48,6 +83,24 @@ class Aggregation
 
   virtual PointType ToPoint() const noexcept = 0;
 
+  /**
+   * Resets the aggregation to the state of a newly created aggregation with the same
+   * configuration, so that it can be reused for a new collection interval.
+   *
+   * @return false if the aggregation can not be reset, in which case a new aggregation should be
+   * created instead.
+   */
+  virtual bool Reset() noexcept { return false; }
+
+  /**
+   * Returns an estimate of the memory used by the aggregation, including the memory it allocated.
+   * Memory shared with other aggregations, such as the bucket boundaries of a histogram, is not
+   * included.
+   *
+   * @return the memory used by the aggregation in bytes, or 0 if it is unknown.
+   */
+  virtual size_t GetMemoryUsage() const noexcept { return 0; }
+
   Aggregation() = default;
 
   Aggregation(const Aggregation &)            = delete;
@@ -3,8 +3,12 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <vector>
 
+#include "opentelemetry/sdk/metrics/aggregation/histogram_bucket_indexer.h"
+#include "opentelemetry/sdk/metrics/data/histogram_boundaries.h"
 #include "opentelemetry/sdk/metrics/instruments.h"
 #include "opentelemetry/sdk/metrics/state/attributes_hashmap.h"
 #include "opentelemetry/version.h"
@@ -40,6 +44,26 @@ class AggregationConfig
   }
 
   size_t cardinality_limit_;
+
+  // Number of independently locked shards used by synchronous instruments to store the
+  // attribute sets recorded in a collection interval. Values greater than 1 reduce lock
+  // contention when many threads record to the same instrument with different attributes.
+  size_t attributes_shard_count_ = 1;
+
+  // Number of consecutive collections without measurements after which an attribute set recorded
+  // by a synchronous instrument is evicted. Until then, the attribute set and its aggregation are
+  // kept and reset in place at each collection, so that recording to them again does not allocate.
+  // 0 evicts all attribute sets at every collection.
+  size_t max_idle_collections_ = 0;
+
+  // Number of consecutive collections without measurements after which an attribute set is
+  // evicted from the cumulative metrics, which are otherwise kept until the process exits. This
+  // bounds the memory of cumulative metrics whose attribute values churn. An evicted attribute set
+  // is not exported anymore, and restarts from zero if it is recorded to again. Collections are
+  // counted once per collection round, at the collections of the first registered reader, whatever
+  // the number of readers. 0 never evicts attribute sets.
+  size_t max_stale_collections_ = 0;
+
   virtual ~AggregationConfig() = default;
 };
 
@@ -53,16 +77,58 @@ class HistogramAggregationConfig : public AggregationConfig
   AggregationType GetType() const noexcept override { return AggregationType::kHistogram; }
 
   // The SDK-specified default bucket boundaries, used when no boundaries are configured.
-  static const std::vector<double> &DefaultBoundaries()
+  static const HistogramBoundaries &DefaultBoundaries()
   {
-    static const std::vector<double> boundaries = {0.0,    5.0,    10.0,   25.0,   50.0,
+    static const HistogramBoundaries boundaries = {0.0,    5.0,    10.0,   25.0,   50.0,
                                                    75.0,   100.0,  250.0,  500.0,  750.0,
                                                    1000.0, 2500.0, 5000.0, 7500.0, 10000.0};
     return boundaries;
   }
 
-  std::vector<double> boundaries_;
+  // The bucket boundaries, shared by the aggregations of all the attribute sets of the view and
+  // by their points.
+  HistogramBoundaries boundaries_;
   bool record_min_max_ = true;
+
+  // Number of per-thread cells in which the measurements of an attribute set are accumulated
+  // before being merged at collection. Each recording thread updates its own cell, which removes
+  // the contention between threads recording to the same attribute set at the cost of one copy of
+  // the bucket counts per cell. Threads share cells when there are more threads than cells, so it
+  // is best set to the number of recording threads. 0 records all the threads in a single shared
+  // set of bucket counts.
+  size_t thread_cell_count_ = 0;
+
+  // Whether the bucket counts of each attribute set are stored in integers as narrow as their
+  // values allow, from 8 to 64 bits, and only widened to 64 bits when the aggregation is read.
+  // This saves memory when there are many attribute sets with low counts, at the cost of slower
+  // recording. It has no effect when thread_cell_count_ is not 0.
+  bool compact_counts_ = false;
+
+  // The bucket indexer of boundaries_, shared by the aggregations of all the attribute sets of the
+  // view and by their merges and diffs, so that the Eytzinger layout of large boundary sets is
+  // computed once. It is only built again after boundaries_ is changed.
+  std::shared_ptr<const HistogramBucketIndexer> GetBucketIndexer() const
+  {
+    std::lock_guard<std::mutex> guard(bucket_indexer_cache_->lock);
+    if (!bucket_indexer_cache_->indexer || !(bucket_indexer_cache_->boundaries == boundaries_))
+    {
+      bucket_indexer_cache_->boundaries = boundaries_;
+      bucket_indexer_cache_->indexer = std::make_shared<const HistogramBucketIndexer>(boundaries_);
+    }
+    return bucket_indexer_cache_->indexer;
+  }
+
+private:
+  struct BucketIndexerCache
+  {
+    std::mutex lock;
+    HistogramBoundaries boundaries;
+    std::shared_ptr<const HistogramBucketIndexer> indexer;
+  };
+
+  // Shared by the copies of the config, which rebuild the indexer if their boundaries differ.
+  std::shared_ptr<BucketIndexerCache> bucket_indexer_cache_ =
+      std::make_shared<BucketIndexerCache>();
 };
 
 // Valid ranges per the declarative configuration schema; the schema defines no maximum for
@@ -7,6 +7,7 @@
 #include <memory>
 
 #include "opentelemetry/common/spin_lock_mutex.h"
+#include "opentelemetry/nostd/span.h"
 #include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
 #include "opentelemetry/sdk/metrics/aggregation/aggregation_config.h"
 #include "opentelemetry/sdk/metrics/aggregation/base2_exponential_histogram_indexer.h"
@@ -31,10 +32,15 @@ class Base2ExponentialHistogramAggregation : public Aggregation
   void Aggregate(int64_t value, const PointAttributes &attributes = {}) noexcept override;
   void Aggregate(double value, const PointAttributes &attributes = {}) noexcept override;
 
+  void AggregateBatch(nostd::span<const int64_t> values) noexcept override;
+  void AggregateBatch(nostd::span<const double> values) noexcept override;
+
   /* Returns the result of merge of the existing aggregation with delta
    * aggregation with same boundaries */
   std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept override;
 
+  bool MergeFrom(const Aggregation &delta) noexcept override;
+
   /* Returns the new delta aggregation by comparing existing aggregation with
    * next aggregation with same boundaries. Data points for `next` aggregation
    * (sum , bucket-counts) should be more than the current aggregation - which
@@ -44,7 +50,11 @@ class Base2ExponentialHistogramAggregation : public Aggregation
 
   PointType ToPoint() const noexcept override;
 
+  size_t GetMemoryUsage() const noexcept override;
+
 private:
+  template <class T>
+  void AggregateValues(nostd::span<const T> values) noexcept;
   void AggregateIntoBuckets(std::unique_ptr<AdaptingCircularBufferCounter> &buckets,
                             double value) noexcept;
   void Downscale(uint32_t by) noexcept;
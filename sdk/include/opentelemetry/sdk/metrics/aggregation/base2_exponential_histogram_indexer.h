@@ -16,10 +16,17 @@ namespace metrics
 /*
  * An indexer for base2 exponential histograms. It is used to calculate index for a given value and
  * scale.
+ *
+ * The index of a normal value is computed from the exponent and the mantissa bits of the double.
+ * Up to kMaxLookupScale, the position of the mantissa within its power of two is found with a
+ * lookup table built once per scale, so no logarithm is computed. Larger scales, and subnormal
+ * values, fall back to the logarithm.
  */
 class Base2ExponentialHistogramIndexer
 {
 public:
+  static constexpr int32_t kMaxLookupScale = 10;
+
   /*
    * Construct a new indexer for a given scale.
    */
@@ -42,6 +49,11 @@ class Base2ExponentialHistogramIndexer
 private:
   int32_t scale_;
   double scale_factor_;
+  // For scales in [1, kMaxLookupScale], the mantissa bits of the lower boundary of each of the
+  // 2^scale buckets of a power of two, and the bucket of the start of each of the 2^(scale + 1)
+  // equal slices of the mantissa range. Both are owned by a static table.
+  const uint64_t *boundaries_ = nullptr;
+  const uint16_t *slices_     = nullptr;
 };
 
 }  // namespace metrics
@@ -5,6 +5,7 @@
 
 #include <memory>
 
+#include "opentelemetry/nostd/span.h"
 #include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
 #include "opentelemetry/sdk/metrics/data/point_data.h"
 #include "opentelemetry/version.h"
@@ -30,11 +31,21 @@ class DropAggregation : public Aggregation
 
   void Aggregate(double /* value */, const PointAttributes & /* attributes */) noexcept override {}
 
+  void AggregateBatch(nostd::span<const int64_t> /* values */) noexcept override {}
+
+  void AggregateBatch(nostd::span<const double> /* values */) noexcept override {}
+
   std::unique_ptr<Aggregation> Merge(const Aggregation &) const noexcept override;
 
+  bool MergeFrom(const Aggregation & /* delta */) noexcept override { return true; }
+
   std::unique_ptr<Aggregation> Diff(const Aggregation &) const noexcept override;
 
   PointType ToPoint() const noexcept override;
+
+  bool Reset() noexcept override;
+
+  size_t GetMemoryUsage() const noexcept override { return sizeof(*this); }
 };
 }  // namespace metrics
 }  // namespace sdk
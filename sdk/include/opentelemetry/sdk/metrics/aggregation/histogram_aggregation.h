@@ -10,9 +10,13 @@
 #include <vector>
 
 #include "opentelemetry/common/spin_lock_mutex.h"
+#include "opentelemetry/nostd/span.h"
 #include "opentelemetry/nostd/variant.h"
+#include "opentelemetry/sdk/common/aligned_array.h"
 #include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
 #include "opentelemetry/sdk/metrics/aggregation/aggregation_config.h"
+#include "opentelemetry/sdk/metrics/aggregation/histogram_bucket_indexer.h"
+#include "opentelemetry/sdk/metrics/data/circular_buffer.h"
 #include "opentelemetry/sdk/metrics/data/metric_data.h"
 #include "opentelemetry/sdk/metrics/data/point_data.h"
 #include "opentelemetry/version.h"
@@ -24,6 +28,55 @@ namespace metrics
 {
 class AggregationConfig;
 
+/**
+ * Per-thread accumulation cells of an explicit bucket histogram aggregation, used when
+ * HistogramAggregationConfig::thread_cell_count_ is not 0.
+ *
+ * Each recording thread is assigned one of the cells, and only locks and updates its own cell, so
+ * that threads recording to the same aggregation do not exchange cache lines. The cells are only
+ * merged into the point data when the aggregation is read. Threads share cells when there are
+ * more recording threads than cells.
+ */
+template <class T>
+class HistogramThreadCells
+{
+public:
+  HistogramThreadCells(size_t cell_count, size_t bucket_count);
+
+  void Aggregate(T value, size_t index, bool record_min_max) noexcept;
+
+  void AggregateBatch(nostd::span<const T> values,
+                      const HistogramBucketIndexer &indexer,
+                      bool record_min_max) noexcept;
+
+  // Add the measurements of all the cells to the point data.
+  void MergeInto(HistogramPointData &point_data) const noexcept;
+
+  void Reset() noexcept;
+
+  // The memory allocated for the cells and their bucket counts, in bytes.
+  size_t GetMemoryUsage() const noexcept;
+
+private:
+  // Aligned to a cache line, so that the fields of neighbouring cells are on different lines.
+  struct alignas(64) Cell
+  {
+    mutable opentelemetry::common::SpinLockMutex lock;
+    uint64_t count;
+    T sum;
+    T min;
+    T max;
+  };
+
+  void ResetCell(size_t cell_index) noexcept;
+
+  opentelemetry::sdk::common::AlignedArray<Cell> cells_;
+  // Distance between the bucket counts of two consecutive cells in counts_, which leaves at least
+  // a cache line between them.
+  size_t stride_;
+  std::vector<uint64_t> counts_;
+};
+
 class LongHistogramAggregation : public Aggregation
 {
 public:
@@ -35,10 +88,16 @@ class LongHistogramAggregation : public Aggregation
 
   void Aggregate(double /* value */, const PointAttributes & /* attributes */) noexcept override {}
 
+  void AggregateBatch(nostd::span<const int64_t> values) noexcept override;
+
+  void AggregateBatch(nostd::span<const double> /* values */) noexcept override {}
+
   /* Returns the result of merge of the existing aggregation with delta aggregation with same
    * boundaries */
   std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept override;
 
+  bool MergeFrom(const Aggregation &delta) noexcept override;
+
   /* Returns the new delta aggregation by comparing existing aggregation with next aggregation with
    * same boundaries. Data points for `next` aggregation (sum , bucket-counts) should be more than
    * the current aggregation - which is the normal scenario as measurements values are monotonic
@@ -48,9 +107,23 @@ class LongHistogramAggregation : public Aggregation
 
   PointType ToPoint() const noexcept override;
 
+  bool Reset() noexcept override;
+
+  size_t GetMemoryUsage() const noexcept override;
+
 private:
+  // An empty aggregation with the given boundaries and their bucket indexer, for merges and diffs.
+  LongHistogramAggregation(const HistogramBoundaries &boundaries,
+                           std::shared_ptr<const HistogramBucketIndexer> indexer,
+                           bool record_min_max);
+
   mutable opentelemetry::common::SpinLockMutex lock_;
   HistogramPointData point_data_;
+  std::shared_ptr<const HistogramBucketIndexer> indexer_;
+  std::unique_ptr<HistogramThreadCells<int64_t>> cells_;
+  // The bucket counts when HistogramAggregationConfig::compact_counts_ is set, in which case the
+  // counts of point_data_ are empty.
+  std::unique_ptr<AdaptingIntegerArray> compact_counts_;
   bool record_min_max_ = true;
 };
 
@@ -65,10 +138,16 @@ class DoubleHistogramAggregation : public Aggregation
 
   void Aggregate(double value, const PointAttributes &attributes = {}) noexcept override;
 
+  void AggregateBatch(nostd::span<const int64_t> /* values */) noexcept override {}
+
+  void AggregateBatch(nostd::span<const double> values) noexcept override;
+
   /* Returns the result of merge of the existing aggregation with delta aggregation with same
    * boundaries */
   std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept override;
 
+  bool MergeFrom(const Aggregation &delta) noexcept override;
+
   /* Returns the new delta aggregation by comparing existing aggregation with next aggregation with
    * same boundaries. Data points for `next` aggregation (sum , bucket-counts) should be more than
    * the current aggregation - which is the normal scenario as measurements values are monotonic
@@ -78,9 +157,23 @@ class DoubleHistogramAggregation : public Aggregation
 
   PointType ToPoint() const noexcept override;
 
+  bool Reset() noexcept override;
+
+  size_t GetMemoryUsage() const noexcept override;
+
 private:
+  // An empty aggregation with the given boundaries and their bucket indexer, for merges and diffs.
+  DoubleHistogramAggregation(const HistogramBoundaries &boundaries,
+                             std::shared_ptr<const HistogramBucketIndexer> indexer,
+                             bool record_min_max);
+
   mutable opentelemetry::common::SpinLockMutex lock_;
   mutable HistogramPointData point_data_;
+  std::shared_ptr<const HistogramBucketIndexer> indexer_;
+  std::unique_ptr<HistogramThreadCells<double>> cells_;
+  // The bucket counts when HistogramAggregationConfig::compact_counts_ is set, in which case the
+  // counts of point_data_ are empty.
+  std::unique_ptr<AdaptingIntegerArray> compact_counts_;
   bool record_min_max_ = true;
 };
 
@@ -104,6 +197,24 @@ void HistogramMerge(HistogramPointData &current,
   }
 }
 
+// Same as HistogramMerge(), with current as the result of the merge.
+template <class T>
+void HistogramMergeFrom(HistogramPointData &current, const HistogramPointData &delta)
+{
+  for (size_t i = 0; i < current.counts_.size(); i++)
+  {
+    current.counts_[i] += delta.counts_[i];
+  }
+  current.sum_            = nostd::get<T>(current.sum_) + nostd::get<T>(delta.sum_);
+  current.count_          = current.count_ + delta.count_;
+  current.record_min_max_ = current.record_min_max_ && delta.record_min_max_;
+  if (current.record_min_max_)
+  {
+    current.min_ = (std::min)(nostd::get<T>(current.min_), nostd::get<T>(delta.min_));
+    current.max_ = (std::max)(nostd::get<T>(current.max_), nostd::get<T>(delta.max_));
+  }
+}
+
 template <class T>
 void HistogramDiff(HistogramPointData &current, HistogramPointData &next, HistogramPointData &diff)
 {
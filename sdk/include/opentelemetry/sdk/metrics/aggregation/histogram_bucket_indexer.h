@@ -0,0 +1,85 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "opentelemetry/sdk/metrics/data/histogram_boundaries.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+
+/*
+ * An indexer for explicit bucket histograms. It is used to find the bucket of a given value for a
+ * set of sorted bucket boundaries.
+ *
+ * The search kernel is picked when the indexer is constructed. Up to kMaxLinearSearchBoundaries
+ * boundaries, which covers the default boundaries and most custom ones, all the boundaries are
+ * compared to the value without branching, using SSE2 or AVX2 when the target supports them.
+ * Larger boundary sets are stored in Eytzinger (breadth-first) order, so that the binary search
+ * reads the boundaries close to the root of the implicit tree from the same cache lines.
+ *
+ * The linear search reads the shared boundaries in place, and copies of an indexer share its
+ * Eytzinger layout, so that the indexers of all the series of a histogram do not each hold a copy.
+ */
+class HistogramBucketIndexer
+{
+public:
+  static constexpr size_t kMaxLinearSearchBoundaries = 32;
+
+  /*
+   * Construct a new indexer for the given boundaries, which must be sorted in ascending order.
+   */
+  explicit HistogramBucketIndexer(const HistogramBoundaries &boundaries = {});
+
+  HistogramBucketIndexer(const HistogramBucketIndexer &)            = default;
+  HistogramBucketIndexer(HistogramBucketIndexer &&)                 = default;
+  HistogramBucketIndexer &operator=(const HistogramBucketIndexer &) = default;
+  HistogramBucketIndexer &operator=(HistogramBucketIndexer &&)      = default;
+  ~HistogramBucketIndexer()                                         = default;
+
+  /**
+   * Compute the index for the given value.
+   *
+   * @param value Measured value.
+   * @return the index of the bucket which the value maps to, which is the number of boundaries
+   * lower than the value. This is the same index as the one found by BucketBinarySearch(), and
+   * NaN maps to the first bucket.
+   */
+  size_t ComputeIndex(double value) const noexcept;
+
+private:
+  size_t ComputeIndexLinear(double value) const noexcept;
+  size_t ComputeIndexEytzinger(double value) const noexcept;
+
+  struct EytzingerLayout
+  {
+    // The boundaries in Eytzinger order, starting at index 1.
+    std::vector<double> boundaries;
+    // The position in ascending order of each boundary, indexed like boundaries. The entry at
+    // index 0 is the number of boundaries.
+    std::vector<uint32_t> ranks;
+  };
+
+  // Owners of the searched arrays: the boundaries in ascending order for the linear search, or
+  // the Eytzinger layout otherwise.
+  HistogramBoundaries sorted_;
+  std::shared_ptr<const EytzingerLayout> layout_;
+  // The searched arrays, cached to avoid an indirection per search.
+  const double *boundaries_ = nullptr;
+  const uint32_t *ranks_    = nullptr;
+  size_t size_              = 0;
+  bool eytzinger_;
+};
+
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -3,10 +3,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 
-#include "opentelemetry/common/spin_lock_mutex.h"
 #include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
 #include "opentelemetry/sdk/metrics/data/metric_data.h"
 #include "opentelemetry/sdk/metrics/data/point_data.h"
@@ -29,13 +29,24 @@ class LongLastValueAggregation : public Aggregation
 
   std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept override;
 
+  bool MergeFrom(const Aggregation &delta) noexcept override;
+
   std::unique_ptr<Aggregation> Diff(const Aggregation &next) const noexcept override;
 
   PointType ToPoint() const noexcept override;
 
+  bool Reset() noexcept override;
+
+  size_t GetMemoryUsage() const noexcept override { return sizeof(*this); }
+
 private:
-  mutable opentelemetry::common::SpinLockMutex lock_;
-  LastValuePointData point_data_;
+  // The last measurement is published with a sequence number, which is odd while a measurement
+  // is being written. ToPoint() retries until it reads the fields under the same even sequence
+  // number, so recording a measurement only waits for the concurrent writes of the fields.
+  std::atomic<uint64_t> sequence_{0};
+  std::atomic<int64_t> value_{0};
+  std::atomic<int64_t> sample_ts_{0};
+  std::atomic<bool> is_lastvalue_valid_{false};
 };
 
 class DoubleLastValueAggregation : public Aggregation
@@ -50,13 +61,22 @@ class DoubleLastValueAggregation : public Aggregation
 
   std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept override;
 
+  bool MergeFrom(const Aggregation &delta) noexcept override;
+
   std::unique_ptr<Aggregation> Diff(const Aggregation &next) const noexcept override;
 
   PointType ToPoint() const noexcept override;
 
+  bool Reset() noexcept override;
+
+  size_t GetMemoryUsage() const noexcept override { return sizeof(*this); }
+
 private:
-  mutable opentelemetry::common::SpinLockMutex lock_;
-  mutable LastValuePointData point_data_;
+  // See LongLastValueAggregation.
+  std::atomic<uint64_t> sequence_{0};
+  std::atomic<double> value_{0.0};
+  std::atomic<int64_t> sample_ts_{0};
+  std::atomic<bool> is_lastvalue_valid_{false};
 };
 
 }  // namespace metrics
@@ -3,10 +3,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 
-#include "opentelemetry/common/spin_lock_mutex.h"
+#include "opentelemetry/nostd/span.h"
 #include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
 #include "opentelemetry/sdk/metrics/data/metric_data.h"
 #include "opentelemetry/sdk/metrics/data/point_data.h"
@@ -28,15 +29,26 @@ class LongSumAggregation : public Aggregation
 
   void Aggregate(double /* value */, const PointAttributes & /* attributes */) noexcept override {}
 
+  void AggregateBatch(nostd::span<const int64_t> values) noexcept override;
+
+  void AggregateBatch(nostd::span<const double> /* values */) noexcept override {}
+
   std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept override;
 
+  bool MergeFrom(const Aggregation &delta) noexcept override;
+
   std::unique_ptr<Aggregation> Diff(const Aggregation &next) const noexcept override;
 
   PointType ToPoint() const noexcept override;
 
+  bool Reset() noexcept override;
+
+  size_t GetMemoryUsage() const noexcept override { return sizeof(*this); }
+
 private:
-  mutable opentelemetry::common::SpinLockMutex lock_;
-  SumPointData point_data_;
+  // Measurements are added with an atomic fetch_add, without locking.
+  std::atomic<int64_t> value_{0};
+  bool is_monotonic_;
 };
 
 class DoubleSumAggregation : public Aggregation
@@ -49,15 +61,26 @@ class DoubleSumAggregation : public Aggregation
 
   void Aggregate(double value, const PointAttributes &attributes = {}) noexcept override;
 
+  void AggregateBatch(nostd::span<const int64_t> /* values */) noexcept override {}
+
+  void AggregateBatch(nostd::span<const double> values) noexcept override;
+
   std::unique_ptr<Aggregation> Merge(const Aggregation &delta) const noexcept override;
 
+  bool MergeFrom(const Aggregation &delta) noexcept override;
+
   std::unique_ptr<Aggregation> Diff(const Aggregation &next) const noexcept override;
 
   PointType ToPoint() const noexcept override;
 
+  bool Reset() noexcept override;
+
+  size_t GetMemoryUsage() const noexcept override { return sizeof(*this); }
+
 private:
-  mutable opentelemetry::common::SpinLockMutex lock_;
-  SumPointData point_data_;
+  // Measurements are added with a compare and swap loop, without locking.
+  std::atomic<double> value_{0.0};
+  bool is_monotonic_;
 };
 
 }  // namespace metrics
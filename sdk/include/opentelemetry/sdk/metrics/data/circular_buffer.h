@@ -61,6 +61,13 @@ class AdaptingIntegerArray
    */
   size_t Size() const;
 
+  /**
+   * Returns the memory allocated for the values of the array.
+   *
+   * @return The size of the values, in bytes.
+   */
+  size_t MemoryUsage() const;
+
   /**
    * Clears the array, resetting all values to zero.
    */
@@ -80,6 +87,9 @@ class AdaptingIntegerArray
   void Fold(size_t from, size_t to);
 
 private:
+  // Downscale() and MergeFrom() of the counter work on the typed cells directly.
+  friend class AdaptingCircularBufferCounter;
+
   void EnlargeToFit(uint64_t value);
 
   nostd::variant<std::vector<uint8_t>,
@@ -137,6 +147,11 @@ class AdaptingCircularBufferCounter
    */
   size_t MaxSize() const { return backing_.Size(); }
 
+  /**
+   * Returns the memory allocated for the bucket counts, in bytes.
+   */
+  size_t MemoryUsage() const { return backing_.MemoryUsage(); }
+
   /** Resets all bucket counts to zero and resets index start/end tracking. **/
   void Clear();
 
@@ -171,14 +186,24 @@ class AdaptingCircularBufferCounter
    */
   void Downscale(uint32_t by);
 
+  /**
+   * Adds the count of every bucket of `other` to the bucket with the same index.
+   *
+   * Both counters must hold buckets of the same scale. The cells of both
+   * counters are read and written directly, without looking up each index
+   * separately, and the cells are only widened when a merged count does not
+   * fit.
+   *
+   * @param other The counter to add to this one.
+   * @return false, leaving this counter unchanged, when the union of both
+   * index ranges does not fit in MaxSize() buckets.
+   */
+  bool MergeFrom(const AdaptingCircularBufferCounter &other);
+
 private:
   size_t ToBufferIndex(int32_t index) const;
   size_t ToBufferIndex(int32_t index, int32_t base_index) const;
 
-  // Moves the count at `index` into the bucket it folds into, expressed against
-  // the post-downscale base index. Only valid as a step of Downscale().
-  void FoldBucket(int32_t index, int32_t new_base_index, uint32_t shift);
-
   static constexpr int32_t kNullIndex = (std::numeric_limits<int32_t>::min)();
 
   // Index of the first populated element, may be kNullIndex if container is empty.
@@ -0,0 +1,111 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+
+/**
+ * The bucket boundaries of an explicit bucket histogram.
+ *
+ * A HistogramBoundaries is an immutable, reference counted array of boundaries: copying it only
+ * copies a pointer. The boundaries configured for a view are held once, and the aggregations of
+ * every series, their points and the exporters share them instead of copying them.
+ *
+ * It can be used as a read only std::vector<double>.
+ */
+class HistogramBoundaries
+{
+public:
+  using value_type     = double;
+  using size_type      = std::size_t;
+  using const_iterator = std::vector<double>::const_iterator;
+  using iterator       = const_iterator;
+
+  HistogramBoundaries() noexcept = default;
+
+  HistogramBoundaries(const std::vector<double> &boundaries)
+      : boundaries_(std::make_shared<const std::vector<double>>(boundaries))
+  {}
+
+  HistogramBoundaries(std::vector<double> &&boundaries)
+      : boundaries_(std::make_shared<const std::vector<double>>(std::move(boundaries)))
+  {}
+
+  HistogramBoundaries(std::initializer_list<double> boundaries)
+      : boundaries_(std::make_shared<const std::vector<double>>(boundaries))
+  {}
+
+  /**
+   * @return the boundaries.
+   */
+  const std::vector<double> &GetBoundaries() const noexcept
+  {
+    static const std::vector<double> empty_boundaries;
+    return boundaries_ ? *boundaries_ : empty_boundaries;
+  }
+
+  operator const std::vector<double> &() const noexcept { return GetBoundaries(); }
+
+  const_iterator begin() const noexcept { return GetBoundaries().begin(); }
+  const_iterator end() const noexcept { return GetBoundaries().end(); }
+  const_iterator cbegin() const noexcept { return GetBoundaries().cbegin(); }
+  const_iterator cend() const noexcept { return GetBoundaries().cend(); }
+
+  const double *data() const noexcept { return GetBoundaries().data(); }
+  const double &operator[](size_type i) const noexcept { return GetBoundaries()[i]; }
+  const double &front() const noexcept { return GetBoundaries().front(); }
+  const double &back() const noexcept { return GetBoundaries().back(); }
+
+  size_type size() const noexcept { return GetBoundaries().size(); }
+  bool empty() const noexcept { return GetBoundaries().empty(); }
+
+  friend bool operator==(const HistogramBoundaries &lhs, const HistogramBoundaries &rhs)
+  {
+    return lhs.boundaries_ == rhs.boundaries_ || lhs.GetBoundaries() == rhs.GetBoundaries();
+  }
+
+  friend bool operator==(const HistogramBoundaries &lhs, const std::vector<double> &rhs)
+  {
+    return lhs.GetBoundaries() == rhs;
+  }
+
+  friend bool operator==(const std::vector<double> &lhs, const HistogramBoundaries &rhs)
+  {
+    return lhs == rhs.GetBoundaries();
+  }
+
+  friend bool operator!=(const HistogramBoundaries &lhs, const HistogramBoundaries &rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  friend bool operator!=(const HistogramBoundaries &lhs, const std::vector<double> &rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  friend bool operator!=(const std::vector<double> &lhs, const HistogramBoundaries &rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+private:
+  std::shared_ptr<const std::vector<double>> boundaries_;
+};
+
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
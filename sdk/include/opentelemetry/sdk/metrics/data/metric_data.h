@@ -5,8 +5,9 @@
 
 #include <vector>
 
+#include "opentelemetry/common/timestamp.h"
 #include "opentelemetry/nostd/variant.h"
-#include "opentelemetry/sdk/common/attribute_utils.h"
+#include "opentelemetry/sdk/metrics/data/point_attributes.h"
 #include "opentelemetry/sdk/metrics/data/point_data.h"
 #include "opentelemetry/sdk/metrics/instruments.h"
 #include "opentelemetry/version.h"
@@ -17,17 +18,20 @@ namespace sdk
 namespace metrics
 {
 
-using PointAttributes = opentelemetry::sdk::common::OrderedAttributeMap;
-using PointType       = opentelemetry::nostd::variant<SumPointData,
-                                                      HistogramPointData,
-                                                      Base2ExponentialHistogramPointData,
-                                                      LastValuePointData,
-                                                      DropPointData>;
+using PointType = opentelemetry::nostd::variant<SumPointData,
+                                                HistogramPointData,
+                                                Base2ExponentialHistogramPointData,
+                                                LastValuePointData,
+                                                DropPointData>;
 
 struct PointDataAttributes
 {
   PointAttributes attributes;
   PointType point_data;
+  // The start of the series of the point when it is later than the start_ts of the MetricData,
+  // for example for a cumulative series which restarted from zero after being evicted. Zero
+  // otherwise.
+  opentelemetry::common::SystemTimestamp start_ts;
 };
 
 class MetricData
@@ -0,0 +1,115 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "opentelemetry/common/attribute_value.h"
+#include "opentelemetry/common/key_value_iterable.h"
+#include "opentelemetry/nostd/string_view.h"
+#include "opentelemetry/sdk/common/attribute_utils.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+
+/**
+ * The attribute set of a metric point.
+ *
+ * A PointAttributes is an immutable, reference counted attribute set: copying it only copies a
+ * pointer. The metric storages create the attribute set of a series once, and the points of
+ * every collection, as well as the exporters, share it instead of copying its keys and values.
+ *
+ * It can be used as a read only ordered map of the attribute keys to their values.
+ */
+class PointAttributes
+{
+public:
+  using key_type       = std::string;
+  using mapped_type    = opentelemetry::sdk::common::OwnedAttributeValue;
+  using value_type     = opentelemetry::sdk::common::OrderedAttributeMap::value_type;
+  using size_type      = std::size_t;
+  using const_iterator = opentelemetry::sdk::common::OrderedAttributeMap::const_iterator;
+  using iterator       = const_iterator;
+
+  PointAttributes() noexcept = default;
+
+  PointAttributes(const opentelemetry::sdk::common::OrderedAttributeMap &attributes)
+      : attributes_(std::make_shared<const opentelemetry::sdk::common::OrderedAttributeMap>(
+            attributes))
+  {}
+
+  PointAttributes(opentelemetry::sdk::common::OrderedAttributeMap &&attributes)
+      : attributes_(std::make_shared<const opentelemetry::sdk::common::OrderedAttributeMap>(
+            std::move(attributes)))
+  {}
+
+  PointAttributes(
+      std::initializer_list<std::pair<nostd::string_view, opentelemetry::common::AttributeValue>>
+          attributes)
+      : PointAttributes(opentelemetry::sdk::common::OrderedAttributeMap(attributes))
+  {}
+
+  PointAttributes(const opentelemetry::common::KeyValueIterable &attributes)
+      : PointAttributes(opentelemetry::sdk::common::OrderedAttributeMap(attributes))
+  {}
+
+  /**
+   * Share the given attribute set, which must not be modified anymore.
+   */
+  explicit PointAttributes(
+      std::shared_ptr<const opentelemetry::sdk::common::OrderedAttributeMap> attributes) noexcept
+      : attributes_(std::move(attributes))
+  {}
+
+  /**
+   * @return the attribute set.
+   */
+  const opentelemetry::sdk::common::OrderedAttributeMap &GetAttributes() const noexcept
+  {
+    static const opentelemetry::sdk::common::OrderedAttributeMap empty_attributes;
+    return attributes_ ? *attributes_ : empty_attributes;
+  }
+
+  const_iterator begin() const noexcept { return GetAttributes().begin(); }
+  const_iterator end() const noexcept { return GetAttributes().end(); }
+  const_iterator cbegin() const noexcept { return GetAttributes().cbegin(); }
+  const_iterator cend() const noexcept { return GetAttributes().cend(); }
+
+  const_iterator find(const std::string &key) const { return GetAttributes().find(key); }
+  size_type count(const std::string &key) const { return GetAttributes().count(key); }
+  const mapped_type &at(const std::string &key) const { return GetAttributes().at(key); }
+
+  size_type size() const noexcept { return GetAttributes().size(); }
+  bool empty() const noexcept { return GetAttributes().empty(); }
+
+  friend bool operator==(const PointAttributes &lhs, const PointAttributes &rhs)
+  {
+    return lhs.attributes_ == rhs.attributes_ || lhs.GetAttributes() == rhs.GetAttributes();
+  }
+
+  friend bool operator!=(const PointAttributes &lhs, const PointAttributes &rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  friend bool operator<(const PointAttributes &lhs, const PointAttributes &rhs)
+  {
+    return lhs.attributes_ != rhs.attributes_ && lhs.GetAttributes() < rhs.GetAttributes();
+  }
+
+private:
+  std::shared_ptr<const opentelemetry::sdk::common::OrderedAttributeMap> attributes_;
+};
+
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
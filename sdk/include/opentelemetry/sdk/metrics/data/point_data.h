@@ -3,11 +3,13 @@
 
 #pragma once
 
+#include <utility>
 #include <vector>
 
 #include "opentelemetry/common/timestamp.h"
 #include "opentelemetry/nostd/variant.h"
 #include "opentelemetry/sdk/metrics/data/circular_buffer.h"
+#include "opentelemetry/sdk/metrics/data/histogram_boundaries.h"
 #include "opentelemetry/version.h"
 
 OPENTELEMETRY_BEGIN_NAMESPACE
@@ -60,11 +62,11 @@ class HistogramPointData
   HistogramPointData &operator=(HistogramPointData &&) = default;
   HistogramPointData(const HistogramPointData &)       = default;
   HistogramPointData()                                 = default;
-  HistogramPointData(const std::vector<double> &boundaries) : boundaries_(boundaries) {}
+  HistogramPointData(HistogramBoundaries boundaries) : boundaries_(std::move(boundaries)) {}
   HistogramPointData &operator=(const HistogramPointData &other) = default;
   ~HistogramPointData()                                          = default;
 
-  std::vector<double> boundaries_ = {};
+  HistogramBoundaries boundaries_ = {};
   ValueType sum_                  = {};
   ValueType min_                  = {};
   ValueType max_                  = {};
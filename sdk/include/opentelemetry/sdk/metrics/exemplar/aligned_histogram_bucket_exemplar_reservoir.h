@@ -10,6 +10,7 @@
 
 #  include "opentelemetry/sdk/common/global_log_handler.h"
 #  include "opentelemetry/sdk/metrics/data/exemplar_data.h"
+#  include "opentelemetry/sdk/metrics/data/histogram_boundaries.h"
 #  include "opentelemetry/sdk/metrics/exemplar/filter_type.h"
 #  include "opentelemetry/sdk/metrics/exemplar/fixed_size_exemplar_reservoir.h"
 #  include "opentelemetry/sdk/metrics/exemplar/reservoir.h"
@@ -32,7 +33,7 @@ class AlignedHistogramBucketExemplarReservoir : public FixedSizeExemplarReservoi
 
 public:
   static std::shared_ptr<ReservoirCellSelector> GetHistogramCellSelector(
-      const std::vector<double> &boundaries = std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0})
+      const HistogramBoundaries &boundaries = HistogramBoundaries{1.0, 2.0, 3.0, 4.0, 5.0})
   {
     return std::shared_ptr<ReservoirCellSelector>{new HistogramCellSelector(boundaries)};
   }
@@ -47,7 +48,7 @@ class AlignedHistogramBucketExemplarReservoir : public FixedSizeExemplarReservoi
   class HistogramCellSelector : public ReservoirCellSelector
   {
   public:
-    HistogramCellSelector(const std::vector<double> &boundaries) : boundaries_(boundaries) {}
+    HistogramCellSelector(const HistogramBoundaries &boundaries) : boundaries_(boundaries) {}
 
     int ReservoirCellIndexFor(const std::vector<ReservoirCell> &cells,
                               int64_t value,
@@ -82,7 +83,7 @@ class AlignedHistogramBucketExemplarReservoir : public FixedSizeExemplarReservoi
     }
 
   private:
-    std::vector<double> boundaries_;
+    HistogramBoundaries boundaries_;
   };
 };
 
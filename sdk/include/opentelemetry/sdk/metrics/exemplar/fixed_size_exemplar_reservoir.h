@@ -5,6 +5,8 @@
 
 #ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
 
+#  include <atomic>
+#  include <cstddef>
 #  include <memory>
 #  include <vector>
 
@@ -12,9 +14,12 @@
 #  include "opentelemetry/nostd/function_ref.h"
 #  include "opentelemetry/nostd/shared_ptr.h"
 #  include "opentelemetry/sdk/common/attribute_utils.h"
+#  include "opentelemetry/sdk/metrics/data/exemplar_data.h"
+#  include "opentelemetry/sdk/metrics/data/metric_data.h"
 #  include "opentelemetry/sdk/metrics/exemplar/reservoir.h"
 #  include "opentelemetry/sdk/metrics/exemplar/reservoir_cell.h"
 #  include "opentelemetry/sdk/metrics/exemplar/reservoir_cell_selector.h"
+#  include "opentelemetry/trace/span_context.h"
 
 OPENTELEMETRY_BEGIN_NAMESPACE
 namespace sdk
@@ -30,10 +35,12 @@ class FixedSizeExemplarReservoir : public ExemplarReservoir
                              const std::shared_ptr<ReservoirCellSelector> &reservoir_cell_selector,
                              MapAndResetCellType map_and_reset_cell)
       : storage_(size),
+        pool_(size),
         reservoir_cell_selector_(reservoir_cell_selector),
         map_and_reset_cell_(map_and_reset_cell)
   {}
 
+  using ExemplarReservoir::CollectAndReset;
   using ExemplarReservoir::OfferMeasurement;
 
   void OfferMeasurement(int64_t value,
@@ -72,27 +79,45 @@ class FixedSizeExemplarReservoir : public ExemplarReservoir
       const MetricAttributes &pointAttributes) noexcept override
   {
     std::vector<std::shared_ptr<ExemplarData>> results;
-    if (!reservoir_cell_selector_)
-    {
-      return results;
-    }
-    if (!map_and_reset_cell_)
+    CollectAndReset(pointAttributes, results);
+    return results;
+  }
+
+  void CollectAndReset(const MetricAttributes &pointAttributes,
+                       std::vector<std::shared_ptr<ExemplarData>> &exemplars) noexcept override
+  {
+    if (!reservoir_cell_selector_ || !map_and_reset_cell_)
     {
-      reservoir_cell_selector_.reset();
-      return results;
+      return;
     }
-    for (auto reservoirCell : storage_)
+    for (size_t i = 0; i < storage_.size(); i++)
     {
-      auto result = (reservoirCell.*(map_and_reset_cell_))(pointAttributes);
-      results.push_back(result);
+      std::shared_ptr<ExemplarData> &slot = pool_[i];
+      if (slot.use_count() == 1)
+      {
+        // Released by the exporter: the reads of the exporter happen before the slot is reused.
+        std::atomic_thread_fence(std::memory_order_acquire);
+      }
+      else
+      {
+        // Still held by the exporter of a previous collection, if any.
+        slot = std::make_shared<ExemplarData>(ExemplarData::Create(
+            opentelemetry::trace::SpanContext::GetInvalid(), {}, PointDataAttributes{}));
+      }
+      if ((storage_[i].*(map_and_reset_cell_))(pointAttributes, *slot))
+      {
+        exemplars.push_back(slot);
+      }
     }
-    reservoir_cell_selector_.reset();
-    return results;
+    reservoir_cell_selector_->reset();
   }
 
 private:
   explicit FixedSizeExemplarReservoir() = default;
   std::vector<ReservoirCell> storage_;
+  // The exemplar data handed out by the collections, one slot per cell. A slot released by its
+  // exporter is overwritten by the next collection rather than allocated again.
+  std::vector<std::shared_ptr<ExemplarData>> pool_;
   std::shared_ptr<ReservoirCellSelector> reservoir_cell_selector_;
   MapAndResetCellType map_and_reset_cell_{nullptr};
 };
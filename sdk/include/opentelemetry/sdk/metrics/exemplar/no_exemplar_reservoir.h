@@ -40,6 +40,8 @@ class NoExemplarReservoir final : public ExemplarReservoir
     // Stores nothing.
   }
 
+  using ExemplarReservoir::CollectAndReset;
+
   std::vector<std::shared_ptr<ExemplarData>> CollectAndReset(
       const MetricAttributes & /* pointAttributes */) noexcept override
   {
@@ -68,6 +68,20 @@ class ExemplarReservoir
   virtual std::vector<std::shared_ptr<ExemplarData>> CollectAndReset(
       const MetricAttributes &pointAttributes) noexcept = 0;
 
+  /**
+   * Appends the Exemplars of the current reservoir to exemplars, and clears the reservoir for the
+   * next sampling period.
+   *
+   * <p>Unlike the overload returning a new vector, this lets the caller reuse its vector across
+   * collections. Reservoirs may also reuse the ExemplarData released by their exporters.
+   */
+  virtual void CollectAndReset(const MetricAttributes &pointAttributes,
+                               std::vector<std::shared_ptr<ExemplarData>> &exemplars) noexcept
+  {
+    auto collected = CollectAndReset(pointAttributes);
+    exemplars.insert(exemplars.end(), collected.begin(), collected.end());
+  }
+
   static nostd::shared_ptr<ExemplarReservoir> GetSimpleFixedSizeExemplarReservoir(
       size_t size,
       const std::shared_ptr<ReservoirCellSelector> &reservoir_cell_selector,
@@ -5,10 +5,12 @@
 
 #ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
 
+#  include <atomic>
 #  include <chrono>
 #  include <cstdint>
 #  include <map>
 #  include <memory>
+#  include <thread>
 #  include <utility>
 
 #  include "opentelemetry/common/timestamp.h"
@@ -16,6 +18,7 @@
 #  include "opentelemetry/nostd/variant.h"
 #  include "opentelemetry/sdk/metrics/data/exemplar_data.h"
 #  include "opentelemetry/sdk/metrics/data/metric_data.h"
+#  include "opentelemetry/sdk/metrics/data/point_attributes.h"
 #  include "opentelemetry/sdk/metrics/exemplar/filter_type.h"
 #  include "opentelemetry/trace/context.h"
 #  include "opentelemetry/trace/span_context.h"
@@ -28,12 +31,20 @@ namespace metrics
 {
 /**
  * A Reservoir cell pre-allocated memories for Exemplar data.
+ *
+ * Recording a measurement never blocks: a measurement offered while the cell is being written by
+ * another thread, or collected, is dropped, which only changes which measurement is sampled.
  */
 class ReservoirCell
 {
 public:
   ReservoirCell() = default;
 
+  ReservoirCell(const ReservoirCell &)            = delete;
+  ReservoirCell(ReservoirCell &&)                 = delete;
+  ReservoirCell &operator=(const ReservoirCell &) = delete;
+  ReservoirCell &operator=(ReservoirCell &&)      = delete;
+
   /**
    * Record the long measurement to the cell.
    */
@@ -41,8 +52,13 @@ class ReservoirCell
                              const MetricAttributes &attributes,
                              const opentelemetry::context::Context &context)
   {
+    if (!TryAcquire())
+    {
+      return;
+    }
     value_ = value;
     offerMeasurement(attributes, context);
+    Release();
   }
 
   /**
@@ -52,57 +68,63 @@ class ReservoirCell
                                const MetricAttributes &attributes,
                                const opentelemetry::context::Context &context)
   {
+    if (!TryAcquire())
+    {
+      return;
+    }
     value_ = value;
     offerMeasurement(attributes, context);
+    Release();
   }
 
   /**
-   * Retrieve the cell's {@link ExemplarData}.
+   * Write the cell's {@link ExemplarData} into exemplar, and reset the cell.
    *
    * <p>Must be used in tandem with {@link #recordLongMeasurement(int64_t, Attributes, Context)}.
+   * @return false, leaving exemplar unchanged, if no measurement was recorded.
    */
-  std::shared_ptr<ExemplarData> GetAndResetLong(const MetricAttributes &point_attributes)
+  bool GetAndResetLong(const MetricAttributes &point_attributes, ExemplarData &exemplar)
   {
-    if (!populated_)
-    {
-      return nullptr;
-    }
-    auto attributes = attributes_;
-    PointDataAttributes point_data_attributes;
-    point_data_attributes.attributes = filtered(attributes, point_attributes);
-
-    if (const int64_t *value = nostd::get_if<int64_t>(&value_))
+    Acquire();
+    bool populated = populated_;
+    if (populated)
     {
-      point_data_attributes.point_data = ExemplarData::CreateSumPointData(*value);
+      PointDataAttributes point_data_attributes;
+      point_data_attributes.attributes = GetFilteredAttributes(point_attributes);
+      if (const int64_t *value = nostd::get_if<int64_t>(&value_))
+      {
+        point_data_attributes.point_data = ExemplarData::CreateSumPointData(*value);
+      }
+      exemplar = ExemplarData::Create(context_, record_time_, point_data_attributes);
+      reset();
     }
-    std::shared_ptr<ExemplarData> result{
-        new ExemplarData{ExemplarData::Create(context_, record_time_, point_data_attributes)}};
-    reset();
-    return result;
+    Release();
+    return populated;
   }
 
   /**
-   * Retrieve the cell's {@link ExemplarData}.
+   * Write the cell's {@link ExemplarData} into exemplar, and reset the cell.
    *
    * <p>Must be used in tandem with {@link #recordDoubleMeasurement(double, Attributes, Context)}.
+   * @return false, leaving exemplar unchanged, if no measurement was recorded.
    */
-  std::shared_ptr<ExemplarData> GetAndResetDouble(const MetricAttributes &point_attributes)
+  bool GetAndResetDouble(const MetricAttributes &point_attributes, ExemplarData &exemplar)
   {
-    if (!populated_)
-    {
-      return nullptr;
-    }
-    auto attributes = attributes_;
-    PointDataAttributes point_data_attributes;
-    point_data_attributes.attributes = filtered(attributes, point_attributes);
-    if (const double *value = nostd::get_if<double>(&value_))
+    Acquire();
+    bool populated = populated_;
+    if (populated)
     {
-      point_data_attributes.point_data = ExemplarData::CreateSumPointData(*value);
+      PointDataAttributes point_data_attributes;
+      point_data_attributes.attributes = GetFilteredAttributes(point_attributes);
+      if (const double *value = nostd::get_if<double>(&value_))
+      {
+        point_data_attributes.point_data = ExemplarData::CreateSumPointData(*value);
+      }
+      exemplar = ExemplarData::Create(context_, record_time_, point_data_attributes);
+      reset();
     }
-    std::shared_ptr<ExemplarData> result{
-        new ExemplarData{ExemplarData::Create(context_, record_time_, point_data_attributes)}};
-    reset();
-    return result;
+    Release();
+    return populated;
   }
 
   void reset()
@@ -130,27 +152,65 @@ class ReservoirCell
     return res;
   }
 
+  /**
+   * Returns the filtered attributes of the measurement, reusing the ones of the previous collection
+   * when neither the offered attributes nor the point attributes changed.
+   */
+  const PointAttributes &GetFilteredAttributes(const MetricAttributes &point_attributes)
+  {
+    if (!is_filtered_attributes_valid_ || !(filtered_point_attributes_ == point_attributes))
+    {
+      filtered_attributes_          = filtered(attributes_, point_attributes);
+      filtered_point_attributes_    = point_attributes;
+      is_filtered_attributes_valid_ = true;
+    }
+    return filtered_attributes_;
+  }
+
   void offerMeasurement(const MetricAttributes &attributes,
                         const opentelemetry::context::Context &context)
   {
-    attributes_  = attributes;
+    // The same attributes are usually offered again, keep them and their filtered attributes.
+    if (!(attributes_ == attributes))
+    {
+      attributes_                   = attributes;
+      is_filtered_attributes_valid_ = false;
+    }
     record_time_ = opentelemetry::common::SystemTimestamp(std::chrono::system_clock::now());
     context_     = opentelemetry::trace::GetSpanContext(context);
     populated_   = true;
   }
 
+  bool TryAcquire() noexcept { return !busy_.exchange(true, std::memory_order_acquire); }
+
+  // The collection waits for a recording in progress, which only copies a measurement.
+  void Acquire() noexcept
+  {
+    while (busy_.exchange(true, std::memory_order_acquire))
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  void Release() noexcept { busy_.store(false, std::memory_order_release); }
+
+  // Set while the cell is written or collected, guards the other members.
+  std::atomic<bool> busy_{false};
   // Cell stores either long or double values, but must not store both
   bool populated_                            = false;
   opentelemetry::trace::SpanContext context_ = opentelemetry::trace::SpanContext::GetInvalid();
   nostd::variant<int64_t, double> value_;
   opentelemetry::common::SystemTimestamp record_time_;
   MetricAttributes attributes_;
+  // The filtered attributes of the last collection, and the point attributes they were filtered by
+  bool is_filtered_attributes_valid_ = false;
+  PointAttributes filtered_attributes_;
+  MetricAttributes filtered_point_attributes_;
   // For testing
   friend class ReservoirCellTestPeer;
 };
 
-typedef std::shared_ptr<ExemplarData> (ReservoirCell::*MapAndResetCellType)(
-    const MetricAttributes &);
+typedef bool (ReservoirCell::*MapAndResetCellType)(const MetricAttributes &, ExemplarData &);
 
 }  // namespace metrics
 }  // namespace sdk
@@ -5,6 +5,8 @@
 
 #ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
 
+#  include <atomic>
+#  include <cstddef>
 #  include <memory>
 #  include <vector>
 
@@ -68,7 +70,7 @@ class SimpleFixedSizeExemplarReservoir : public FixedSizeExemplarReservoir
       // https://github.com/open-telemetry/opentelemetry-specification/blob/main/specification/metrics/sdk.md#simplefixedsizeexemplarreservoir
       //
 
-      size_t measurement_num = measurements_seen_++;
+      size_t measurement_num = measurements_seen_.fetch_add(1, std::memory_order_relaxed);
       size_t index           = static_cast<size_t>(-1);
 
       if (measurement_num < size_)
@@ -88,10 +90,10 @@ class SimpleFixedSizeExemplarReservoir : public FixedSizeExemplarReservoir
       return static_cast<int>(index);
     }
 
-    void reset() override {}
+    void reset() override { measurements_seen_.store(0, std::memory_order_relaxed); }
 
   private:
-    size_t measurements_seen_ = 0;
+    std::atomic<size_t> measurements_seen_{0};
     size_t size_;
   };  // class SimpleFixedSizeCellSelector
 
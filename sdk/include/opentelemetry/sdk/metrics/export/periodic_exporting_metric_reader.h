@@ -46,6 +46,8 @@ class PeriodicExportingMetricReader : public MetricReader
   AggregationTemporality GetAggregationTemporality(
       InstrumentType instrument_type) const noexcept override;
 
+  MetricExportStats GetExportStats() const noexcept override;
+
 private:
   bool OnForceFlush(std::chrono::microseconds timeout) noexcept override;
 
@@ -64,6 +66,11 @@ class PeriodicExportingMetricReader : public MetricReader
   std::atomic<bool> is_force_wakeup_background_worker_{false};
   std::atomic<uint64_t> force_flush_pending_sequence_{0};
   std::atomic<uint64_t> force_flush_notified_sequence_{0};
+
+  /* Export statistics */
+  std::atomic<uint64_t> export_count_{0};
+  std::atomic<uint64_t> export_failure_count_{0};
+  std::atomic<uint64_t> export_duration_ns_{0};
   std::condition_variable cv_, force_flush_cv_;
   std::mutex cv_m_, force_flush_m_;
 
@@ -6,15 +6,14 @@
 #include "opentelemetry/nostd/string_view.h"
 #include "opentelemetry/version.h"
 
-#if OPENTELEMETRY_HAVE_WORKING_REGEX
-#  include <regex>
-#endif
-
 OPENTELEMETRY_BEGIN_NAMESPACE
 namespace sdk
 {
 namespace metrics
 {
+/**
+ * Validates the name and unit of the instruments, with a single scan of their characters.
+ */
 class InstrumentMetaDataValidator
 {
 public:
@@ -22,12 +21,6 @@ class InstrumentMetaDataValidator
   bool ValidateName(nostd::string_view name) const;
   bool ValidateUnit(nostd::string_view unit) const;
   bool ValidateDescription(nostd::string_view description) const;
-
-private:
-#if OPENTELEMETRY_HAVE_WORKING_REGEX
-  std::regex name_reg_key_;
-  std::regex unit_reg_key_;
-#endif
 };
 
 }  // namespace metrics
@@ -13,6 +13,7 @@
 #include "opentelemetry/common/macros.h"
 #include "opentelemetry/metrics/meter.h"
 #include "opentelemetry/metrics/noop.h"
+#include "opentelemetry/nostd/function_ref.h"
 #include "opentelemetry/nostd/shared_ptr.h"
 #include "opentelemetry/nostd/string_view.h"
 #include "opentelemetry/nostd/unique_ptr.h"
@@ -132,6 +133,14 @@ class Meter final : public opentelemetry::metrics::Meter
   std::vector<MetricData> Collect(CollectorHandle *collector,
                                   opentelemetry::common::SystemTimestamp collect_ts) noexcept;
 
+  /**
+   * NOTE - INTERNAL method, can change in the future.
+   * Process callback for each metric storage of the meter in thread-safe manner
+   */
+  bool ForEachMetricStorage(
+      nostd::function_ref<bool(const InstrumentDescriptor &, const MetricStorage &)>
+          callback) noexcept;
+
 #if OPENTELEMETRY_ABI_VERSION_NO >= 2
   uintptr_t RegisterCallback(
       opentelemetry::metrics::MultiObservableCallbackPtr callback,
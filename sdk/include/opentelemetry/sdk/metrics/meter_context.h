@@ -16,6 +16,8 @@
 #include "opentelemetry/sdk/metrics/export/metric_filter.h"
 #include "opentelemetry/sdk/metrics/meter_config.h"
 #include "opentelemetry/sdk/metrics/metric_reader.h"
+#include "opentelemetry/sdk/metrics/state/collection_executor.h"
+#include "opentelemetry/sdk/metrics/state/observable_callback_executor.h"
 #include "opentelemetry/sdk/metrics/state/metric_collector.h"
 #include "opentelemetry/sdk/metrics/view/instrument_selector.h"
 #include "opentelemetry/sdk/metrics/view/meter_selector.h"
@@ -120,6 +122,14 @@ class MeterContext : public std::enable_shared_from_this<MeterContext>
    */
   nostd::span<std::shared_ptr<Meter>> GetMeters() noexcept;
 
+  /**
+   * NOTE - INTERNAL method, can change in the future.
+   * Get a snapshot of the configured meters.
+   * This method is thread safe, and does not take the lock held while the meters are collected,
+   * so that the callbacks of observable instruments can iterate the meters.
+   */
+  std::shared_ptr<const std::vector<std::shared_ptr<Meter>>> GetMetersSnapshot() noexcept;
+
   /**
    * Obtain the configured collectors.
    *
@@ -160,6 +170,41 @@ class MeterContext : public std::enable_shared_from_this<MeterContext>
                std::unique_ptr<MeterSelector> meter_selector,
                std::unique_ptr<View> view) noexcept;
 
+  /**
+   * Set the executor used to collect the metric storages of each meter in parallel. Without an
+   * executor, which is the default, the metric storages are collected sequentially on the thread
+   * of the collecting reader.
+   * @param collection_executor The executor, which may be shared with other meter contexts, or
+   * nullptr.
+   *
+   * Note: This method is not thread safe, and should ideally be called from main thread.
+   */
+  void SetCollectionExecutor(std::shared_ptr<CollectionExecutor> collection_executor) noexcept;
+
+  /**
+   * NOTE - INTERNAL method, can change in future.
+   * Obtain the executor used to collect the metric storages, or nullptr.
+   */
+  CollectionExecutor *GetCollectionExecutor() const noexcept;
+
+  /**
+   * Set the executor used to invoke the callbacks of the asynchronous instruments in parallel,
+   * each within a deadline. Without an executor, which is the default, the callbacks are invoked
+   * sequentially on the thread of the collecting reader, and are always waited for.
+   * @param callback_executor The executor, which may be shared with other meter contexts, or
+   * nullptr.
+   *
+   * Note: This method is not thread safe, and should ideally be called from main thread.
+   */
+  void SetObservableCallbackExecutor(
+      std::shared_ptr<ObservableCallbackExecutor> callback_executor) noexcept;
+
+  /**
+   * NOTE - INTERNAL method, can change in future.
+   * Obtain the executor used to invoke the callbacks of the asynchronous instruments, or nullptr.
+   */
+  ObservableCallbackExecutor *GetObservableCallbackExecutor() const noexcept;
+
 #ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
 
   void SetExemplarFilter(ExemplarFilterType exemplar_filter_type) noexcept;
@@ -201,6 +246,10 @@ class MeterContext : public std::enable_shared_from_this<MeterContext>
   opentelemetry::common::SystemTimestamp sdk_start_ts_;
   std::unique_ptr<instrumentationscope::ScopeConfigurator<MeterConfig>> meter_configurator_;
   std::vector<std::shared_ptr<Meter>> meters_;
+  // A copy of meters_, replaced whenever a meter is added or removed.
+  std::shared_ptr<const std::vector<std::shared_ptr<Meter>>> meters_snapshot_;
+  std::shared_ptr<CollectionExecutor> collection_executor_;
+  std::shared_ptr<ObservableCallbackExecutor> callback_executor_;
 
 #ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
   metrics::ExemplarFilterType exemplar_filter_type_;
@@ -214,6 +263,7 @@ class MeterContext : public std::enable_shared_from_this<MeterContext>
 #endif
   std::mutex forceflush_lock_;
   std::mutex meter_lock_;
+  std::mutex meters_snapshot_lock_;
 };
 
 }  // namespace metrics
@@ -15,6 +15,9 @@
 #include "opentelemetry/sdk/metrics/export/metric_filter.h"
 #include "opentelemetry/sdk/metrics/meter_context.h"
 #include "opentelemetry/sdk/metrics/metric_reader.h"
+#include "opentelemetry/sdk/metrics/self_observability.h"
+#include "opentelemetry/sdk/metrics/state/collection_executor.h"
+#include "opentelemetry/sdk/metrics/state/observable_callback_executor.h"
 #include "opentelemetry/sdk/metrics/view/instrument_selector.h"
 #include "opentelemetry/sdk/metrics/view/meter_selector.h"
 #include "opentelemetry/sdk/metrics/view/view.h"
@@ -122,6 +125,31 @@ class OPENTELEMETRY_EXPORT MeterProvider final : public opentelemetry::metrics::
                std::unique_ptr<MeterSelector> meter_selector,
                std::unique_ptr<View> view) noexcept;
 
+  /**
+   * Set the executor used to collect the metric storages of each meter in parallel, or nullptr
+   * to collect them sequentially on the thread of the collecting reader, which is the default.
+   *
+   * Note: This method is not thread safe, and should ideally be called from main thread.
+   */
+  void SetCollectionExecutor(std::shared_ptr<CollectionExecutor> collection_executor) noexcept;
+
+  /**
+   * Set the executor used to invoke the callbacks of the asynchronous instruments in parallel,
+   * each within a deadline, or nullptr to invoke them sequentially on the thread of the
+   * collecting reader, which is the default.
+   *
+   * Note: This method is not thread safe, and should ideally be called from main thread.
+   */
+  void SetObservableCallbackExecutor(
+      std::shared_ptr<ObservableCallbackExecutor> callback_executor) noexcept;
+
+  /**
+   * Record the self-observability metrics of the metrics pipeline of this meter provider, see
+   * MetricsSelfObservability, with the kSelfObservabilityMeterName meter. They are disabled by
+   * default, and enabling them again has no effect.
+   */
+  void EnableSelfObservability() noexcept;
+
 #ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
 
   void SetExemplarFilter(metrics::ExemplarFilterType exemplar_filter_type =
@@ -144,6 +172,8 @@ class OPENTELEMETRY_EXPORT MeterProvider final : public opentelemetry::metrics::
 private:
   std::shared_ptr<MeterContext> context_;
   std::mutex lock_;
+  // Declared after the context, which it observes.
+  std::unique_ptr<MetricsSelfObservability> self_observability_;
 
 #if defined(__cpp_lib_atomic_value_initialization) && \
     __cpp_lib_atomic_value_initialization >= 201911L
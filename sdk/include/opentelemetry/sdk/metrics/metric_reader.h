@@ -6,6 +6,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 
 #include "opentelemetry/nostd/function_ref.h"
 #include "opentelemetry/sdk/metrics/cardinality_limits.h"
@@ -19,6 +20,19 @@ namespace sdk
 namespace metrics
 {
 
+/**
+ * The statistics of the exports of a MetricReader.
+ */
+struct MetricExportStats
+{
+  // Number of exports, including the failed ones.
+  uint64_t export_count = 0;
+  // Number of exports which did not succeed.
+  uint64_t failure_count = 0;
+  // Total duration of the exports.
+  std::chrono::nanoseconds export_duration{0};
+};
+
 /**
  * MetricReader defines the interface to collect metrics from SDK
  */
@@ -84,6 +98,12 @@ class MetricReader
    */
   bool IsShutdown() const noexcept;
 
+  /**
+   * Return the statistics of the exports of the reader. A reader which does not export the
+   * metrics it collects returns empty statistics.
+   */
+  virtual MetricExportStats GetExportStats() const noexcept { return {}; }
+
   virtual ~MetricReader() = default;
 
 private:
@@ -0,0 +1,115 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+
+#include "opentelemetry/metrics/async_instruments.h"
+#include "opentelemetry/metrics/meter.h"
+#include "opentelemetry/metrics/observer_result.h"
+#include "opentelemetry/nostd/function_ref.h"
+#include "opentelemetry/nostd/shared_ptr.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace instrumentationscope
+{
+class InstrumentationScope;
+}  // namespace instrumentationscope
+
+namespace metrics
+{
+
+class MeterContext;
+class MetricCollector;
+class MetricStorage;
+struct InstrumentDescriptor;
+
+/** The name of the meter recording the self-observability metrics. */
+constexpr char kSelfObservabilityMeterName[] = "opentelemetry-cpp/sdk/metrics";
+
+/**
+ * The built-in instruments observing the metrics pipeline of a MeterContext:
+ *
+ * - otel.sdk.metric.storage.series: the number of series built by the last collection of each
+ *   metric storage.
+ * - otel.sdk.metric.storage.overflow: the number of measurements routed to the overflow series of
+ *   each metric storage because its cardinality limit was reached.
+ * - otel.sdk.metric.storage.memory: an estimate of the memory held by the attribute sets and
+ *   aggregations of each metric storage.
+ * - otel.sdk.metric_reader.collection.count and otel.sdk.metric_reader.collection.duration: the
+ *   number and total duration of the collections of each reader.
+ * - otel.sdk.metric_reader.export.count, otel.sdk.metric_reader.export.failed and
+ *   otel.sdk.metric_reader.export.duration: the number of exports of each reader, the number of
+ *   them which failed, and their total duration.
+ *
+ * The storage metrics are identified by the otel.scope.name and otel.metric.name attributes, and
+ * the reader metrics by the otel.component.name attribute, "metric_reader/<index>".
+ *
+ * The values are maintained by the pipeline with relaxed atomic counters, and only read by the
+ * callbacks of asynchronous instruments, so that recording measurements does not pay for them.
+ * The instruments are created on the given meter of the observed context, and are collected and
+ * exported like any other metric.
+ */
+class MetricsSelfObservability
+{
+public:
+  /**
+   * Create the self-observability instruments.
+   * @param context The observed meter context, which must outlive this object.
+   * @param meter The meter of the observed context used to create the instruments.
+   */
+  MetricsSelfObservability(MeterContext *context, opentelemetry::metrics::Meter &meter) noexcept;
+
+  MetricsSelfObservability(const MetricsSelfObservability &)            = delete;
+  MetricsSelfObservability(MetricsSelfObservability &&)                 = delete;
+  MetricsSelfObservability &operator=(const MetricsSelfObservability &) = delete;
+  MetricsSelfObservability &operator=(MetricsSelfObservability &&)      = delete;
+
+  // Destroying the instruments removes their callbacks.
+  ~MetricsSelfObservability() = default;
+
+private:
+  static void ObserveStorageSeries(opentelemetry::metrics::ObserverResult result,
+                                   void *state) noexcept;
+  static void ObserveStorageOverflow(opentelemetry::metrics::ObserverResult result,
+                                     void *state) noexcept;
+  static void ObserveStorageMemory(opentelemetry::metrics::ObserverResult result,
+                                   void *state) noexcept;
+  static void ObserveCollectionCount(opentelemetry::metrics::ObserverResult result,
+                                     void *state) noexcept;
+  static void ObserveCollectionDuration(opentelemetry::metrics::ObserverResult result,
+                                        void *state) noexcept;
+  static void ObserveExportCount(opentelemetry::metrics::ObserverResult result,
+                                 void *state) noexcept;
+  static void ObserveExportFailed(opentelemetry::metrics::ObserverResult result,
+                                  void *state) noexcept;
+  static void ObserveExportDuration(opentelemetry::metrics::ObserverResult result,
+                                    void *state) noexcept;
+
+  // The callbacks are invoked while the observed context collects its meters, which holds the
+  // lock of its meters: they iterate a snapshot of the meters instead.
+  void ForEachMetricStorage(
+      nostd::function_ref<void(const instrumentationscope::InstrumentationScope &,
+                               const InstrumentDescriptor &,
+                               const MetricStorage &)> callback) const noexcept;
+  void ForEachCollector(
+      nostd::function_ref<void(size_t index, const MetricCollector &)> callback) const noexcept;
+
+  MeterContext *context_;
+  nostd::shared_ptr<opentelemetry::metrics::ObservableInstrument> storage_series_;
+  nostd::shared_ptr<opentelemetry::metrics::ObservableInstrument> storage_overflow_;
+  nostd::shared_ptr<opentelemetry::metrics::ObservableInstrument> storage_memory_;
+  nostd::shared_ptr<opentelemetry::metrics::ObservableInstrument> collection_count_;
+  nostd::shared_ptr<opentelemetry::metrics::ObservableInstrument> collection_duration_;
+  nostd::shared_ptr<opentelemetry::metrics::ObservableInstrument> export_count_;
+  nostd::shared_ptr<opentelemetry::metrics::ObservableInstrument> export_failed_;
+  nostd::shared_ptr<opentelemetry::metrics::ObservableInstrument> export_duration_;
+};
+
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
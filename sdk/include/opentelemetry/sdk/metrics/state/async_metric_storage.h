@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -134,6 +136,13 @@ class AsyncMetricStorage : public MetricStorage, public AsyncWritableMetricStora
       delta_metrics = std::move(delta_hash_map_);
       delta_hash_map_ =
           std::make_unique<AttributesHashMap>(aggregation_config_->cardinality_limit_);
+      // The last observed values of the attribute sets which are not observed anymore are evicted
+      // along with their cumulative metrics, once per collection round.
+      if (aggregation_config_->max_stale_collections_ && collectors.size() > 0 &&
+          collectors[0].get() == collector)
+      {
+        cumulative_hash_map_->EvictStale(aggregation_config_->max_stale_collections_);
+      }
     }
 
     auto status =
@@ -142,13 +151,32 @@ class AsyncMetricStorage : public MetricStorage, public AsyncWritableMetricStora
     return status;
   }
 
+  size_t GetMemoryUsage() const noexcept override
+  {
+    size_t usage = temporal_metric_storage_.GetMemoryUsage();
+    std::lock_guard<opentelemetry::common::SpinLockMutex> guard(hashmap_lock_);
+    return usage + cumulative_hash_map_->MemoryUsage() + delta_hash_map_->MemoryUsage();
+  }
+
+  size_t GetSeriesCount() const noexcept override
+  {
+    return temporal_metric_storage_.GetSeriesCount();
+  }
+
+  uint64_t GetOverflowCount() const noexcept override
+  {
+    // Each observation is recorded in both hashes: only count the overflows of one of them.
+    std::lock_guard<opentelemetry::common::SpinLockMutex> guard(hashmap_lock_);
+    return cumulative_hash_map_->OverflowCount();
+  }
+
 private:
   InstrumentDescriptor instrument_descriptor_;
   AggregationType aggregation_type_;
   const AggregationConfig *aggregation_config_;
   std::unique_ptr<AttributesHashMap> cumulative_hash_map_;
   std::unique_ptr<AttributesHashMap> delta_hash_map_;
-  opentelemetry::common::SpinLockMutex hashmap_lock_;
+  mutable opentelemetry::common::SpinLockMutex hashmap_lock_;
 #ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
   ExemplarFilterType exemplar_filter_type_;
   nostd::shared_ptr<ExemplarReservoir> exemplar_reservoir_;
@@ -3,14 +3,19 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "opentelemetry/common/timestamp.h"
 #include "opentelemetry/nostd/function_ref.h"
+#include "opentelemetry/nostd/variant.h"
 #include "opentelemetry/sdk/common/attribute_utils.h"
 #include "opentelemetry/sdk/common/attributemap_hash.h"
 #include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
@@ -47,6 +52,22 @@ class AttributeHashGenerator
   }
 };
 
+/**
+ * Hash of attribute sets to their aggregation.
+ *
+ * Attribute sets and aggregations are stored densely in insertion order, and looked up through an
+ * open addressing (linear probing) index holding the hash of each attribute set. A lookup scans a
+ * contiguous array of hashes, and only compares attribute sets whose hash matches, which avoids
+ * the node allocation and pointer chasing of a node based hash map.
+ *
+ * Entries can be retained across collection intervals (see Reset() and CollectInto()): a retained
+ * entry keeps its attributes and a reset aggregation, but is ignored by lookups and iteration
+ * until it is recorded to again, so that recording to it does not allocate.
+ *
+ * The attribute sets are immutable and reference counted. They are shared, rather than copied,
+ * with the hashes they are collected or merged into, and with the collected points (see
+ * GetAllSharedEntries()).
+ */
 template <typename CustomHash = MetricAttributesHash>
 class AttributesHashMapWithCustomHash
 {
@@ -56,27 +77,67 @@ class AttributesHashMapWithCustomHash
   {
     if (attributes_limit_ > kAggregationCardinalityLimit)
     {
-      hash_map_.reserve(attributes_limit_);
+      Reserve(attributes_limit_);
     }
   }
 
   Aggregation *Get(const MetricAttributes &attributes) const
   {
-    auto it = hash_map_.find(attributes);
-    if (it != hash_map_.end())
+    size_t entry = Find(CustomHash()(attributes), attributes);
+    if (entry != kNoEntry && entries_[entry].active)
     {
-      return it->second.get();
+      return entries_[entry].aggregation.get();
     }
     return nullptr;
   }
 
+  /**
+   * @return the aggregation of the attributes with the given hash for which the equal predicate
+   * returns true, or nullptr. This allows looking up attributes which are not stored as
+   * MetricAttributes, provided that the hash matches CustomHash.
+   */
+  Aggregation *Get(size_t hash, nostd::function_ref<bool(const MetricAttributes &)> equal) const
+  {
+    size_t entry = FindIf(hash, equal);
+    if (entry != kNoEntry && entries_[entry].active)
+    {
+      return entries_[entry].aggregation.get();
+    }
+    return nullptr;
+  }
+
+  /**
+   * Same as Get(hash, equal), but an entry retained from a previous collection interval is also
+   * returned, and made active again, when activate returns true.
+   */
+  Aggregation *GetOrActivate(size_t hash,
+                             nostd::function_ref<bool(const MetricAttributes &)> equal,
+                             nostd::function_ref<bool()> activate)
+  {
+    size_t entry = FindIf(hash, equal);
+    if (entry == kNoEntry)
+    {
+      return nullptr;
+    }
+    if (!entries_[entry].active)
+    {
+      if (!activate())
+      {
+        return nullptr;
+      }
+      Activate(entry);
+    }
+    return entries_[entry].aggregation.get();
+  }
+
   /**
    * @return check if key is present in hash
    *
    */
   bool Has(const MetricAttributes &attributes) const
   {
-    return hash_map_.find(attributes) != hash_map_.end();
+    size_t entry = Find(CustomHash()(attributes), attributes);
+    return entry != kNoEntry && entries_[entry].active;
   }
 
   /**
@@ -88,74 +149,227 @@ class AttributesHashMapWithCustomHash
       const MetricAttributes &attributes,
       nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback)
   {
-    auto it = hash_map_.find(attributes);
-    if (it != hash_map_.end())
-    {
-      return it->second.get();
-    }
-
-    if (IsOverflowAttributes(attributes))
-    {
-      return GetOrSetOveflowAttributes(aggregation_callback);
-    }
-
-    hash_map_[attributes] = aggregation_callback();
-    return hash_map_[attributes].get();
+    return GetOrSetDefaultImpl(attributes, aggregation_callback);
   }
 
   Aggregation *GetOrSetDefault(
       MetricAttributes &&attributes,
       nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback)
   {
-    auto it = hash_map_.find(attributes);
-    if (it != hash_map_.end())
-    {
-      return it->second.get();
-    }
+    return GetOrSetDefaultImpl(std::move(attributes), aggregation_callback);
+  }
 
-    if (IsOverflowAttributes(attributes))
-    {
-      return GetOrSetOveflowAttributes(aggregation_callback);
-    }
+  Aggregation *GetOrSetDefault(
+      const std::shared_ptr<const MetricAttributes> &attributes,
+      nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback)
+  {
+    return GetOrSetDefaultImpl(attributes, aggregation_callback);
+  }
+
+  /**
+   * Same as GetOrSetDefault(), for attributes whose hash was already computed by the caller.
+   */
+  Aggregation *GetOrSetDefault(
+      size_t hash,
+      const MetricAttributes &attributes,
+      nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback)
+  {
+    return GetOrSetDefaultImpl(hash, attributes, aggregation_callback);
+  }
 
-    auto result = hash_map_.emplace(std::move(attributes), aggregation_callback());
-    return result.first->second.get();
+  Aggregation *GetOrSetDefault(
+      size_t hash,
+      MetricAttributes &&attributes,
+      nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback)
+  {
+    return GetOrSetDefaultImpl(hash, std::move(attributes), aggregation_callback);
   }
+
   /**
    * Set the value for given key, overwriting the value if already present
    */
   void Set(const MetricAttributes &attributes, std::unique_ptr<Aggregation> aggr)
   {
-    auto it = hash_map_.find(attributes);
-    if (it != hash_map_.end())
-    {
-      it->second = std::move(aggr);
-    }
-    else if (IsOverflowAttributes(attributes))
-    {
-      hash_map_[GetOverflowAttributes()] = std::move(aggr);
-    }
-    else
+    SetImpl(attributes, std::move(aggr), true);
+  }
+
+  void Set(MetricAttributes &&attributes, std::unique_ptr<Aggregation> aggr)
+  {
+    SetImpl(std::move(attributes), std::move(aggr), true);
+  }
+
+  void Set(const std::shared_ptr<const MetricAttributes> &attributes,
+           std::unique_ptr<Aggregation> aggr)
+  {
+    SetImpl(attributes, std::move(aggr), true);
+  }
+
+  /**
+   * Merge delta into the aggregation of the attributes, in place when the aggregation supports it.
+   * The aggregation is created with aggregation_callback when the attributes are not present. Used
+   * when collecting: unlike GetOrSetDefault() and Set(), an attribute set routed to the overflow
+   * entry is not counted in OverflowCount(), as it was counted when it was recorded.
+   */
+  void Merge(const MetricAttributes &attributes,
+             const Aggregation &delta,
+             nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback)
+  {
+    MergeImpl(attributes, delta, aggregation_callback);
+  }
+
+  void Merge(MetricAttributes &&attributes,
+             const Aggregation &delta,
+             nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback)
+  {
+    MergeImpl(std::move(attributes), delta, aggregation_callback);
+  }
+
+  void Merge(const std::shared_ptr<const MetricAttributes> &attributes,
+             const Aggregation &delta,
+             nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback)
+  {
+    MergeImpl(attributes, delta, aggregation_callback);
+  }
+
+  /**
+   * Move all the entries of other into this hash. Aggregations of attributes present in both
+   * hashes are merged. The attribute sets routed to the overflow entry are not counted in
+   * OverflowCount().
+   */
+  void MergeFrom(AttributesHashMapWithCustomHash &&other)
+  {
+    for (auto &other_entry : other.entries_)
     {
-      hash_map_[attributes] = std::move(aggr);
+      if (!other_entry.active)
+      {
+        continue;
+      }
+      size_t entry = Find(other_entry.hash, *other_entry.attributes);
+      if (entry != kNoEntry && entries_[entry].active)
+      {
+        MergeAggregation(entries_[entry].aggregation, *other_entry.aggregation);
+      }
+      else
+      {
+        SetImpl(std::move(other_entry.attributes), std::move(other_entry.aggregation), false);
+      }
     }
+    other.Clear();
   }
 
-  void Set(MetricAttributes &&attributes, std::unique_ptr<Aggregation> aggr)
+  /**
+   * Move the aggregations of the active entries into target, and deactivate the entries. Each
+   * entry is given in exchange the reset aggregation of a retained target entry, so that the
+   * entries of both hashes are reused across collection intervals without allocating. Entries
+   * are removed once they were not recorded to for max_idle_collections consecutive collections.
+   *
+   * @return the number of non overflow attribute sets moved to target.
+   */
+  size_t CollectInto(AttributesHashMapWithCustomHash &target,
+                     size_t max_idle_collections,
+                     nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback)
   {
-    auto it = hash_map_.find(attributes);
-    if (it != hash_map_.end())
+    size_t collected = 0;
+    for (auto &entry : entries_)
     {
-      it->second = std::move(aggr);
+      if (!entry.active)
+      {
+        entry.idle_collections++;
+        continue;
+      }
+      size_t target_entry = target.Find(entry.hash, *entry.attributes);
+      if (target_entry == kNoEntry)
+      {
+        target.Insert(entry.hash, entry.attributes, std::move(entry.aggregation));
+        entry.aggregation = aggregation_callback();
+      }
+      else if (!target.entries_[target_entry].active)
+      {
+        target.Activate(target_entry);
+        std::swap(target.entries_[target_entry].aggregation, entry.aggregation);
+      }
+      else
+      {
+        // Only the overflow attributes may already be active in target, when collecting several
+        // hashes into the same target.
+        MergeAggregation(target.entries_[target_entry].aggregation, *entry.aggregation);
+        ResetAggregation(entry.aggregation, aggregation_callback);
+      }
+      if (!(*entry.attributes == GetOverflowAttributes()))
+      {
+        collected++;
+      }
+      entry.active           = false;
+      entry.idle_collections = 0;
     }
-    else if (IsOverflowAttributes(attributes))
+    active_size_  = 0;
+    has_overflow_ = false;
+    Evict(max_idle_collections);
+    return collected;
+  }
+
+  /**
+   * Deactivate all the entries and reset their aggregation, for them to be reused in the next
+   * collection interval. Entries are removed once they were not recorded to for
+   * max_idle_collections consecutive collections.
+   */
+  void Reset(size_t max_idle_collections,
+             nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback)
+  {
+    for (auto &entry : entries_)
     {
-      hash_map_[GetOverflowAttributes()] = std::move(aggr);
+      if (entry.active)
+      {
+        ResetAggregation(entry.aggregation, aggregation_callback);
+        entry.active           = false;
+        entry.idle_collections = 0;
+      }
+      else
+      {
+        entry.idle_collections++;
+      }
     }
-    else
+    active_size_  = 0;
+    has_overflow_ = false;
+    Evict(max_idle_collections);
+  }
+
+  /**
+   * Remove the active entries which were not updated by GetOrSetDefault() or Set() during the
+   * last max_stale_collections calls, for hashes whose entries are never deactivated, such as the
+   * cumulative metrics. It is called once per collection, after the updates of the collection.
+   *
+   * @return the number of removed entries.
+   */
+  size_t EvictStale(size_t max_stale_collections)
+  {
+    size_t evicted = EraseIf([&](Entry &entry) {
+      if (!entry.active || ++entry.idle_collections <= max_stale_collections)
+      {
+        return false;
+      }
+      if (*entry.attributes == GetOverflowAttributes())
+      {
+        has_overflow_ = false;
+      }
+      return true;
+    });
+    active_size_ -= evicted;
+    return evicted;
+  }
+
+  /**
+   * @return an estimate of the memory used by the hash in bytes, including its attribute sets
+   * and aggregations. Attribute sets shared with other hashes are counted by each of them.
+   */
+  size_t MemoryUsage() const
+  {
+    size_t usage = entries_.capacity() * sizeof(Entry) + slots_.capacity() * sizeof(Slot);
+    for (auto &entry : entries_)
     {
-      hash_map_[std::move(attributes)] = std::move(aggr);
+      usage += AttributesMemoryUsage(*entry.attributes) + entry.aggregation->GetMemoryUsage();
     }
+    return usage;
   }
 
   /**
@@ -164,9 +378,13 @@ class AttributesHashMapWithCustomHash
   bool GetAllEntries(
       nostd::function_ref<bool(const MetricAttributes &, Aggregation &)> callback) const
   {
-    for (auto &kv : hash_map_)
+    for (auto &entry : entries_)
     {
-      if (!callback(kv.first, *(kv.second.get())))
+      if (!entry.active)
+      {
+        continue;
+      }
+      if (!callback(*entry.attributes, *(entry.aggregation.get())))
       {
         return false;  // callback is not prepared to consume data
       }
@@ -174,40 +392,495 @@ class AttributesHashMapWithCustomHash
     return true;
   }
 
+  /**
+   * Same as GetAllEntries(), yielding the attribute sets shared with the hash, for them to be
+   * referenced without being copied.
+   */
+  bool GetAllSharedEntries(
+      nostd::function_ref<bool(const std::shared_ptr<const MetricAttributes> &, Aggregation &)>
+          callback) const
+  {
+    for (auto &entry : entries_)
+    {
+      if (!entry.active)
+      {
+        continue;
+      }
+      if (!callback(entry.attributes, *(entry.aggregation.get())))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Same as GetAllSharedEntries(), also yielding the start timestamp of each entry (see
+   * SetStartTimestamp()).
+   */
+  bool GetAllSharedEntriesWithStart(
+      nostd::function_ref<bool(const std::shared_ptr<const MetricAttributes> &,
+                               opentelemetry::common::SystemTimestamp,
+                               Aggregation &)> callback) const
+  {
+    for (auto &entry : entries_)
+    {
+      if (!entry.active)
+      {
+        continue;
+      }
+      if (!callback(entry.attributes, entry.start_ts, *(entry.aggregation.get())))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Set the start timestamp stored with the entries inserted from now on, for hashes whose
+   * entries start at different times. It is zero by default.
+   */
+  void SetStartTimestamp(opentelemetry::common::SystemTimestamp start_ts) noexcept
+  {
+    start_ts_ = start_ts;
+  }
+
   /**
    * Return the size of hash.
    */
-  size_t Size() { return hash_map_.size(); }
+  size_t Size() { return active_size_; }
+
+  /**
+   * @return the number of new attribute sets given to GetOrSetDefault() or Set() that were routed
+   * to the overflow entry because the cardinality limit was reached.
+   */
+  uint64_t OverflowCount() const noexcept { return overflow_count_; }
 
 #ifdef UNIT_TESTING
-  size_t BucketCount() { return hash_map_.bucket_count(); }
-  size_t BucketSize(size_t n) { return hash_map_.bucket_size(n); }
+  size_t BucketCount() { return slots_.size(); }
+  size_t RetainedSize() { return entries_.size(); }
+  size_t BucketSize(size_t n)
+  {
+    size_t size = 0;
+    for (auto &entry : entries_)
+    {
+      if (SlotIndex(entry.hash) == n)
+      {
+        size++;
+      }
+    }
+    return size;
+  }
 #endif
 
 private:
-  std::unordered_map<MetricAttributes, std::unique_ptr<Aggregation>, CustomHash> hash_map_;
+  struct Entry
+  {
+    Entry(size_t hash_arg,
+          std::shared_ptr<const MetricAttributes> &&attributes_arg,
+          std::unique_ptr<Aggregation> &&aggr)
+        : hash(hash_arg), attributes(std::move(attributes_arg)), aggregation(std::move(aggr))
+    {}
+
+    size_t hash;
+    std::shared_ptr<const MetricAttributes> attributes;
+    std::unique_ptr<Aggregation> aggregation;
+    // Whether the entry was recorded to in the current collection interval.
+    bool active = true;
+    // Number of consecutive collections the entry was retained without being recorded to. For an
+    // active entry, number of EvictStale() calls since it was last updated.
+    uint32_t idle_collections = 0;
+    // The start timestamp of the hash when the entry was inserted.
+    opentelemetry::common::SystemTimestamp start_ts;
+  };
+
+  struct Slot
+  {
+    size_t hash;
+    size_t entry;
+  };
+
+  static constexpr size_t kNoEntry        = (std::numeric_limits<size_t>::max)();
+  static constexpr unsigned kMinSlotShift = 4;
+
+  std::vector<Entry> entries_;
+  std::vector<Slot> slots_;
+  // Number of hash bits used to index slots_, which has a power of 2 size.
+  unsigned slot_bits_ = 0;
   size_t attributes_limit_;
+  // Number of active entries, and whether the overflow attributes are one of them.
+  size_t active_size_      = 0;
+  bool has_overflow_       = false;
+  uint64_t overflow_count_ = 0;
+  opentelemetry::common::SystemTimestamp start_ts_;
+
+  // Fibonacci hashing: spreads the attribute hash over the slots using its high bits, so that
+  // hashes sharing low bits (for example in a ShardedAttributesHashMap shard) do not collide.
+  size_t SlotIndex(size_t hash) const
+  {
+    return static_cast<size_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >>
+                               (64 - slot_bits_));
+  }
+
+  size_t Find(size_t hash, const MetricAttributes &attributes) const
+  {
+    return FindIf(hash, [&attributes](const MetricAttributes &entry_attributes) {
+      return entry_attributes == attributes;
+    });
+  }
+
+  template <class EqualT>
+  size_t FindIf(size_t hash, const EqualT &equal) const
+  {
+    if (slots_.empty())
+    {
+      return kNoEntry;
+    }
+    const size_t mask = slots_.size() - 1;
+    for (size_t i = SlotIndex(hash);; i = (i + 1) & mask)
+    {
+      const Slot &slot = slots_[i];
+      if (slot.entry == kNoEntry)
+      {
+        return kNoEntry;
+      }
+      if (slot.hash == hash && equal(*entries_[slot.entry].attributes))
+      {
+        return slot.entry;
+      }
+    }
+  }
+
+  void InsertSlot(size_t hash, size_t entry)
+  {
+    const size_t mask = slots_.size() - 1;
+    size_t i          = SlotIndex(hash);
+    while (slots_[i].entry != kNoEntry)
+    {
+      i = (i + 1) & mask;
+    }
+    slots_[i] = Slot{hash, entry};
+  }
+
+  void Reserve(size_t size)
+  {
+    // Keep the load factor of the slots at or below 3/4.
+    unsigned bits = kMinSlotShift;
+    while ((size_t{1} << bits) * 3 < size * 4)
+    {
+      bits++;
+    }
+    if (bits <= slot_bits_)
+    {
+      return;
+    }
+    slot_bits_ = bits;
+    slots_.assign(size_t{1} << bits, Slot{0, kNoEntry});
+    for (size_t i = 0; i < entries_.size(); i++)
+    {
+      InsertSlot(entries_[i].hash, i);
+    }
+    entries_.reserve(size);
+  }
+
+  template <class AttributesT>
+  Aggregation *Insert(size_t hash, AttributesT &&attributes, std::unique_ptr<Aggregation> aggr)
+  {
+    if (slots_.empty() || (entries_.size() + 1) * 4 > slots_.size() * 3)
+    {
+      Reserve((std::max)(entries_.size() * 2, size_t{1} << kMinSlotShift));
+    }
+    if (Deref(attributes) == GetOverflowAttributes())
+    {
+      has_overflow_ = true;
+    }
+    InsertSlot(hash, entries_.size());
+    entries_.emplace_back(hash, Share(std::forward<AttributesT>(attributes)), std::move(aggr));
+    entries_.back().start_ts = start_ts_;
+    active_size_++;
+    return entries_.back().aggregation.get();
+  }
+
+  void Activate(size_t entry)
+  {
+    if (*entries_[entry].attributes == GetOverflowAttributes())
+    {
+      has_overflow_ = true;
+    }
+    entries_[entry].active           = true;
+    entries_[entry].idle_collections = 0;
+    active_size_++;
+  }
+
+  static const MetricAttributes &Deref(const MetricAttributes &attributes) { return attributes; }
+
+  static const MetricAttributes &Deref(const std::shared_ptr<const MetricAttributes> &attributes)
+  {
+    return *attributes;
+  }
+
+  static std::shared_ptr<const MetricAttributes> Share(const MetricAttributes &attributes)
+  {
+    return std::make_shared<const MetricAttributes>(attributes);
+  }
+
+  static std::shared_ptr<const MetricAttributes> Share(MetricAttributes &&attributes)
+  {
+    return std::make_shared<const MetricAttributes>(std::move(attributes));
+  }
+
+  static std::shared_ptr<const MetricAttributes> Share(
+      const std::shared_ptr<const MetricAttributes> &attributes)
+  {
+    return attributes;
+  }
+
+  static size_t AttributesMemoryUsage(const MetricAttributes &attributes)
+  {
+    // The map nodes hold the key, the value and the links of a red-black tree.
+    size_t usage = sizeof(MetricAttributes) +
+                   attributes.size() * (sizeof(MetricAttributes::value_type) + 4 * sizeof(void *));
+    for (auto &kv : attributes)
+    {
+      usage += kv.first.capacity();
+      if (nostd::holds_alternative<std::string>(kv.second))
+      {
+        usage += nostd::get<std::string>(kv.second).capacity();
+      }
+    }
+    return usage;
+  }
+
+  static void MergeAggregation(std::unique_ptr<Aggregation> &aggregation, const Aggregation &delta)
+  {
+    if (!aggregation->MergeFrom(delta))
+    {
+      aggregation = aggregation->Merge(delta);
+    }
+  }
+
+  static void ResetAggregation(
+      std::unique_ptr<Aggregation> &aggregation,
+      nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback)
+  {
+    if (!aggregation->Reset())
+    {
+      aggregation = aggregation_callback();
+    }
+  }
+
+  // Remove the inactive entries idle for max_idle_collections.
+  void Evict(size_t max_idle_collections)
+  {
+    EraseIf([&](const Entry &entry) {
+      return !entry.active && entry.idle_collections >= max_idle_collections;
+    });
+  }
+
+  // Remove the entries for which pred returns true, keeping the insertion order of the others.
+  // The slots of the removed entries are deleted, and those of the entries moved down are
+  // updated, so that the cost depends on the number of moved entries rather than on the number
+  // of slots.
+  //
+  // @return the number of removed entries.
+  template <class PredicateT>
+  size_t EraseIf(const PredicateT &pred)
+  {
+    size_t kept = 0;
+    for (size_t i = 0; i < entries_.size(); i++)
+    {
+      if (pred(entries_[i]))
+      {
+        EraseSlot(FindSlot(entries_[i].hash, i));
+        continue;
+      }
+      if (kept != i)
+      {
+        slots_[FindSlot(entries_[i].hash, i)].entry = kept;
+        entries_[kept]                              = std::move(entries_[i]);
+      }
+      kept++;
+    }
+    const size_t erased = entries_.size() - kept;
+    entries_.erase(entries_.begin() + static_cast<std::ptrdiff_t>(kept), entries_.end());
+    return erased;
+  }
+
+  // @return the index of the slot of the given entry, which must exist.
+  size_t FindSlot(size_t hash, size_t entry) const
+  {
+    const size_t mask = slots_.size() - 1;
+    size_t i          = SlotIndex(hash);
+    while (slots_[i].entry != entry)
+    {
+      i = (i + 1) & mask;
+    }
+    return i;
+  }
+
+  // Delete a slot by shifting back the slots of its probe sequence (backward shift deletion), so
+  // that lookups never need tombstones.
+  void EraseSlot(size_t hole)
+  {
+    const size_t mask = slots_.size() - 1;
+    for (size_t i = (hole + 1) & mask; slots_[i].entry != kNoEntry; i = (i + 1) & mask)
+    {
+      // The slot can fill the hole if the hole lies between its home slot and its current one.
+      const size_t home = SlotIndex(slots_[i].hash);
+      if (((i - home) & mask) >= ((i - hole) & mask))
+      {
+        slots_[hole] = slots_[i];
+        hole         = i;
+      }
+    }
+    slots_[hole] = Slot{0, kNoEntry};
+  }
+
+  void Clear()
+  {
+    entries_.clear();
+    slots_.clear();
+    slot_bits_    = 0;
+    active_size_  = 0;
+    has_overflow_ = false;
+  }
+
+  template <class AttributesT>
+  Aggregation *GetOrSetDefaultImpl(
+      AttributesT &&attributes,
+      nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback)
+  {
+    const size_t hash = CustomHash()(Deref(attributes));
+    return GetOrSetDefaultImpl(hash, std::forward<AttributesT>(attributes), aggregation_callback);
+  }
+
+  template <class AttributesT>
+  Aggregation *GetOrSetDefaultImpl(
+      size_t hash,
+      AttributesT &&attributes,
+      nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback)
+  {
+    size_t entry = Find(hash, Deref(attributes));
+    if (entry != kNoEntry && entries_[entry].active)
+    {
+      entries_[entry].idle_collections = 0;
+      return entries_[entry].aggregation.get();
+    }
+
+    if (IsOverflowAttributes(Deref(attributes), true))
+    {
+      return GetOrSetOveflowAttributes(aggregation_callback);
+    }
+
+    if (entry != kNoEntry)
+    {
+      Activate(entry);
+      return entries_[entry].aggregation.get();
+    }
+
+    return Insert(hash, std::forward<AttributesT>(attributes), aggregation_callback());
+  }
+
+  template <class AttributesT>
+  void SetImpl(AttributesT &&attributes, std::unique_ptr<Aggregation> aggr, bool record)
+  {
+    const size_t hash = CustomHash()(Deref(attributes));
+    size_t entry      = Find(hash, Deref(attributes));
+    if (entry != kNoEntry && entries_[entry].active)
+    {
+      entries_[entry].aggregation      = std::move(aggr);
+      entries_[entry].idle_collections = 0;
+    }
+    else if (IsOverflowAttributes(Deref(attributes), record))
+    {
+      const MetricAttributes &overflow = GetOverflowAttributes();
+      const size_t overflow_hash       = CustomHash()(overflow);
+      entry                            = Find(overflow_hash, overflow);
+      if (entry != kNoEntry && entries_[entry].active)
+      {
+        // The overflow entry accumulates all the attribute sets routed to it.
+        MergeAggregation(entries_[entry].aggregation, *aggr);
+        entries_[entry].idle_collections = 0;
+      }
+      else if (entry != kNoEntry)
+      {
+        Activate(entry);
+        entries_[entry].aggregation = std::move(aggr);
+      }
+      else
+      {
+        Insert(overflow_hash, overflow, std::move(aggr));
+      }
+    }
+    else if (entry != kNoEntry)
+    {
+      Activate(entry);
+      entries_[entry].aggregation = std::move(aggr);
+    }
+    else
+    {
+      Insert(hash, std::forward<AttributesT>(attributes), std::move(aggr));
+    }
+  }
+
+  template <class AttributesT>
+  void MergeImpl(AttributesT &&attributes,
+                 const Aggregation &delta,
+                 nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback)
+  {
+    const size_t hash = CustomHash()(Deref(attributes));
+    size_t entry      = Find(hash, Deref(attributes));
+    if (entry != kNoEntry && entries_[entry].active)
+    {
+      entries_[entry].idle_collections = 0;
+    }
+    else if (IsOverflowAttributes(Deref(attributes), false))
+    {
+      entry = GetOrSetOverflowEntry(aggregation_callback);
+    }
+    else if (entry != kNoEntry)
+    {
+      Activate(entry);
+    }
+    else
+    {
+      Insert(hash, std::forward<AttributesT>(attributes), aggregation_callback());
+      entry = entries_.size() - 1;
+    }
+    MergeAggregation(entries_[entry].aggregation, delta);
+  }
 
   Aggregation *GetOrSetOveflowAttributes(
       nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback)
   {
-    auto agg = aggregation_callback();
-    return GetOrSetOveflowAttributes(std::move(agg));
+    return entries_[GetOrSetOverflowEntry(aggregation_callback)].aggregation.get();
   }
 
-  Aggregation *GetOrSetOveflowAttributes(std::unique_ptr<Aggregation> agg)
+  // @return the index of the overflow entry, which is created or activated if needed.
+  size_t GetOrSetOverflowEntry(
+      nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback)
   {
-    auto it = hash_map_.find(GetOverflowAttributes());
-    if (it != hash_map_.end())
+    const MetricAttributes &overflow = GetOverflowAttributes();
+    const size_t overflow_hash       = CustomHash()(overflow);
+    size_t entry                     = Find(overflow_hash, overflow);
+    if (entry != kNoEntry)
     {
-      return it->second.get();
+      if (!entries_[entry].active)
+      {
+        Activate(entry);
+      }
+      entries_[entry].idle_collections = 0;
+      return entry;
     }
 
-    auto result = hash_map_.emplace(GetOverflowAttributes(), std::move(agg));
-    return result.first->second.get();
+    Insert(overflow_hash, overflow, aggregation_callback());
+    return entries_.size() - 1;
   }
 
-  bool IsOverflowAttributes(const MetricAttributes &attributes) const
+  // When recording, also counts the attribute sets routed to the overflow entry because of the
+  // limit. The attribute sets merged when collecting were counted when they were recorded.
+  bool IsOverflowAttributes(const MetricAttributes &attributes, bool record)
   {
     // If the incoming attributes are exactly the overflow sentinel, route
     // directly to the overflow entry.
@@ -217,9 +890,16 @@ class AttributesHashMapWithCustomHash
     }
     // The configured limit applies to distinct non-overflow attribute sets.
     // The overflow point is an additional reserved entry.
-    const bool has_overflow        = (hash_map_.find(GetOverflowAttributes()) != hash_map_.end());
-    const size_t non_overflow_size = hash_map_.size() - (has_overflow ? 1 : 0);
-    return non_overflow_size >= attributes_limit_;
+    const size_t non_overflow_size = active_size_ - (has_overflow_ ? 1 : 0);
+    if (non_overflow_size < attributes_limit_)
+    {
+      return false;
+    }
+    if (record)
+    {
+      overflow_count_++;
+    }
+    return true;
   }
 };
 
@@ -0,0 +1,90 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "opentelemetry/nostd/function_ref.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+
+/**
+ * A small pool of threads used to collect the metric storages of a meter in parallel.
+ *
+ * The tasks of a ForEach() call are claimed in small chunks from a shared cursor by the calling
+ * thread and the worker threads, so that a thread done with its chunk takes the next pending one
+ * instead of waiting for the others. The results are written by each task to its own slot, which
+ * keeps the assembled output in the same order as a sequential collection.
+ *
+ * An executor can be shared by several meter contexts. A ForEach() call made while another one
+ * is running, for example by two readers collecting at the same time or from within a task, runs
+ * its tasks sequentially on the calling thread.
+ */
+class CollectionExecutor
+{
+public:
+  /**
+   * Construct a new executor.
+   * @param parallelism The maximum number of threads collecting at the same time, including the
+   * thread calling ForEach(). 0 uses the number of hardware threads, and 1 collects sequentially
+   * without starting any thread.
+   */
+  explicit CollectionExecutor(size_t parallelism = 0);
+
+  CollectionExecutor(const CollectionExecutor &)            = delete;
+  CollectionExecutor(CollectionExecutor &&)                 = delete;
+  CollectionExecutor &operator=(const CollectionExecutor &) = delete;
+  CollectionExecutor &operator=(CollectionExecutor &&)      = delete;
+
+  ~CollectionExecutor();
+
+  /**
+   * @return the maximum number of threads collecting at the same time.
+   */
+  size_t GetParallelism() const noexcept { return parallelism_; }
+
+  /**
+   * Call task once for each index in [0, count), and return once all the calls returned. The
+   * calls are made concurrently, in no particular order.
+   */
+  void ForEach(size_t count, nostd::function_ref<void(size_t)> task) noexcept;
+
+private:
+  void DoWork();
+  void RunTasks(nostd::function_ref<void(size_t)> task, size_t count, size_t chunk) noexcept;
+
+  size_t parallelism_;
+  std::vector<std::thread> workers_;
+  // Set while a ForEach() call is dispatching tasks to the workers.
+  std::atomic<bool> busy_{false};
+
+  std::mutex lock_;
+  std::condition_variable work_cv_;
+  std::condition_variable done_cv_;
+  bool is_shutdown_ = false;
+  // Incremented for each ForEach() call dispatched to the workers.
+  uint64_t generation_ = 0;
+  // Number of workers which did not finish the tasks of the current generation.
+  size_t running_workers_ = 0;
+  const nostd::function_ref<void(size_t)> *task_ = nullptr;
+  size_t count_                                  = 0;
+  size_t chunk_                                  = 1;
+  // Index of the next task to claim.
+  std::atomic<size_t> next_{0};
+};
+
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
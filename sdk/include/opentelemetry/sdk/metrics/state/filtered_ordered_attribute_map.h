@@ -4,6 +4,8 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <initializer_list>
 #include <limits>
 #include <map>
@@ -12,12 +14,17 @@
 #include <vector>
 #include "opentelemetry/common/attribute_value.h"
 #include "opentelemetry/common/key_value_iterable.h"
+#include "opentelemetry/nostd/span.h"
 #include "opentelemetry/nostd/string_view.h"
 #include "opentelemetry/nostd/variant.h"
 #include "opentelemetry/sdk/common/attribute_utils.h"
 #include "opentelemetry/sdk/common/attributemap_hash.h"
 #include "opentelemetry/version.h"
 
+#if __cplusplus >= 201703L
+#  include <string_view>
+#endif
+
 OPENTELEMETRY_BEGIN_NAMESPACE
 namespace sdk
 {
@@ -25,6 +32,93 @@ namespace metrics
 {
 class AttributesProcessor;  // IWYU pragma: keep
 
+/**
+ * Hash of attribute values, consistent between the owned (OwnedAttributeValue) and the
+ * non-owning (AttributeValue) representations of a value.
+ */
+class AttributeValueHasher
+{
+public:
+  template <class T>
+  size_t operator()(const T &value) const noexcept
+  {
+    return std::hash<T>{}(value);
+  }
+
+  size_t operator()(nostd::string_view value) const noexcept
+  {
+    return HashBytes(value.data(), value.size());
+  }
+
+  size_t operator()(const std::string &value) const noexcept
+  {
+    return HashBytes(value.data(), value.size());
+  }
+
+  size_t operator()(const char *value) const noexcept
+  {
+    return (*this)(nostd::string_view(value));
+  }
+
+  template <class T>
+  size_t operator()(const std::vector<T> &values) const noexcept
+  {
+    return HashRange(values);
+  }
+
+  template <class T>
+  size_t operator()(const nostd::span<const T> &values) const noexcept
+  {
+    return HashRange(values);
+  }
+
+  static void Combine(size_t &seed, size_t hash) noexcept
+  {
+    seed ^= hash + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  }
+
+  /**
+   * Hash of a single attribute, combining its key and value hashes.
+   */
+  template <class T>
+  static size_t HashAttribute(nostd::string_view key, const T &value) noexcept
+  {
+    AttributeValueHasher hasher;
+    size_t seed = hasher(key);
+    Combine(seed, nostd::visit(hasher, value));
+    return seed;
+  }
+
+private:
+  // Hash of the characters of a string, the same for owned and non-owning strings.
+  static size_t HashBytes(const char *data, size_t size) noexcept
+  {
+#if __cplusplus >= 201703L
+    return std::hash<std::string_view>{}(std::string_view(data, size));
+#else
+    // FNV-1a, as std::hash<std::string> can only hash a std::string.
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; ++i)
+    {
+      hash ^= static_cast<unsigned char>(data[i]);
+      hash *= 1099511628211ULL;
+    }
+    return static_cast<size_t>(hash);
+#endif
+  }
+
+  template <class Range>
+  size_t HashRange(const Range &values) const noexcept
+  {
+    size_t seed = 0;
+    for (const auto &value : values)
+    {
+      Combine(seed, (*this)(value));
+    }
+    return seed;
+  }
+};
+
 class FilteredOrderedAttributeMap : public opentelemetry::sdk::common::OrderedAttributeMap
 {
 public:
@@ -73,7 +167,33 @@ class FilteredOrderedAttributeMap : public opentelemetry::sdk::common::OrderedAt
 
   size_t GetHash() const { return hash_; }
 
-  void UpdateHash() { hash_ = GetHashForAttributeMap(*this); }
+  /**
+   * The hash of the attributes combines the hashes of the individual attributes in the order of
+   * their keys, and can be computed from non-owning attributes as well (see ComputeHash()).
+   */
+  void UpdateHash()
+  {
+    hash_ = 0;
+    for (const auto &kv : *this)
+    {
+      AttributeValueHasher::Combine(hash_,
+                                    AttributeValueHasher::HashAttribute(kv.first, kv.second));
+    }
+  }
+
+  /**
+   * Compute the hash of the FilteredOrderedAttributeMap built from the given attributes and
+   * processor, without building it.
+   */
+  static size_t ComputeHash(const opentelemetry::common::KeyValueIterable &attributes,
+                            const opentelemetry::sdk::metrics::AttributesProcessor *processor);
+
+  /**
+   * Check whether this map is equal to the FilteredOrderedAttributeMap built from the given
+   * attributes and processor, without building it.
+   */
+  bool EqualTo(const opentelemetry::common::KeyValueIterable &attributes,
+               const opentelemetry::sdk::metrics::AttributesProcessor *processor) const;
 
 private:
   size_t hash_ = (std::numeric_limits<size_t>::max)();
@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 
 #include "opentelemetry/nostd/function_ref.h"
@@ -85,10 +87,27 @@ class MetricCollector : public MetricProducer, public CollectorHandle
 
   bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept;
 
+  /**
+   * @return the number of successful calls to Produce().
+   */
+  uint64_t GetCollectionCount() const noexcept;
+
+  /**
+   * @return the total duration of the successful calls to Produce().
+   */
+  std::chrono::nanoseconds GetCollectionDuration() const noexcept;
+
+  /**
+   * @return the metric reader of this collector.
+   */
+  MetricReader *GetMetricReader() const noexcept;
+
 private:
   MeterContext *meter_context_;
   std::shared_ptr<MetricReader> metric_reader_;
   std::unique_ptr<MetricFilter> metric_filter_;
+  std::atomic<uint64_t> collection_count_{0};
+  std::atomic<uint64_t> collection_duration_ns_{0};
 };
 }  // namespace metrics
 }  // namespace sdk
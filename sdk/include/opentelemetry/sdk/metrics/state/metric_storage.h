@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <unordered_map>
 
@@ -69,6 +71,23 @@ class MetricStorage
                        opentelemetry::common::SystemTimestamp sdk_start_ts,
                        opentelemetry::common::SystemTimestamp collection_ts,
                        nostd::function_ref<bool(MetricData)> callback) noexcept = 0;
+
+  /**
+   * @return an estimate of the memory used by the attribute sets and aggregations held by the
+   * storage, in bytes.
+   */
+  virtual size_t GetMemoryUsage() const noexcept { return 0; }
+
+  /**
+   * @return the number of series built by the last collection of the storage.
+   */
+  virtual size_t GetSeriesCount() const noexcept { return 0; }
+
+  /**
+   * @return the number of measurements routed to the overflow series because the cardinality
+   * limit was reached.
+   */
+  virtual uint64_t GetOverflowCount() const noexcept { return 0; }
 };
 
 /* Represents the sync metric storage */
@@ -98,6 +117,30 @@ class SyncWritableMetricStorage
                             const opentelemetry::common::KeyValueIterable &attributes,
                             const opentelemetry::context::Context &context) noexcept = 0;
 
+  /**
+   * Records a batch of values with the same attributes. The default implementation records the
+   * values one by one.
+   */
+  virtual void RecordLongBatch(nostd::span<const int64_t> values,
+                               const opentelemetry::common::KeyValueIterable &attributes,
+                               const opentelemetry::context::Context &context) noexcept
+  {
+    for (int64_t value : values)
+    {
+      RecordLong(value, attributes, context);
+    }
+  }
+
+  virtual void RecordDoubleBatch(nostd::span<const double> values,
+                                 const opentelemetry::common::KeyValueIterable &attributes,
+                                 const opentelemetry::context::Context &context) noexcept
+  {
+    for (double value : values)
+    {
+      RecordDouble(value, attributes, context);
+    }
+  }
+
 #ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
   /**
    * @since ABI_VERSION 2
@@ -11,6 +11,7 @@
 #include "opentelemetry/common/key_value_iterable.h"
 #include "opentelemetry/common/timestamp.h"
 #include "opentelemetry/context/context.h"
+#include "opentelemetry/nostd/span.h"
 #include "opentelemetry/sdk/metrics/state/attributes_hashmap.h"
 #include "opentelemetry/sdk/metrics/state/metric_storage.h"
 #include "opentelemetry/sdk/metrics/view/attributes_processor.h"
@@ -70,6 +71,26 @@ class SyncMultiMetricStorage : public SyncWritableMetricStorage
     }
   }
 
+  void RecordLongBatch(nostd::span<const int64_t> values,
+                       const opentelemetry::common::KeyValueIterable &attributes,
+                       const opentelemetry::context::Context &context) noexcept override
+  {
+    for (auto &s : storages_)
+    {
+      s->RecordLongBatch(values, attributes, context);
+    }
+  }
+
+  void RecordDoubleBatch(nostd::span<const double> values,
+                         const opentelemetry::common::KeyValueIterable &attributes,
+                         const opentelemetry::context::Context &context) noexcept override
+  {
+    for (auto &s : storages_)
+    {
+      s->RecordDoubleBatch(values, attributes, context);
+    }
+  }
+
 #ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
   std::shared_ptr<BoundSyncWritableMetricStorage> Bind(
       const opentelemetry::common::KeyValueIterable &attributes) noexcept override;
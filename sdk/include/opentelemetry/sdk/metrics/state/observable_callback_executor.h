@@ -0,0 +1,135 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+
+/**
+ * A small pool of threads used to invoke the callbacks of the asynchronous instruments of a meter
+ * in parallel, each within a deadline.
+ *
+ * The callbacks of a collection are claimed one at a time from a shared cursor by the idle worker
+ * threads, while the collecting thread waits for each callback until it returns, or until the
+ * callback timeout elapsed since it started. The measurements of a late callback are dropped, and
+ * the callback is not invoked again until it returned: the collections made in the meantime skip
+ * it. When no worker is idle, or when a callback is not started within the callback timeout
+ * because the workers are busy with late callbacks, the collecting thread invokes the callbacks
+ * left itself, without a deadline.
+ *
+ * A callback can not be interrupted, so a late callback keeps its worker thread busy, and the
+ * instrument owning it can not be destroyed before it returned.
+ *
+ * An executor can be shared by several meter contexts.
+ */
+class ObservableCallbackExecutor
+{
+public:
+  /**
+   * Construct a new executor.
+   * @param parallelism The maximum number of threads invoking callbacks at the same time,
+   * including the collecting thread. 0 uses the number of hardware threads, and 1 invokes the
+   * callbacks sequentially without starting any thread.
+   * @param callback_timeout The time after which the measurements of a callback are dropped.
+   */
+  explicit ObservableCallbackExecutor(
+      size_t parallelism                         = 0,
+      std::chrono::milliseconds callback_timeout = std::chrono::milliseconds(1000));
+
+  ObservableCallbackExecutor(const ObservableCallbackExecutor &)            = delete;
+  ObservableCallbackExecutor(ObservableCallbackExecutor &&)                 = delete;
+  ObservableCallbackExecutor &operator=(const ObservableCallbackExecutor &) = delete;
+  ObservableCallbackExecutor &operator=(ObservableCallbackExecutor &&)      = delete;
+
+  /**
+   * Wait for the running callbacks to return, and stop the worker threads.
+   */
+  ~ObservableCallbackExecutor();
+
+  /**
+   * @return the maximum number of threads invoking callbacks at the same time.
+   */
+  size_t GetParallelism() const noexcept { return parallelism_; }
+
+  /**
+   * @return the time after which the measurements of a callback are dropped.
+   */
+  std::chrono::milliseconds GetCallbackTimeout() const noexcept { return callback_timeout_; }
+
+  /**
+   * @return the number of callbacks which did not return within the callback timeout, and whose
+   * measurements were dropped.
+   */
+  uint64_t GetLateCallbackCount() const noexcept
+  {
+    return late_callbacks_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @return the number of callback invocations skipped because the previous invocation of the
+   * callback was late and had not returned yet.
+   */
+  uint64_t GetSkippedCallbackCount() const noexcept
+  {
+    return skipped_callbacks_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * NOTE - INTERNAL method, can change in future.
+   * Run job on at most count idle worker threads, without waiting for it.
+   * @return the number of worker threads the job was dispatched to.
+   */
+  size_t Dispatch(size_t count, const std::function<void()> &job);
+
+  /**
+   * NOTE - INTERNAL method, can change in future.
+   * Count a callback whose measurements were dropped because it was late.
+   */
+  void RecordLateCallback() noexcept { late_callbacks_.fetch_add(1, std::memory_order_relaxed); }
+
+  /**
+   * NOTE - INTERNAL method, can change in future.
+   * Count a callback invocation skipped because the previous one had not returned yet.
+   */
+  void RecordSkippedCallback() noexcept
+  {
+    skipped_callbacks_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+private:
+  void DoWork();
+
+  size_t parallelism_;
+  std::chrono::milliseconds callback_timeout_;
+  std::vector<std::thread> workers_;
+  std::atomic<uint64_t> late_callbacks_{0};
+  std::atomic<uint64_t> skipped_callbacks_{0};
+
+  std::mutex lock_;
+  std::condition_variable work_cv_;
+  bool is_shutdown_ = false;
+  // Number of workers waiting for a job which was not dispatched to them yet.
+  size_t idle_workers_ = 0;
+  std::deque<std::function<void()>> jobs_;
+};
+
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -25,7 +27,9 @@ namespace sdk
 namespace metrics
 {
 
+class ObservableCallbackExecutor;
 struct ObservableCallbackRecord;
+struct ObserveRound;
 
 class ObservableRegistry
 {
@@ -59,11 +63,27 @@ class ObservableRegistry
 
   void CleanupCallback(opentelemetry::metrics::ObservableInstrument *instrument);
 
-  void Observe(opentelemetry::common::SystemTimestamp collection_ts);
+  // Invoke the callbacks, and store their measurements into the metric storages of their
+  // instruments. The callbacks are invoked without holding the lock of the registry, in parallel
+  // and within a deadline when an executor is given, and sequentially on the calling thread
+  // otherwise. A callback being invoked is only removed once it returned. A concurrent Observe()
+  // call waits for the callbacks being invoked, and only skips the late ones.
+  void Observe(opentelemetry::common::SystemTimestamp collection_ts,
+               ObservableCallbackExecutor *executor = nullptr);
 
 private:
+  // Invoke the callbacks of the round not claimed yet by another thread.
+  void InvokeCallbacks(ObserveRound &round);
+  // Wait until no callback for which predicate returns true is being invoked.
+  template <class Predicate>
+  void WaitForCallbacks(std::unique_lock<std::mutex> &lock, Predicate predicate);
+
   std::unordered_map<uintptr_t, std::unique_ptr<ObservableCallbackRecord>> callbacks_;
   std::mutex callbacks_m_;
+  // Notified when a callback starts or returns.
+  std::condition_variable callbacks_cv_;
+  // Number of records used by an Observe() call or a late callback.
+  size_t busy_callbacks_ = 0;
 };
 
 }  // namespace metrics
@@ -0,0 +1,338 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "opentelemetry/common/key_value_iterable.h"
+#include "opentelemetry/nostd/function_ref.h"
+#include "opentelemetry/sdk/common/aligned_array.h"
+#include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
+#include "opentelemetry/sdk/metrics/instruments.h"
+#include "opentelemetry/sdk/metrics/state/attributes_hashmap.h"
+#include "opentelemetry/sdk/metrics/state/filtered_ordered_attribute_map.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+
+/**
+ * A set of AttributesHashMap shards, each guarded by its own mutex.
+ *
+ * Writers only lock the shard owning the hash of their attribute set, so measurements recorded
+ * for different attribute sets of the same instrument do not contend on a single lock. The
+ * cardinality limit applies to the union of all shards: admitted attribute sets are counted in a
+ * shared atomic counter, and attribute sets beyond the limit are routed to the overflow entry of
+ * their shard. Collect() swaps out every shard and merges them into a single AttributesHashMap,
+ * combining the overflow entries of all shards.
+ *
+ * When max_idle_collections is not 0, the attribute sets and aggregations are instead kept in the
+ * shards across collections, and Collect() exchanges the recorded aggregations with the reset
+ * aggregations of a collected hash which is itself reused as long as it is not referenced
+ * anymore. An attribute set is only evicted after max_idle_collections consecutive collections
+ * without measurements, so that recording to it after a collection does not allocate.
+ */
+template <typename CustomHash = MetricAttributesHash>
+class ShardedAttributesHashMapWithCustomHash
+{
+public:
+  using HashMap = AttributesHashMapWithCustomHash<CustomHash>;
+
+  ShardedAttributesHashMapWithCustomHash(size_t shard_count,
+                                         size_t attributes_limit     = kAggregationCardinalityLimit,
+                                         size_t max_idle_collections = 0)
+      : shards_(shard_count == 0 ? 1 : shard_count),
+        attributes_limit_(attributes_limit),
+        max_idle_collections_(max_idle_collections),
+        admitted_limit_(attributes_limit)
+  {
+    for (auto &shard : shards_)
+    {
+      shard.attributes_hashmap.reset(new HashMap(attributes_limit_));
+    }
+  }
+
+  ShardedAttributesHashMapWithCustomHash(const ShardedAttributesHashMapWithCustomHash &) = delete;
+  ShardedAttributesHashMapWithCustomHash &operator=(
+      const ShardedAttributesHashMapWithCustomHash &) = delete;
+
+  /**
+   * Find or create the aggregation for the given attributes, and invoke the callback on it while
+   * the owning shard is locked.
+   */
+  void GetOrSetDefault(const MetricAttributes &attributes,
+                       nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback,
+                       nostd::function_ref<void(Aggregation &)> callback)
+  {
+    GetOrSetDefaultImpl(attributes, aggregation_callback, callback);
+  }
+
+  void GetOrSetDefault(MetricAttributes &&attributes,
+                       nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback,
+                       nostd::function_ref<void(Aggregation &)> callback)
+  {
+    GetOrSetDefaultImpl(std::move(attributes), aggregation_callback, callback);
+  }
+
+  /**
+   * Same as GetOrSetDefault() for the attributes kept by the processor, which are looked up
+   * without being copied in a MetricAttributes. The MetricAttributes are only built when the
+   * attribute set is not present yet.
+   */
+  void GetOrSetDefault(const opentelemetry::common::KeyValueIterable &attributes,
+                       const AttributesProcessor *processor,
+                       nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback,
+                       nostd::function_ref<void(Aggregation &)> callback)
+  {
+    static_assert(std::is_same<CustomHash, MetricAttributesHash>::value,
+                  "Looking up attributes requires the hash of MetricAttributes");
+    const size_t hash = MetricAttributes::ComputeHash(attributes, processor);
+    Shard &shard      = shards_[hash % shards_.size()];
+    {
+      std::lock_guard<std::mutex> guard(shard.lock);
+      bool admitted = true;
+      Aggregation *aggregation =
+          shard.attributes_hashmap->GetOrActivate(
+              hash,
+              [&](const MetricAttributes &stored) { return stored.EqualTo(attributes, processor); },
+              [&]() { return admitted = Admit(); });
+      if (!admitted)
+      {
+        aggregation = shard.attributes_hashmap->GetOrSetDefault(GetOverflowAttributes(),
+                                                                aggregation_callback);
+      }
+      if (aggregation != nullptr)
+      {
+        callback(*aggregation);
+        return;
+      }
+    }
+    GetOrSetDefaultImpl(MetricAttributes{attributes, processor}, aggregation_callback, callback);
+  }
+
+  /**
+   * @return check if key is present in any shard
+   */
+  bool Has(const MetricAttributes &attributes)
+  {
+    if (attributes == GetOverflowAttributes())
+    {
+      // The overflow entry lives in the shard of the attributes that overflowed.
+      for (auto &shard : shards_)
+      {
+        std::lock_guard<std::mutex> guard(shard.lock);
+        if (shard.attributes_hashmap->Has(attributes))
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+    Shard &shard = shards_[ShardIndex(attributes)];
+    std::lock_guard<std::mutex> guard(shard.lock);
+    return shard.attributes_hashmap->Has(attributes);
+  }
+
+  /**
+   * Swap out the content of all the shards, and return it merged in a single hash.
+   */
+  std::shared_ptr<HashMap> Collect(
+      nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback)
+  {
+    if (max_idle_collections_ > 0)
+    {
+      return CollectRetained(aggregation_callback);
+    }
+
+    std::vector<std::unique_ptr<HashMap>> collected;
+    collected.reserve(shards_.size());
+    {
+      // All the shards are locked together so that the admitted counter is reset consistently
+      // with the content of the shards.
+      std::vector<std::unique_lock<std::mutex>> guards;
+      guards.reserve(shards_.size());
+      for (auto &shard : shards_)
+      {
+        guards.emplace_back(shard.lock);
+      }
+      for (auto &shard : shards_)
+      {
+        collected.push_back(std::move(shard.attributes_hashmap));
+        shard.attributes_hashmap.reset(new HashMap(attributes_limit_));
+      }
+      admitted_.store(0, std::memory_order_relaxed);
+    }
+
+    std::shared_ptr<HashMap> result = std::move(collected[0]);
+    for (size_t i = 1; i < collected.size(); i++)
+    {
+      result->MergeFrom(std::move(*collected[i]));
+    }
+    return result;
+  }
+
+  /**
+   * Reserve a slot of the limit for an attribute set which is not recorded to the shards, but
+   * merged into the collected hash by the caller. The attribute sets admitted to the shards are
+   * limited to the remaining slots from now on.
+   */
+  void ReserveAttributes() noexcept
+  {
+    size_t limit = admitted_limit_.load(std::memory_order_relaxed);
+    while (limit > 0 &&
+           !admitted_limit_.compare_exchange_weak(limit, limit - 1, std::memory_order_relaxed))
+    {
+    }
+  }
+
+  size_t ShardCount() const noexcept { return shards_.size(); }
+
+  /**
+   * @return the number of lookups of a new attribute set that were routed to the overflow entry
+   * because the cardinality limit was reached.
+   */
+  uint64_t OverflowCount() const noexcept
+  {
+    return overflow_count_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @return an estimate of the memory used by the shards and the retained collected hash, in
+   * bytes.
+   */
+  size_t MemoryUsage()
+  {
+    size_t usage = shards_.MemoryUsage();
+    for (auto &shard : shards_)
+    {
+      std::lock_guard<std::mutex> guard(shard.lock);
+      usage += sizeof(HashMap) + shard.attributes_hashmap->MemoryUsage();
+    }
+    std::lock_guard<std::mutex> collect_guard(collect_lock_);
+    if (collected_)
+    {
+      usage += sizeof(HashMap) + collected_->MemoryUsage();
+    }
+    return usage;
+  }
+
+#ifdef UNIT_TESTING
+  size_t RetainedSize()
+  {
+    size_t size = 0;
+    for (auto &shard : shards_)
+    {
+      std::lock_guard<std::mutex> guard(shard.lock);
+      size += shard.attributes_hashmap->RetainedSize();
+    }
+    return size;
+  }
+#endif
+
+private:
+  // Aligned to a cache line, so that the locks of neighbouring shards are on different lines.
+  struct alignas(64) Shard
+  {
+    std::mutex lock;
+    std::unique_ptr<HashMap> attributes_hashmap;
+  };
+
+  std::shared_ptr<HashMap> CollectRetained(
+      nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback)
+  {
+    std::lock_guard<std::mutex> collect_guard(collect_lock_);
+    // The hash returned by the previous collection can only be reused once the caller released it.
+    if (collected_ == nullptr || collected_.use_count() > 1)
+    {
+      collected_ = std::make_shared<HashMap>(attributes_limit_);
+    }
+    else
+    {
+      collected_->Reset(max_idle_collections_, aggregation_callback);
+    }
+    // Each shard only needs to be locked while its own aggregations are exchanged. The admitted
+    // counter is decreased by the number of attribute sets collected from the shard.
+    for (auto &shard : shards_)
+    {
+      std::lock_guard<std::mutex> guard(shard.lock);
+      const size_t collected = shard.attributes_hashmap->CollectInto(
+          *collected_, max_idle_collections_, aggregation_callback);
+      admitted_.fetch_sub(collected, std::memory_order_relaxed);
+    }
+    return collected_;
+  }
+
+  size_t ShardIndex(const MetricAttributes &attributes) const
+  {
+    return CustomHash()(attributes) % shards_.size();
+  }
+
+  template <class AttributesT>
+  void GetOrSetDefaultImpl(AttributesT &&attributes,
+                           nostd::function_ref<std::unique_ptr<Aggregation>()> aggregation_callback,
+                           nostd::function_ref<void(Aggregation &)> callback)
+  {
+    // The hash selects the shard, and is passed on to its hash map rather than computed again.
+    const size_t hash = CustomHash()(attributes);
+    Shard &shard      = shards_[hash % shards_.size()];
+    std::lock_guard<std::mutex> guard(shard.lock);
+    Aggregation *aggregation = shard.attributes_hashmap->Get(
+        hash, [&](const MetricAttributes &stored) { return stored == attributes; });
+    if (aggregation == nullptr)
+    {
+      if (attributes == GetOverflowAttributes() || Admit())
+      {
+        aggregation = shard.attributes_hashmap->GetOrSetDefault(
+            hash, std::forward<AttributesT>(attributes), aggregation_callback);
+      }
+      else
+      {
+        aggregation = shard.attributes_hashmap->GetOrSetDefault(GetOverflowAttributes(),
+                                                                aggregation_callback);
+      }
+    }
+    callback(*aggregation);
+  }
+
+  // Reserve a slot for a new, non-overflow attribute set. Returns false when the cardinality
+  // limit is reached.
+  bool Admit() noexcept
+  {
+    if (admitted_.fetch_add(1, std::memory_order_relaxed) <
+        admitted_limit_.load(std::memory_order_relaxed))
+    {
+      return true;
+    }
+    admitted_.fetch_sub(1, std::memory_order_relaxed);
+    overflow_count_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  opentelemetry::sdk::common::AlignedArray<Shard> shards_;
+  size_t attributes_limit_;
+  size_t max_idle_collections_;
+  // The limit of the attribute sets admitted to the shards, which excludes the reserved slots.
+  std::atomic<size_t> admitted_limit_;
+  std::atomic<size_t> admitted_{0};
+  std::atomic<uint64_t> overflow_count_{0};
+  // Serializes collections, and guards collected_.
+  std::mutex collect_lock_;
+  std::shared_ptr<HashMap> collected_;
+};
+
+using ShardedAttributesHashMap = ShardedAttributesHashMapWithCustomHash<>;
+
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
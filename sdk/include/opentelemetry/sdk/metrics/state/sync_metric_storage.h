@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -27,6 +28,7 @@
 #include "opentelemetry/sdk/metrics/state/attributes_hashmap.h"
 #include "opentelemetry/sdk/metrics/state/metric_collector.h"
 #include "opentelemetry/sdk/metrics/state/metric_storage.h"
+#include "opentelemetry/sdk/metrics/state/sharded_attributes_hashmap.h"
 #include "opentelemetry/sdk/metrics/state/temporal_metric_storage.h"
 #include "opentelemetry/sdk/metrics/view/attributes_processor.h"
 #include "opentelemetry/version.h"
@@ -60,8 +62,10 @@ class SyncMetricStorage : public MetricStorage, public SyncWritableMetricStorage
                     const AggregationConfig *aggregation_config)
       : instrument_descriptor_(instrument_descriptor),
         aggregation_config_(AggregationConfig::GetOrDefault(aggregation_config)),
-        attributes_hashmap_(
-            std::make_unique<AttributesHashMap>(aggregation_config_->cardinality_limit_)),
+        attributes_hashmap_(std::make_unique<ShardedAttributesHashMap>(
+            aggregation_config_->attributes_shard_count_,
+            aggregation_config_->cardinality_limit_,
+            aggregation_config_->max_idle_collections_)),
         attributes_processor_(std::move(attributes_processor)),
 #ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
         exemplar_filter_type_(exemplar_filter_type),
@@ -90,15 +94,7 @@ class SyncMetricStorage : public MetricStorage, public SyncWritableMetricStorage
       exemplar_reservoir_->OfferMeasurement(value, {}, context);
     }
 #endif
-    static MetricAttributes attr = MetricAttributes{};
-    std::lock_guard<std::mutex> guard(attribute_hashmap_lock_);
-#ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
-    MetricAttributes resolved = ResolveCardinality(attr);
-    attributes_hashmap_->GetOrSetDefault(std::move(resolved), create_default_aggregation_)
-        ->Aggregate(value);
-#else
-    attributes_hashmap_->GetOrSetDefault(attr, create_default_aggregation_)->Aggregate(value);
-#endif
+    RecordWithoutAttributes([value](Aggregation &aggregation) { aggregation.Aggregate(value); });
   }
 
   void RecordLong(int64_t value,
@@ -116,20 +112,27 @@ class SyncMetricStorage : public MetricStorage, public SyncWritableMetricStorage
       exemplar_reservoir_->OfferMeasurement(value, attributes, context);
     }
 #endif
-
+    if (attributes.size() == 0)
+    {
+      RecordWithoutAttributes([value](Aggregation &aggregation) { aggregation.Aggregate(value); });
+      return;
+    }
+#ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
     MetricAttributes attr{attributes, attributes_processor_.get()};
     std::lock_guard<std::mutex> guard(attribute_hashmap_lock_);
-#ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
     // Resolve via the unified cardinality policy so unbound and bound paths
     // share one combined limit (see ResolveCardinality()).
     MetricAttributes resolved = ResolveCardinality(std::move(attr));
     // cppcheck-suppress accessMoved
-    attributes_hashmap_->GetOrSetDefault(std::move(resolved), create_default_aggregation_)
-        ->Aggregate(value);
+    attributes_hashmap_->GetOrSetDefault(std::move(resolved), create_default_aggregation_,
+                                         [value](Aggregation &aggregation) {
+                                           aggregation.Aggregate(value);
+                                         });
 #else
-    // cppcheck-suppress accessMoved
-    attributes_hashmap_->GetOrSetDefault(std::move(attr), create_default_aggregation_)
-        ->Aggregate(value);
+    // The attributes are only copied when recording to a new attribute set.
+    attributes_hashmap_->GetOrSetDefault(
+        attributes, attributes_processor_.get(), create_default_aggregation_,
+        [value](Aggregation &aggregation) { aggregation.Aggregate(value); });
 #endif
   }
 
@@ -147,15 +150,7 @@ class SyncMetricStorage : public MetricStorage, public SyncWritableMetricStorage
       exemplar_reservoir_->OfferMeasurement(value, {}, context);
     }
 #endif
-    static MetricAttributes attr = MetricAttributes{};
-    std::lock_guard<std::mutex> guard(attribute_hashmap_lock_);
-#ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
-    MetricAttributes resolved = ResolveCardinality(attr);
-    attributes_hashmap_->GetOrSetDefault(std::move(resolved), create_default_aggregation_)
-        ->Aggregate(value);
-#else
-    attributes_hashmap_->GetOrSetDefault(attr, create_default_aggregation_)->Aggregate(value);
-#endif
+    RecordWithoutAttributes([value](Aggregation &aggregation) { aggregation.Aggregate(value); });
   }
 
   void RecordDouble(double value,
@@ -173,17 +168,107 @@ class SyncMetricStorage : public MetricStorage, public SyncWritableMetricStorage
       exemplar_reservoir_->OfferMeasurement(value, attributes, context);
     }
 #endif
+    if (attributes.size() == 0)
+    {
+      RecordWithoutAttributes([value](Aggregation &aggregation) { aggregation.Aggregate(value); });
+      return;
+    }
+#ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
     MetricAttributes attr{attributes, attributes_processor_.get()};
     std::lock_guard<std::mutex> guard(attribute_hashmap_lock_);
+    MetricAttributes resolved = ResolveCardinality(std::move(attr));
+    // cppcheck-suppress accessMoved
+    attributes_hashmap_->GetOrSetDefault(std::move(resolved), create_default_aggregation_,
+                                         [value](Aggregation &aggregation) {
+                                           aggregation.Aggregate(value);
+                                         });
+#else
+    // The attributes are only copied when recording to a new attribute set.
+    attributes_hashmap_->GetOrSetDefault(
+        attributes, attributes_processor_.get(), create_default_aggregation_,
+        [value](Aggregation &aggregation) { aggregation.Aggregate(value); });
+#endif
+  }
+
+  void RecordLongBatch(nostd::span<const int64_t> values,
+                       const opentelemetry::common::KeyValueIterable &attributes,
+                       const opentelemetry::context::Context &context
+                       OPENTELEMETRY_MAYBE_UNUSED) noexcept override
+  {
+    if (instrument_descriptor_.value_type_ != InstrumentValueType::kLong || values.empty())
+    {
+      return;
+    }
+#ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
+    if (ExemplarFilterEnabled(exemplar_filter_type_, context))
+    {
+      for (int64_t value : values)
+      {
+        exemplar_reservoir_->OfferMeasurement(value, attributes, context);
+      }
+    }
+#endif
+    if (attributes.size() == 0)
+    {
+      RecordWithoutAttributes(
+          [values](Aggregation &aggregation) { aggregation.AggregateBatch(values); });
+      return;
+    }
 #ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
+    MetricAttributes attr{attributes, attributes_processor_.get()};
+    std::lock_guard<std::mutex> guard(attribute_hashmap_lock_);
     MetricAttributes resolved = ResolveCardinality(std::move(attr));
     // cppcheck-suppress accessMoved
-    attributes_hashmap_->GetOrSetDefault(std::move(resolved), create_default_aggregation_)
-        ->Aggregate(value);
+    attributes_hashmap_->GetOrSetDefault(std::move(resolved), create_default_aggregation_,
+                                         [values](Aggregation &aggregation) {
+                                           aggregation.AggregateBatch(values);
+                                         });
 #else
+    // The attribute set is looked up once, and the whole batch is aggregated under its lock.
+    attributes_hashmap_->GetOrSetDefault(
+        attributes, attributes_processor_.get(), create_default_aggregation_,
+        [values](Aggregation &aggregation) { aggregation.AggregateBatch(values); });
+#endif
+  }
+
+  void RecordDoubleBatch(nostd::span<const double> values,
+                         const opentelemetry::common::KeyValueIterable &attributes,
+                         const opentelemetry::context::Context &context
+                         OPENTELEMETRY_MAYBE_UNUSED) noexcept override
+  {
+    if (instrument_descriptor_.value_type_ != InstrumentValueType::kDouble || values.empty())
+    {
+      return;
+    }
+#ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
+    if (ExemplarFilterEnabled(exemplar_filter_type_, context))
+    {
+      for (double value : values)
+      {
+        exemplar_reservoir_->OfferMeasurement(value, attributes, context);
+      }
+    }
+#endif
+    if (attributes.size() == 0)
+    {
+      RecordWithoutAttributes(
+          [values](Aggregation &aggregation) { aggregation.AggregateBatch(values); });
+      return;
+    }
+#ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
+    MetricAttributes attr{attributes, attributes_processor_.get()};
+    std::lock_guard<std::mutex> guard(attribute_hashmap_lock_);
+    MetricAttributes resolved = ResolveCardinality(std::move(attr));
     // cppcheck-suppress accessMoved
-    attributes_hashmap_->GetOrSetDefault(std::move(attr), create_default_aggregation_)
-        ->Aggregate(value);
+    attributes_hashmap_->GetOrSetDefault(std::move(resolved), create_default_aggregation_,
+                                         [values](Aggregation &aggregation) {
+                                           aggregation.AggregateBatch(values);
+                                         });
+#else
+    // The attribute set is looked up once, and the whole batch is aggregated under its lock.
+    attributes_hashmap_->GetOrSetDefault(
+        attributes, attributes_processor_.get(), create_default_aggregation_,
+        [values](Aggregation &aggregation) { aggregation.AggregateBatch(values); });
 #endif
   }
 
@@ -193,6 +278,27 @@ class SyncMetricStorage : public MetricStorage, public SyncWritableMetricStorage
                opentelemetry::common::SystemTimestamp collection_ts,
                nostd::function_ref<bool(MetricData)> callback) noexcept override;
 
+  size_t GetMemoryUsage() const noexcept override
+  {
+    return attributes_hashmap_->MemoryUsage() + temporal_metric_storage_.GetMemoryUsage();
+  }
+
+  size_t GetSeriesCount() const noexcept override
+  {
+    return temporal_metric_storage_.GetSeriesCount();
+  }
+
+  uint64_t GetOverflowCount() const noexcept override
+  {
+#ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
+    // New attribute sets are routed to the overflow entry by ResolveCardinality(), before they
+    // reach attributes_hashmap_.
+    return attributes_hashmap_->OverflowCount() + overflow_count_.load(std::memory_order_relaxed);
+#else
+    return attributes_hashmap_->OverflowCount();
+#endif
+  }
+
 #ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
   std::shared_ptr<BoundSyncWritableMetricStorage> Bind(
       const opentelemetry::common::KeyValueIterable &attributes) noexcept override;
@@ -233,6 +339,78 @@ class SyncMetricStorage : public MetricStorage, public SyncWritableMetricStorage
 #endif
 
 private:
+#ifndef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
+  // Aggregation of the measurements recorded without attributes. It is resolved once, outside of
+  // attributes_hashmap_, so that recording to it takes no lock and does not hash the attributes.
+  struct NoAttributesCell
+  {
+    NoAttributesCell()                                    = default;
+    NoAttributesCell(const NoAttributesCell &)            = delete;
+    NoAttributesCell &operator=(const NoAttributesCell &) = delete;
+    ~NoAttributesCell() { delete aggregation.load(std::memory_order_relaxed); }
+
+    // Created by the first measurement, and owned by the cell.
+    std::atomic<Aggregation *> aggregation{nullptr};
+    // Number of writers which may be recording to the aggregation.
+    std::atomic<size_t> writers{0};
+    // Whether a measurement was recorded since the cell was last collected.
+    std::atomic<bool> recorded{false};
+  };
+
+  // Collect the measurements recorded without attributes into delta_metrics.
+  void CollectNoAttributes(AttributesHashMap &delta_metrics) noexcept;
+#endif
+
+  // Invoke callback on the aggregation of the measurements recorded without attributes.
+  template <class CallbackT>
+  void RecordWithoutAttributes(CallbackT callback) noexcept
+  {
+#ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
+    // The empty attribute set counts towards the cardinality limit shared with the bound entries,
+    // and is resolved under attribute_hashmap_lock_ like any other attribute set.
+    static const MetricAttributes attr{};
+    std::lock_guard<std::mutex> guard(attribute_hashmap_lock_);
+    attributes_hashmap_->GetOrSetDefault(ResolveCardinality(attr), create_default_aggregation_,
+                                         callback);
+#else
+    // Collect() switches the active cell before collecting the other one, and waits for the
+    // writers which did not see the switch to finish recording to it.
+    for (;;)
+    {
+      const size_t index     = active_no_attributes_cell_.load();
+      NoAttributesCell &cell = no_attributes_cells_[index];
+      cell.writers.fetch_add(1);
+      if (active_no_attributes_cell_.load() != index)
+      {
+        // The cell was switched while registering as a writer, and may be collected already.
+        cell.writers.fetch_sub(1, std::memory_order_relaxed);
+        continue;
+      }
+      Aggregation *aggregation = cell.aggregation.load(std::memory_order_acquire);
+      if (aggregation == nullptr)
+      {
+        // CollectNoAttributes() merges the empty attribute set after the attribute sets of the
+        // hashmap, so its slot of the cardinality limit is reserved by the first measurement.
+        if (!no_attributes_reserved_.load(std::memory_order_relaxed) &&
+            !no_attributes_reserved_.exchange(true))
+        {
+          attributes_hashmap_->ReserveAttributes();
+        }
+        std::unique_ptr<Aggregation> created = create_default_aggregation_();
+        if (cell.aggregation.compare_exchange_strong(aggregation, created.get(),
+                                                     std::memory_order_acq_rel))
+        {
+          aggregation = created.release();
+        }
+      }
+      callback(*aggregation);
+      cell.recorded.store(true, std::memory_order_relaxed);
+      cell.writers.fetch_sub(1, std::memory_order_release);
+      return;
+    }
+#endif
+  }
+
 #ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
   // Unified cardinality resolver. Returns either `filtered` unchanged or
   // kOverflowAttributes. Existing keys (already present in active_keys_) pass
@@ -268,6 +446,7 @@ class SyncMetricStorage : public MetricStorage, public SyncWritableMetricStorage
     if (would_overflow)
     {
       active_keys_.insert(GetOverflowAttributes());
+      overflow_count_.fetch_add(1, std::memory_order_relaxed);
       return GetOverflowAttributes();
     }
     active_keys_.insert(filtered);
@@ -276,9 +455,11 @@ class SyncMetricStorage : public MetricStorage, public SyncWritableMetricStorage
 #endif
 
   InstrumentDescriptor instrument_descriptor_;
-  // hashmap to maintain the metrics for delta collection (i.e, collection since last Collect call)
   const AggregationConfig *aggregation_config_;
-  std::unique_ptr<AttributesHashMap> attributes_hashmap_;
+  // hashmap to maintain the metrics for delta collection (i.e, collection since last Collect call),
+  // sharded to spread concurrent writers over independent locks. Attribute sets may be retained
+  // across collections, see AggregationConfig::max_idle_collections_.
+  std::unique_ptr<ShardedAttributesHashMap> attributes_hashmap_;
   std::function<std::unique_ptr<Aggregation>()> create_default_aggregation_;
   std::shared_ptr<const AttributesProcessor> attributes_processor_;
 #ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
@@ -286,8 +467,19 @@ class SyncMetricStorage : public MetricStorage, public SyncWritableMetricStorage
   nostd::shared_ptr<ExemplarReservoir> exemplar_reservoir_;
 #endif
   TemporalMetricStorage temporal_metric_storage_;
-  std::mutex attribute_hashmap_lock_;
+#ifndef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
+  // Measurements recorded without attributes go to the cell at index active_no_attributes_cell_.
+  NoAttributesCell no_attributes_cells_[2];
+  std::atomic<size_t> active_no_attributes_cell_{0};
+  // Whether a slot of the cardinality limit of attributes_hashmap_ is reserved for the empty
+  // attribute set.
+  std::atomic<bool> no_attributes_reserved_{false};
+  // Serializes the collections of the cells.
+  std::mutex no_attributes_collect_lock_;
+#endif
 #ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
+  // Serializes the unified cardinality resolution of bound and unbound writes.
+  std::mutex attribute_hashmap_lock_;
   // NOTE: ENABLE_METRICS_BOUND_INSTRUMENTS_PREVIEW changes the layout and
   // vtable of SyncMetricStorage (these conditional members and the virtual
   // Bind() method on SyncWritableMetricStorage). It MUST be defined
@@ -305,6 +497,8 @@ class SyncMetricStorage : public MetricStorage, public SyncWritableMetricStorage
   // bound entry keys at every Collect(), mirroring the per-interval reset of
   // attributes_hashmap_ while retaining bound-entry cardinality cost.
   std::unordered_set<MetricAttributes, AttributeHashGenerator> active_keys_;
+  // Number of new attribute sets routed to the overflow entry by ResolveCardinality().
+  std::atomic<uint64_t> overflow_count_{0};
 #endif
 };
 
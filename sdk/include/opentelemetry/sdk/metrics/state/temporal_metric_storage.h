@@ -3,7 +3,8 @@
 
 #pragma once
 
-#include <list>
+#include <atomic>
+#include <cstddef>
 #include <memory>
 #include <unordered_map>
 
@@ -23,10 +24,11 @@ namespace sdk
 namespace metrics
 {
 
-struct LastReportedMetrics
+// Measurements collected since the last collection of a collector with delta temporality.
+struct UnreportedDeltaMetrics
 {
   std::unique_ptr<AttributesHashMap> attributes_map;
-  opentelemetry::common::SystemTimestamp collection_ts;
+  opentelemetry::common::SystemTimestamp last_collection_ts;
 };
 
 class TemporalMetricStorage
@@ -43,21 +45,39 @@ class TemporalMetricStorage
                     const std::shared_ptr<AttributesHashMap> &delta_metrics,
                     nostd::function_ref<bool(MetricData)> callback) noexcept;
 
+  /**
+   * @return an estimate of the memory used by the cumulative metrics and the unreported delta
+   * metrics, in bytes.
+   */
+  size_t GetMemoryUsage() const noexcept;
+
+  /**
+   * @return the number of series, i.e. of points, built by the last collection.
+   */
+  size_t GetSeriesCount() const noexcept { return series_count_.load(std::memory_order_relaxed); }
+
 private:
+  // Merge the aggregations of delta into the aggregations of target, in place when the
+  // aggregation supports it, so that only new attribute sets allocate an aggregation.
+  void MergeInto(AttributesHashMap &target, const AttributesHashMap &delta) noexcept;
+
   InstrumentDescriptor instrument_descriptor_;
   AggregationType aggregation_type_;
 
-  // unreported metrics stash for all the collectors
-  std::unordered_map<CollectorHandle *, std::list<std::shared_ptr<AttributesHashMap>>>
-      unreported_metrics_;
-  // last reported metrics stash for all the collectors.
-  std::unordered_map<CollectorHandle *, LastReportedMetrics> last_reported_metrics_;
+  // The cumulative metrics, shared by all the collectors with cumulative temporality. Each delta
+  // is merged into it once, when it is collected.
+  std::unique_ptr<AttributesHashMap> cumulative_metrics_;
+  // The unreported delta metrics of each collector with delta temporality.
+  std::unordered_map<CollectorHandle *, UnreportedDeltaMetrics> unreported_metrics_;
 
   // Lock while building metrics
   mutable opentelemetry::common::SpinLockMutex lock_;
   const AggregationConfig *aggregation_config_;
   opentelemetry::common::SystemTimestamp last_delta_collection_ts_;
+  // The collection timestamp of the last delta merged into the metrics to export.
+  opentelemetry::common::SystemTimestamp last_merge_ts_;
   bool has_last_delta_collection_ts_ = false;
+  std::atomic<size_t> series_count_{0};
   // Captured at this storage's construction time. Per the OpenTelemetry
   // specification, the start_ts of the first delta collection interval MUST be
   // the creation time of the instrument, NOT the MeterProvider creation time.
@@ -10,6 +10,7 @@
 #include "opentelemetry/common/key_value_iterable.h"
 #include "opentelemetry/context/context.h"
 #include "opentelemetry/metrics/sync_instruments.h"
+#include "opentelemetry/nostd/span.h"
 #include "opentelemetry/sdk/metrics/instruments.h"
 #include "opentelemetry/sdk/metrics/state/metric_storage.h"
 #include "opentelemetry/version.h"
@@ -50,6 +51,11 @@ class LongCounter : public Synchronous, public opentelemetry::metrics::Counter<u
 
   void Add(uint64_t value, const opentelemetry::context::Context &context) noexcept override;
 
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+  void AddBatch(opentelemetry::nostd::span<const uint64_t> values,
+                const opentelemetry::common::KeyValueIterable &attributes) noexcept override;
+#endif
+
 #ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
   opentelemetry::nostd::unique_ptr<opentelemetry::metrics::BoundCounter<uint64_t>> Bind(
       const opentelemetry::common::KeyValueIterable &attributes) noexcept override;
@@ -72,6 +78,11 @@ class DoubleCounter : public Synchronous, public opentelemetry::metrics::Counter
   void Add(double value) noexcept override;
   void Add(double value, const opentelemetry::context::Context &context) noexcept override;
 
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+  void AddBatch(opentelemetry::nostd::span<const double> values,
+                const opentelemetry::common::KeyValueIterable &attributes) noexcept override;
+#endif
+
 #ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
   opentelemetry::nostd::unique_ptr<opentelemetry::metrics::BoundCounter<double>> Bind(
       const opentelemetry::common::KeyValueIterable &attributes) noexcept override;
@@ -155,6 +166,9 @@ class LongHistogram : public Synchronous, public opentelemetry::metrics::Histogr
               const opentelemetry::common::KeyValueIterable &attributes) noexcept override;
 
   void Record(uint64_t value) noexcept override;
+
+  void RecordBatch(opentelemetry::nostd::span<const uint64_t> values,
+                   const opentelemetry::common::KeyValueIterable &attributes) noexcept override;
 #endif
 
 #ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
@@ -180,6 +194,9 @@ class DoubleHistogram : public Synchronous, public opentelemetry::metrics::Histo
               const opentelemetry::common::KeyValueIterable &attributes) noexcept override;
 
   void Record(double value) noexcept override;
+
+  void RecordBatch(opentelemetry::nostd::span<const double> values,
+                   const opentelemetry::common::KeyValueIterable &attributes) noexcept override;
 #endif
 
 #ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
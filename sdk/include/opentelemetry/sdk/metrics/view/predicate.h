@@ -3,14 +3,11 @@
 
 #pragma once
 
-#include <vector>
-#include "opentelemetry/common/macros.h"
-#include "opentelemetry/nostd/string_view.h"
-#include "opentelemetry/sdk/common/global_log_handler.h"
+#include <cstddef>
+#include <string>
 
-#if OPENTELEMETRY_HAVE_WORKING_REGEX
-#  include <regex>
-#endif
+#include "opentelemetry/nostd/string_view.h"
+#include "opentelemetry/version.h"
 
 OPENTELEMETRY_BEGIN_NAMESPACE
 namespace sdk
@@ -30,30 +27,139 @@ class Predicate
   virtual ~Predicate() = default;
 
   virtual bool Match(opentelemetry::nostd::string_view string) const noexcept = 0;
+
+  /**
+   * @return the only string matched by the predicate, or nullptr if it matches any other string.
+   * This allows indexing the predicates by the string they match.
+   */
+  virtual const std::string *GetExactMatch() const noexcept { return nullptr; }
 };
 
+/**
+ * Match a wildcard pattern, in which '*' matches any sequence of characters, including an empty
+ * one, and '?' matches any single character. The other characters match themselves.
+ *
+ * The pattern is compiled once: consecutive '*' are collapsed, and the number of characters
+ * required by the pattern is computed to reject the shorter strings without scanning them. The
+ * match itself is a linear scan, which only backtracks to the last '*' seen.
+ */
 class PatternPredicate : public Predicate
 {
 public:
-  PatternPredicate(opentelemetry::nostd::string_view pattern) : reg_key_{pattern.data()} {}
+  PatternPredicate(opentelemetry::nostd::string_view pattern)
+  {
+    pattern_.reserve(pattern.size());
+    for (char c : pattern)
+    {
+      if (c == '*')
+      {
+        if (!pattern_.empty() && pattern_.back() == '*')
+        {
+          continue;
+        }
+      }
+      else
+      {
+        min_size_++;
+      }
+      pattern_.push_back(c);
+    }
+  }
+
   bool Match(opentelemetry::nostd::string_view str) const noexcept override
   {
-#if OPENTELEMETRY_HAVE_WORKING_REGEX
-    return std::regex_match(str.data(), reg_key_);
-#else
-    // TBD - Support regex match for GCC4.8
-    OTEL_INTERNAL_LOG_ERROR(
-        "PatternPredicate::Match - failed. std::regex not fully supported for this compiler.");
-    return false;  // not supported
-#endif
+    if (str.size() < min_size_)
+    {
+      return false;
+    }
+    const size_t pattern_size = pattern_.size();
+    size_t p                  = 0;
+    size_t s                  = 0;
+    size_t star               = kNoStar;
+    size_t star_s             = 0;
+    while (s < str.size())
+    {
+      if (p < pattern_size && pattern_[p] == '*')
+      {
+        // Match an empty sequence first, and extend it when the rest of the pattern fails.
+        star   = p++;
+        star_s = s;
+      }
+      else if (p < pattern_size && (pattern_[p] == '?' || pattern_[p] == str[s]))
+      {
+        p++;
+        s++;
+      }
+      else if (star != kNoStar)
+      {
+        p = star + 1;
+        s = ++star_s;
+      }
+      else
+      {
+        return false;
+      }
+    }
+    return p == pattern_size || (p + 1 == pattern_size && pattern_[p] == '*');
+  }
+
+  /**
+   * @return true if the pattern contains a wildcard.
+   */
+  static bool HasWildcard(opentelemetry::nostd::string_view pattern) noexcept
+  {
+    for (char c : pattern)
+    {
+      if (c == '*' || c == '?')
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @return true if the pattern contains regular expression syntax, which instrument name patterns
+   * used to be interpreted with: a metacharacter other than '.', '*' and '?', ".+", or a leading
+   * ".*". A ".*" after a name component, as in "http.*", is a valid wildcard pattern.
+   */
+  static bool HasRegexSyntax(opentelemetry::nostd::string_view pattern) noexcept
+  {
+    for (size_t i = 0; i < pattern.size(); i++)
+    {
+      switch (pattern[i])
+      {
+        case '\\':
+        case '^':
+        case '$':
+        case '|':
+        case '+':
+        case '(':
+        case ')':
+        case '[':
+        case ']':
+        case '{':
+        case '}':
+          return true;
+        case '.':
+          if (i + 1 < pattern.size() &&
+              (pattern[i + 1] == '+' || (i == 0 && pattern[i + 1] == '*')))
+          {
+            return true;
+          }
+          break;
+        default:
+          break;
+      }
+    }
+    return false;
   }
 
 private:
-#if OPENTELEMETRY_HAVE_WORKING_REGEX
-  std::regex reg_key_;
-#else
-  std::string reg_key_;
-#endif
+  static constexpr size_t kNoStar = static_cast<size_t>(-1);
+
+  std::string pattern_;
+  size_t min_size_ = 0;
 };
 
 class ExactPredicate : public Predicate
@@ -69,6 +175,8 @@ class ExactPredicate : public Predicate
     return false;
   }
 
+  const std::string *GetExactMatch() const noexcept override { return &pattern_; }
+
 private:
   std::string pattern_;
 };
@@ -6,6 +6,7 @@
 #include <memory>
 
 #include "opentelemetry/nostd/string_view.h"
+#include "opentelemetry/sdk/common/global_log_handler.h"
 #include "opentelemetry/sdk/metrics/view/predicate.h"
 #include "opentelemetry/version.h"
 
@@ -34,6 +35,19 @@ class PredicateFactory
     }
     if (type == PredicateType::kPattern)
     {
+      if (PatternPredicate::HasRegexSyntax(pattern))
+      {
+        OTEL_INTERNAL_LOG_WARN("[PredicateFactory::GetPredicate] The instrument name pattern \""
+                               << pattern
+                               << "\" looks like a regular expression. Instrument name patterns "
+                                  "are wildcard patterns, where only '*' and '?' are special: "
+                                  "the pattern may not match the expected instruments.");
+      }
+      // A pattern without wildcard only matches itself.
+      if (!PatternPredicate::HasWildcard(pattern))
+      {
+        return std::unique_ptr<Predicate>(new ExactPredicate(pattern));
+      }
       return std::unique_ptr<Predicate>(new PatternPredicate(pattern));
     }
     if (type == PredicateType::kExact)
@@ -3,7 +3,10 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "opentelemetry/nostd/function_ref.h"
@@ -54,6 +57,11 @@ class ViewRegistry
 
 private:
   std::vector<std::unique_ptr<RegisteredView>> registered_views_;
+  // The indexes in registered_views_ of the views selecting an instrument by its exact name, and
+  // of the other views, in registration order. FindViews() only matches the views indexed by the
+  // name of the instrument, and the views with a wildcard.
+  std::unordered_map<std::string, std::vector<size_t>> views_by_instrument_name_;
+  std::vector<size_t> wildcard_views_;
 
   static bool MatchMeter(
       opentelemetry::sdk::metrics::MeterSelector *selector,
@@ -8,9 +8,11 @@
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 #include "opentelemetry/sdk/common/circular_buffer.h"
 #include "opentelemetry/sdk/trace/batch_span_processor_options.h"
@@ -27,6 +29,8 @@ namespace sdk
 namespace trace
 {
 
+class RecordablePool;
+
 /**
  * This is an implementation of the SpanProcessor which creates batches of finished spans and passes
  * the export-friendly span data representations to the configured SpanExporter.
@@ -62,7 +66,8 @@ class BatchSpanProcessor : public SpanProcessor
   BatchSpanProcessor &operator=(BatchSpanProcessor &&)      = delete;
 
   /**
-   * Requests a Recordable(Span) from the configured exporter.
+   * Requests a Recordable(Span) from the configured exporter, or reuses an exported one when
+   * BatchSpanProcessorOptions::recordable_pool_size is set.
    *
    * @return A recordable generated by the backend exporter
    */
@@ -142,6 +147,33 @@ class BatchSpanProcessor : public SpanProcessor
    */
   void DrainQueue();
 
+  /**
+   * Passes a batch of spans to the exporter, then notifies the completion of force flush. With
+   * several export batches in flight, the batch is queued for the export thread instead, and spans
+   * is replaced by an empty vector to fill the next batch.
+   */
+  void SubmitBatch(std::vector<std::unique_ptr<Recordable>> &spans,
+                   std::uint64_t notify_force_flush);
+
+  /**
+   * Exports a batch of spans, then notifies the completion of force flush. A notify_force_flush of
+   * 0 only exports the batch.
+   */
+  void ExportBatch(std::vector<std::unique_ptr<Recordable>> &spans,
+                   std::uint64_t notify_force_flush);
+
+  /**
+   * Starts one export thread per batch the exporter can export concurrently, up to the number of
+   * export batches in flight.
+   */
+  void StartExportThreads();
+
+  /**
+   * The background routine performed by the export threads, when several export batches are in
+   * flight.
+   */
+  void DoExportWork();
+
   struct SynchronizationData
   {
     /* Synchronization primitives */
@@ -161,6 +193,42 @@ class BatchSpanProcessor : public SpanProcessor
     inline SynchronizationData() {}
   };
 
+  struct ExportBatchData
+  {
+    std::vector<std::unique_ptr<Recordable>> spans;
+    std::uint64_t notify_force_flush = 0;
+    /* The index of the batch in the order the batches were taken from the queue */
+    std::uint64_t id = 0;
+  };
+
+  struct ExportCompletionData
+  {
+    std::uint64_t notify_force_flush;
+    bool is_exported;
+  };
+
+  struct ExportPipelineData
+  {
+    std::mutex m;
+    /* Notified when a batch is queued or exported, and when the pipeline is closed */
+    std::condition_variable cv;
+
+    /* The batches waiting for the export threads, in the order they were taken from the queue */
+    std::deque<ExportBatchData> batches;
+    /* The number of batches queued or being exported */
+    size_t in_flight = 0;
+    /* The vectors of the exported batches, kept to fill the next batches */
+    std::vector<std::vector<std::unique_ptr<Recordable>>> free_batches;
+    /* The batches not notified yet, from the batch first_completion_id on. Force flush is only
+     * notified once the batches taken from the queue before are exported too. */
+    std::deque<ExportCompletionData> completions;
+    std::uint64_t first_completion_id = 0;
+    std::uint64_t next_batch_id       = 0;
+    /* The number of export threads not finished yet */
+    size_t running_threads = 0;
+    bool is_closed         = false;
+  };
+
   /**
    * @brief Notify completion of shutdown and force flush. This may be called from the any thread at
    * any time
@@ -182,15 +250,30 @@ class BatchSpanProcessor : public SpanProcessor
   const size_t max_queue_size_;
   const std::chrono::milliseconds schedule_delay_millis_;
   const size_t max_export_batch_size_;
+  const size_t max_export_batches_in_flight_;
 
   /* The buffer/queue to which the ended spans are added */
   opentelemetry::sdk::common::CircularBuffer<Recordable> buffer_;
 
+  /* The exported recordables kept for reuse, null when they are not reused */
+  std::shared_ptr<RecordablePool> recordable_pool_;
+
+  /* The spans of the batch being filled, only used by the worker thread */
+  std::vector<std::unique_ptr<Recordable>> export_batch_;
+
+  /* The last force flush sequence submitted for export, only used by the worker thread */
+  std::uint64_t force_flush_submitted_sequence_ = 0;
+
   std::shared_ptr<SynchronizationData> synchronization_data_;
 
   /* The background worker thread */
   std::shared_ptr<sdk::common::ThreadInstrumentation> worker_thread_instrumentation_;
   std::thread worker_thread_;
+
+  /* The batches handed over to the export threads, null with a single export batch in flight */
+  std::unique_ptr<ExportPipelineData> export_pipeline_;
+  std::shared_ptr<sdk::common::ThreadInstrumentation> export_thread_instrumentation_;
+  std::vector<std::thread> export_threads_;
 };
 
 }  // namespace trace
@@ -86,6 +86,22 @@ struct OPENTELEMETRY_EXPORT BatchSpanProcessorOptions
    * equal to max_queue_size.
    */
   size_t max_export_batch_size = batch_span_processor_options_env::GetMaxExportBatchSizeFromEnv();
+
+  /**
+   * The maximum number of exported recordables kept for reuse by the spans started next, 0 by
+   * default. Only the SpanData recordables left in place by the exporter are reused, 0 disables
+   * the reuse.
+   */
+  size_t recordable_pool_size = 0;
+
+  /**
+   * The maximum number of batches taken from the queue and not exported yet, 1 by default. Above
+   * 1, dedicated threads export the batches, while the worker thread keeps on draining the queue
+   * into the next batches. Up to SpanExporter::GetMaxConcurrentExports() batches are exported at
+   * once, in no particular order. With a single concurrent export, the batches are exported in
+   * order.
+   */
+  size_t max_export_batches_in_flight = 1;
 };
 
 }  // namespace trace
@@ -22,6 +22,10 @@ struct BatchSpanProcessorRuntimeOptions
 {
   std::shared_ptr<sdk::common::ThreadInstrumentation> thread_instrumentation =
       std::shared_ptr<sdk::common::ThreadInstrumentation>(nullptr);
+
+  /* Instruments the export threads, when several export batches are in flight */
+  std::shared_ptr<sdk::common::ThreadInstrumentation> export_thread_instrumentation =
+      std::shared_ptr<sdk::common::ThreadInstrumentation>(nullptr);
 };
 
 }  // namespace trace
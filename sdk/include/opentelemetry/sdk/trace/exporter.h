@@ -4,6 +4,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <memory>
 
 #include "opentelemetry/nostd/span.h"
@@ -52,6 +53,14 @@ class OPENTELEMETRY_EXPORT SpanExporter
   virtual sdk::common::ExportResult Export(
       const nostd::span<std::unique_ptr<Recordable>> &spans) noexcept = 0;
 
+  /**
+   * Returns the maximum number of Export() calls which may run concurrently for this exporter
+   * instance, 1 by default. Exporters which send their batches asynchronously may allow more, so
+   * that a BatchSpanProcessor exports several batches at once.
+   * @return the maximum number of concurrent Export() calls
+   */
+  virtual std::size_t GetMaxConcurrentExports() const noexcept { return 1; }
+
   /**
    * Export all spans that have been exported.
    * @param timeout an optional timeout, the default timeout means that no
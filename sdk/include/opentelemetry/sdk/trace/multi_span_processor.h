@@ -63,6 +63,19 @@ class MultiSpanProcessor : public SpanProcessor
     }
   }
 
+  /**
+   * Obtain the processor recording the spans started now: the only processor when there is one,
+   * so that its recordables are not wrapped in a MultiRecordable, else this processor.
+   */
+  SpanProcessor &GetRecordingProcessor() noexcept
+  {
+    if (count_ == 1)
+    {
+      return *head_->value_;
+    }
+    return *this;
+  }
+
   std::unique_ptr<Recordable> MakeRecordable() noexcept override
   {
     auto recordable       = std::unique_ptr<Recordable>(new MultiRecordable);
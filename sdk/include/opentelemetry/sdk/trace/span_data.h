@@ -8,7 +8,6 @@
 #include <map>
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -18,6 +17,7 @@
 #include "opentelemetry/common/timestamp.h"
 #include "opentelemetry/nostd/string_view.h"
 #include "opentelemetry/sdk/common/attribute_utils.h"
+#include "opentelemetry/sdk/common/flat_attribute_map.h"
 #include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
 #include "opentelemetry/sdk/resource/resource.h"
 #include "opentelemetry/sdk/trace/recordable.h"
@@ -34,6 +34,16 @@ namespace sdk
 {
 namespace trace
 {
+/**
+ * The attributes of a span, stored inline up to 8 attributes.
+ */
+using SpanDataAttributes = opentelemetry::sdk::common::FlatAttributeMap<8>;
+
+/**
+ * The attributes of an event or a link, stored inline up to 2 attributes.
+ */
+using SpanDataEventAttributes = opentelemetry::sdk::common::FlatAttributeMap<2>;
+
 /**
  * Class for storing events in SpanData.
  */
@@ -63,8 +73,7 @@ class SpanDataEvent
    * Get the attributes for this event
    * @return the attributes for this event
    */
-  const std::unordered_map<std::string, opentelemetry::sdk::common::OwnedAttributeValue> &
-  GetAttributes() const noexcept;
+  const SpanDataEventAttributes &GetAttributes() const noexcept;
 
   /**
    * Get the number of attributes dropped due to the per-event attribute count limit.
@@ -75,7 +84,7 @@ class SpanDataEvent
 private:
   std::string name_;
   opentelemetry::common::SystemTimestamp timestamp_;
-  opentelemetry::sdk::common::AttributeMap attribute_map_;
+  SpanDataEventAttributes attribute_map_;
   std::uint32_t dropped_attributes_count_{0};
 };
 
@@ -95,8 +104,7 @@ class SpanDataLink
    * Get the attributes for this link
    * @return the attributes for this link
    */
-  const std::unordered_map<std::string, opentelemetry::sdk::common::OwnedAttributeValue> &
-  GetAttributes() const noexcept;
+  const SpanDataEventAttributes &GetAttributes() const noexcept;
 
   /**
    * Get the span context for this link
@@ -113,7 +121,7 @@ class SpanDataLink
 
 private:
   opentelemetry::trace::SpanContext span_context_;
-  opentelemetry::sdk::common::AttributeMap attribute_map_;
+  SpanDataEventAttributes attribute_map_;
   std::uint32_t dropped_attributes_count_{0};
 };
 
@@ -212,8 +220,7 @@ class SpanData final : public Recordable
    * Get the attributes for this span
    * @return the attributes for this span
    */
-  const std::unordered_map<std::string, opentelemetry::sdk::common::OwnedAttributeValue> &
-  GetAttributes() const noexcept;
+  const SpanDataAttributes &GetAttributes() const noexcept;
 
   /**
    * Get the events associated with this span
@@ -268,6 +275,14 @@ class SpanData final : public Recordable
 
   std::uint32_t GetDroppedLinksCount() const noexcept { return dropped_links_count_; }
 
+  explicit operator SpanData *() const override { return const_cast<SpanData *>(this); }
+
+  /**
+   * Reset this span data to the state of a default constructed one, keeping the memory reserved
+   * for its name, description, events and links, so that it can record another span.
+   */
+  void Reset() noexcept;
+
 private:
   opentelemetry::trace::SpanContext span_context_{false, false};
   opentelemetry::trace::SpanId parent_span_id_;
@@ -276,7 +291,7 @@ class SpanData final : public Recordable
   std::string name_;
   opentelemetry::trace::StatusCode status_code_{opentelemetry::trace::StatusCode::kUnset};
   std::string status_desc_;
-  opentelemetry::sdk::common::AttributeMap attribute_map_;
+  SpanDataAttributes attribute_map_;
   std::vector<SpanDataEvent> events_;
   std::vector<SpanDataLink> links_;
   opentelemetry::trace::TraceFlags flags_;
@@ -84,6 +84,15 @@ class Tracer final : public opentelemetry::trace::Tracer,
   /** Returns the configured span processor. */
   SpanProcessor &GetProcessor() noexcept { return context_->GetProcessor(); }
 
+  /** Returns the span processor recording the spans started now. */
+  SpanProcessor &GetRecordingProcessor() noexcept { return context_->GetRecordingProcessor(); }
+
+  /** Returns whether the spans started now are thread-confined. */
+  bool IsSpanThreadConfined() const noexcept
+  {
+    return span_thread_confined_.load(std::memory_order_relaxed);
+  }
+
   /** Returns the configured span limits. */
   const SpanLimits &GetSpanLimits() const noexcept { return context_->GetSpanLimits(); }
 
@@ -138,6 +147,8 @@ class Tracer final : public opentelemetry::trace::Tracer,
   std::shared_ptr<TracerContext> context_;
   mutable std::mutex tracer_config_mutex_;
   TracerConfig tracer_config_;
+  // Copy of tracer_config_.IsSpanThreadConfined(), read without locking when starting a span.
+  std::atomic<bool> span_thread_confined_{false};
 #if OPENTELEMETRY_ABI_VERSION_NO < 2
   std::atomic<bool> is_enabled_{false};
 #endif
@@ -27,6 +27,14 @@ class OPENTELEMETRY_EXPORT TracerConfig
    */
   bool IsEnabled() const noexcept;
 
+  /**
+   * Returns if the spans of the Tracer are thread-confined. A thread-confined span is started,
+   * modified and ended by a single thread, so its operations do not lock it. Debug builds assert
+   * that the span is not used by another thread.
+   * @return a boolean indicating if the spans are thread-confined. Defaults to false.
+   */
+  bool IsSpanThreadConfined() const noexcept;
+
   /**
    * Returns a TracerConfig that represents a disabled Tracer. A disabled tracer behaves like a
    * no-op tracer.
@@ -48,9 +56,20 @@ class OPENTELEMETRY_EXPORT TracerConfig
    */
   static TracerConfig Default();
 
+  /**
+   * Returns a TracerConfig that represents an enabled Tracer whose spans are thread-confined.
+   * Spans started by such a Tracer must not be shared between threads.
+   * @return a static constant TracerConfig that represents an enabled tracer with thread-confined
+   * spans.
+   */
+  static TracerConfig ThreadConfinedSpans();
+
 private:
-  explicit TracerConfig(const bool enabled = true) : enabled_(enabled) {}
+  explicit TracerConfig(const bool enabled = true, const bool span_thread_confined = false)
+      : enabled_(enabled), span_thread_confined_(span_thread_confined)
+  {}
   bool enabled_;
+  bool span_thread_confined_;
 };
 }  // namespace trace
 }  // namespace sdk
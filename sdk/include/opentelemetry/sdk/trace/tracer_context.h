@@ -4,6 +4,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -85,6 +86,15 @@ class TracerContext
    */
   SpanProcessor &GetProcessor() const noexcept;
 
+  /**
+   * Obtain the processor recording the spans started now.
+   *
+   * Note: When only one processor is active, this returns it rather than the "aggregate"
+   * processor. A span must be ended with the processor it was started with, even if processors
+   * were added meanwhile.
+   */
+  SpanProcessor &GetRecordingProcessor() const noexcept;
+
   /**
    * Obtain the resource associated with this tracer context.
    * @return The resource for this tracer context.
@@ -119,6 +129,29 @@ class TracerContext
   void SetTracerConfigurator(std::unique_ptr<instrumentationscope::ScopeConfigurator<TracerConfig>>
                                  tracer_configurator) noexcept;
 
+  /**
+   * Obtain the number of freed spans kept by each thread for reuse.
+   * @return The span pool size for this tracer context, 0 when spans are not pooled.
+   */
+  std::size_t GetSpanPoolSize() const noexcept;
+
+  /**
+   * Set the number of freed spans kept by each thread for reuse, 0 by default.
+   *
+   * When set, the memory of a span is not released when the span is destroyed but kept by the
+   * destroying thread, up to span_pool_size spans, and the next spans started on that thread reuse
+   * it instead of allocating. Combined with a BatchSpanProcessor recycling the exported
+   * recordables, see BatchSpanProcessorOptions::recordable_pool_size, starting a span then
+   * performs no allocation in the steady state.
+   *
+   * The pool needs exceptions to report allocation failures: when the SDK is built without
+   * exceptions, the span pool size is ignored and a warning is logged.
+   *
+   * Note: This method is not thread safe.
+   * @param span_pool_size The number of spans kept by each thread, 0 disables the pooling.
+   */
+  void SetSpanPoolSize(std::size_t span_pool_size) noexcept;
+
   /**
    * Force all active SpanProcessors to flush any buffered spans
    * within the given timeout.
@@ -138,6 +171,7 @@ class TracerContext
   std::unique_ptr<SpanProcessor> processor_;
   std::unique_ptr<instrumentationscope::ScopeConfigurator<TracerConfig>> tracer_configurator_;
   SpanLimits span_limits_;
+  std::size_t span_pool_size_ = 0;
 };
 
 }  // namespace trace
@@ -12,6 +12,7 @@
 #include <utility>
 
 #include "opentelemetry/common/spin_lock_mutex.h"
+#include "opentelemetry/nostd/span.h"
 #include "opentelemetry/nostd/variant.h"
 #include "opentelemetry/sdk/common/global_log_handler.h"
 #include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
@@ -215,6 +216,68 @@ void Base2ExponentialHistogramAggregation::Aggregate(
   }
 }
 
+void Base2ExponentialHistogramAggregation::AggregateBatch(
+    nostd::span<const int64_t> values) noexcept
+{
+  AggregateValues(values);
+}
+
+void Base2ExponentialHistogramAggregation::AggregateBatch(nostd::span<const double> values) noexcept
+{
+  AggregateValues(values);
+}
+
+template <class T>
+void Base2ExponentialHistogramAggregation::AggregateValues(nostd::span<const T> values) noexcept
+{
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  // The sum, min, max and zero count of the whole batch are computed first, in a loop without
+  // side effects which the compiler can vectorize. Only the non-zero values are then indexed.
+  double sum          = point_data_.sum_;
+  double min          = point_data_.min_;
+  double max          = point_data_.max_;
+  uint64_t zero_count = 0;
+  for (T raw_value : values)
+  {
+    const double value = static_cast<double>(raw_value);
+    sum += value;
+    min = (std::min)(min, value);
+    max = (std::max)(max, value);
+    zero_count += static_cast<uint64_t>(value == 0);
+  }
+  point_data_.sum_ = sum;
+  point_data_.count_ += values.size();
+  point_data_.zero_count_ += zero_count;
+  if (record_min_max_)
+  {
+    point_data_.min_ = min;
+    point_data_.max_ = max;
+  }
+
+  for (T raw_value : values)
+  {
+    const double value = static_cast<double>(raw_value);
+    if (value == 0)
+    {
+      continue;
+    }
+    else if (value > 0)
+    {
+      if (point_data_.positive_buckets_)
+      {
+        AggregateIntoBuckets(point_data_.positive_buckets_, value);
+      }
+    }
+    else
+    {
+      if (point_data_.negative_buckets_)
+      {
+        AggregateIntoBuckets(point_data_.negative_buckets_, -value);
+      }
+    }
+  }
+}
+
 void Base2ExponentialHistogramAggregation::AggregateIntoBuckets(
     std::unique_ptr<AdaptingCircularBufferCounter> &buckets,
     double value) noexcept
@@ -262,64 +325,69 @@ void Base2ExponentialHistogramAggregation::Downscale(uint32_t by) noexcept
   indexer_ = Base2ExponentialHistogramIndexer(point_data_.scale_);
 }
 
-// Merge A and B into a new circular buffer C.
+// Merge B into A. A is merged in place when it has max_buckets buckets, otherwise it is replaced
+// by a new circular buffer C with max_buckets buckets.
 // Caller must ensure that A and B are used as buckets at the same scale.
-static AdaptingCircularBufferCounter MergeBuckets(size_t max_buckets,
-                                                  const AdaptingCircularBufferCounter &A,
-                                                  const AdaptingCircularBufferCounter &B)
+static void MergeBuckets(size_t max_buckets,
+                         std::unique_ptr<AdaptingCircularBufferCounter> &A,
+                         const AdaptingCircularBufferCounter &B)
 {
-  AdaptingCircularBufferCounter C = AdaptingCircularBufferCounter(max_buckets);
-  C.Clear();
-
-  if (A.Empty() && B.Empty())
+  if (A->Empty() && B.Empty())
   {
-    return C;
+    A = std::make_unique<AdaptingCircularBufferCounter>(max_buckets);
+    A->Clear();
+    return;
   }
-  if (A.Empty())
+  if (A->Empty())
   {
-    return B;
+    A = std::make_unique<AdaptingCircularBufferCounter>(B);
+    return;
   }
   if (B.Empty())
   {
-    return A;
+    return;
   }
 
-  auto min_index = (std::min)(A.StartIndex(), B.StartIndex());
-  auto max_index = (std::max)(A.EndIndex(), B.EndIndex());
-
-  for (int i = min_index; i <= max_index; i++)
+  // Merging into A keeps the cell width of its counts, and the counts of B are then added in a
+  // single pass over the cells of both counters.
+  bool merged = true;
+  if (A->MaxSize() == max_buckets)
+  {
+    merged = A->MergeFrom(B);
+  }
+  else
   {
-    auto count = A.Get(i) + B.Get(i);
-    if (count > 0)
+    auto C = std::make_unique<AdaptingCircularBufferCounter>(max_buckets);
+    C->Clear();
+    merged = C->MergeFrom(*A) && C->MergeFrom(B);
+    if (merged)
     {
-      if (!C.Increment(i, count))
-      {
-        OTEL_INTERNAL_LOG_ERROR("[Base2ExponentialHistogramAggregation::MergeBuckets] bucket index "
-                                << i << " out of range; count " << count
-                                << " dropped. SDK invariant violation");
-        assert(false && "MergeBuckets: bucket index out of range");
-      }
+      A = std::move(C);
     }
   }
-
-  return C;
+  if (!merged)
+  {
+    OTEL_INTERNAL_LOG_ERROR("[Base2ExponentialHistogramAggregation::MergeBuckets] bucket range ["
+                            << (std::min)(A->StartIndex(), B.StartIndex()) << ", "
+                            << (std::max)(A->EndIndex(), B.EndIndex())
+                            << "] out of range; counts dropped. SDK invariant violation");
+    assert(false && "MergeBuckets: bucket index out of range");
+  }
 }
 
-std::unique_ptr<Aggregation> Base2ExponentialHistogramAggregation::Merge(
-    const Aggregation &delta) const noexcept
+// Merge the point data of two aggregations. Both are modified, and the result may reuse the
+// buckets of either of them.
+static Base2ExponentialHistogramPointData MergePointData(Base2ExponentialHistogramPointData &left,
+                                                         Base2ExponentialHistogramPointData &right)
 {
-  auto left  = nostd::get<Base2ExponentialHistogramPointData>(ToPoint());
-  auto right = nostd::get<Base2ExponentialHistogramPointData>(
-      (static_cast<const Base2ExponentialHistogramAggregation &>(delta).ToPoint()));
-
   if (left.count_ == 0)
   {
-    return std::make_unique<Base2ExponentialHistogramAggregation>(std::move(right));
+    return std::move(right);
   }
 
   if (right.count_ == 0)
   {
-    return std::make_unique<Base2ExponentialHistogramAggregation>(std::move(left));
+    return std::move(left);
   }
 
   auto &low_res  = left.scale_ < right.scale_ ? left : right;
@@ -370,13 +438,39 @@ std::unique_ptr<Aggregation> Base2ExponentialHistogramAggregation::Merge(
     result_value.scale_ -= static_cast<int32_t>(scale_reduction);
   }
 
-  result_value.positive_buckets_ = std::make_unique<AdaptingCircularBufferCounter>(MergeBuckets(
-      result_value.max_buckets_, *low_res.positive_buckets_, *high_res.positive_buckets_));
-  result_value.negative_buckets_ = std::make_unique<AdaptingCircularBufferCounter>(MergeBuckets(
-      result_value.max_buckets_, *low_res.negative_buckets_, *high_res.negative_buckets_));
+  MergeBuckets(result_value.max_buckets_, low_res.positive_buckets_, *high_res.positive_buckets_);
+  MergeBuckets(result_value.max_buckets_, low_res.negative_buckets_, *high_res.negative_buckets_);
+  result_value.positive_buckets_ = std::move(low_res.positive_buckets_);
+  result_value.negative_buckets_ = std::move(low_res.negative_buckets_);
 
-  return std::unique_ptr<Base2ExponentialHistogramAggregation>{
-      new Base2ExponentialHistogramAggregation(std::move(result_value))};
+  return result_value;
+}
+
+std::unique_ptr<Aggregation> Base2ExponentialHistogramAggregation::Merge(
+    const Aggregation &delta) const noexcept
+{
+  auto left  = nostd::get<Base2ExponentialHistogramPointData>(ToPoint());
+  auto right = nostd::get<Base2ExponentialHistogramPointData>(
+      (static_cast<const Base2ExponentialHistogramAggregation &>(delta).ToPoint()));
+
+  return std::make_unique<Base2ExponentialHistogramAggregation>(MergePointData(left, right));
+}
+
+bool Base2ExponentialHistogramAggregation::MergeFrom(const Aggregation &delta) noexcept
+{
+  if (&delta == this)
+  {
+    return false;
+  }
+  auto right = nostd::get<Base2ExponentialHistogramPointData>(
+      (static_cast<const Base2ExponentialHistogramAggregation &>(delta).ToPoint()));
+
+  // The buckets of this aggregation are merged in place when they are large enough.
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  point_data_     = MergePointData(point_data_, right);
+  indexer_        = Base2ExponentialHistogramIndexer(point_data_.scale_);
+  record_min_max_ = point_data_.record_min_max_;
+  return true;
 }
 
 std::unique_ptr<Aggregation> Base2ExponentialHistogramAggregation::Diff(
@@ -483,6 +577,21 @@ PointType Base2ExponentialHistogramAggregation::ToPoint() const noexcept
   return copy;
 }
 
+size_t Base2ExponentialHistogramAggregation::GetMemoryUsage() const noexcept
+{
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  size_t usage = sizeof(*this);
+  if (point_data_.positive_buckets_)
+  {
+    usage += sizeof(AdaptingCircularBufferCounter) + point_data_.positive_buckets_->MemoryUsage();
+  }
+  if (point_data_.negative_buckets_)
+  {
+    usage += sizeof(AdaptingCircularBufferCounter) + point_data_.negative_buckets_->MemoryUsage();
+  }
+  return usage;
+}
+
 }  // namespace metrics
 }  // namespace sdk
 OPENTELEMETRY_END_NAMESPACE
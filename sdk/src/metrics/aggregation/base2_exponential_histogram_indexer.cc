@@ -4,6 +4,10 @@
 #include "opentelemetry/sdk/metrics/aggregation/base2_exponential_histogram_indexer.h"
 
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
 
 OPENTELEMETRY_BEGIN_NAMESPACE
 namespace sdk
@@ -16,11 +20,23 @@ namespace
 
 const double kLogBase2E = 1.0 / std::log(2.0);
 
+constexpr int kMantissaWidth         = 52;
+constexpr uint64_t kMantissaMask     = (uint64_t{1} << kMantissaWidth) - 1;
+constexpr int32_t kExponentBias      = 1023;
+constexpr uint64_t kMaxExponentField = 0x7ff;
+
 double ComputeScaleFactor(int32_t scale)
 {
   return std::scalbn(kLogBase2E, scale);
 }
 
+uint64_t ToBits(double value)
+{
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
 // Compute the bucket index using a logarithm based approach.
 int32_t GetIndexByLogarithm(double value, double scale_factor)
 {
@@ -45,25 +61,111 @@ int32_t MapToIndexScaleZero(double value)
   return exp;
 }
 
+struct LookupTable
+{
+  std::vector<uint64_t> boundaries;
+  std::vector<uint16_t> slices;
+};
+
+// Bucket k of a power of two at the given scale starts at 2^(k / 2^scale). The buckets are wider
+// than the slices of the mantissa range, so that a slice overlaps at most two buckets, and the
+// bucket of a mantissa is either the bucket of the start of its slice or the next one.
+LookupTable BuildLookupTable(int32_t scale)
+{
+  const size_t bucket_count = size_t{1} << scale;
+  const size_t slice_count  = bucket_count << 1;
+  const int slice_shift     = kMantissaWidth - scale - 1;
+  LookupTable table;
+  table.boundaries.resize(bucket_count);
+  for (size_t k = 0; k < bucket_count; ++k)
+  {
+    const double boundary =
+        std::exp2(static_cast<double>(k) / static_cast<double>(bucket_count));
+    table.boundaries[k] = ToBits(boundary) & kMantissaMask;
+  }
+  // A mantissa equal to the lower boundary of a bucket belongs to the previous bucket, so the
+  // slice start maps to the number of boundaries strictly lower than it.
+  table.slices.resize(slice_count);
+  size_t bucket = 0;
+  for (size_t j = 0; j < slice_count; ++j)
+  {
+    const uint64_t slice_start = static_cast<uint64_t>(j) << slice_shift;
+    while (bucket + 1 < bucket_count && table.boundaries[bucket + 1] < slice_start)
+    {
+      ++bucket;
+    }
+    table.slices[j] = static_cast<uint16_t>(bucket);
+  }
+  return table;
+}
+
+const LookupTable *GetLookupTable(int32_t scale)
+{
+  static const std::vector<LookupTable> tables = []() {
+    std::vector<LookupTable> result;
+    for (int32_t s = 1; s <= Base2ExponentialHistogramIndexer::kMaxLookupScale; ++s)
+    {
+      result.push_back(BuildLookupTable(s));
+    }
+    return result;
+  }();
+  if (scale < 1 || scale > Base2ExponentialHistogramIndexer::kMaxLookupScale)
+  {
+    return nullptr;
+  }
+  return &tables[static_cast<size_t>(scale - 1)];
+}
+
 }  // namespace
 
 Base2ExponentialHistogramIndexer::Base2ExponentialHistogramIndexer(int32_t scale)
     : scale_(scale), scale_factor_(scale > 0 ? ComputeScaleFactor(scale) : 0)
-{}
+{
+  const LookupTable *table = GetLookupTable(scale);
+  if (table != nullptr)
+  {
+    boundaries_ = table->boundaries.data();
+    slices_     = table->slices.data();
+  }
+}
 
 int32_t Base2ExponentialHistogramIndexer::ComputeIndex(double value) const
 {
-  const double abs_value = std::fabs(value);
-  // For positive scales, compute the index by logarithm, which is simpler but may be
-  // inaccurate near bucket boundaries
+  const double abs_value        = std::fabs(value);
+  const uint64_t bits           = ToBits(abs_value);
+  const uint64_t exponent_field = bits >> kMantissaWidth;
+  // Subnormal values, infinities and NaN take the slow path.
+  const bool is_normal = exponent_field != 0 && exponent_field != kMaxExponentField;
+  const uint64_t mantissa = bits & kMantissaMask;
+  const int32_t exponent  = static_cast<int32_t>(exponent_field) - kExponentBias;
+
   if (scale_ > 0)
   {
-    return GetIndexByLogarithm(abs_value, scale_factor_);
+    if (slices_ == nullptr || !is_normal)
+    {
+      // Computing the index by logarithm is simpler but may be inaccurate near bucket boundaries.
+      return GetIndexByLogarithm(abs_value, scale_factor_);
+    }
+    const int32_t octave_index = exponent * (int32_t{1} << scale_);
+    if (mantissa == 0)
+    {
+      // Powers of two are the upper boundary of the last bucket of the previous power of two.
+      return octave_index - 1;
+    }
+    uint32_t bucket = slices_[mantissa >> (kMantissaWidth - scale_ - 1)];
+    if (bucket + 1 < (uint32_t{1} << scale_) && boundaries_[bucket + 1] < mantissa)
+    {
+      ++bucket;
+    }
+    return octave_index + static_cast<int32_t>(bucket);
+  }
+  // For scale zero, compute the exact index from the exponent, minus one for powers of two.
+  // For negative scales, shift the index at scale zero to the right by -scale.
+  if (!is_normal)
+  {
+    return MapToIndexScaleZero(abs_value) >> -scale_;
   }
-  // For scale zero, compute the exact index by extracting the exponent.
-  // For negative scales, compute the exact index by extracting the exponent and shifting it to
-  // the right by -scale
-  return MapToIndexScaleZero(abs_value) >> -scale_;
+  return (exponent - static_cast<int32_t>(mantissa == 0)) >> -scale_;
 }
 
 }  // namespace metrics
@@ -33,6 +33,11 @@ PointType DropAggregation::ToPoint() const noexcept
   return point_data;
 }
 
+bool DropAggregation::Reset() noexcept
+{
+  return true;
+}
+
 }  // namespace metrics
 }  // namespace sdk
 OPENTELEMETRY_END_NAMESPACE
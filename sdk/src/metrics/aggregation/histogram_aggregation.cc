@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
@@ -11,10 +12,13 @@
 #include <vector>
 
 #include "opentelemetry/common/spin_lock_mutex.h"
+#include "opentelemetry/nostd/span.h"
 #include "opentelemetry/nostd/variant.h"
 #include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
 #include "opentelemetry/sdk/metrics/aggregation/aggregation_config.h"
 #include "opentelemetry/sdk/metrics/aggregation/histogram_aggregation.h"
+#include "opentelemetry/sdk/metrics/aggregation/histogram_bucket_indexer.h"
+#include "opentelemetry/sdk/metrics/data/circular_buffer.h"
 #include "opentelemetry/sdk/metrics/data/metric_data.h"
 #include "opentelemetry/sdk/metrics/data/point_data.h"
 #include "opentelemetry/version.h"
@@ -25,41 +29,294 @@ namespace sdk
 namespace metrics
 {
 
+namespace
+{
+
+// The bucket indexer of the default boundaries, shared by the aggregations created without config.
+const std::shared_ptr<const HistogramBucketIndexer> &DefaultBucketIndexer()
+{
+  static const std::shared_ptr<const HistogramBucketIndexer> indexer =
+      std::make_shared<const HistogramBucketIndexer>(
+          HistogramAggregationConfig::DefaultBoundaries());
+  return indexer;
+}
+
+// Initialize the point data of an empty aggregation, with its bucket counts of the given size.
+template <class T>
+void InitPointData(HistogramPointData &point_data, bool record_min_max, size_t bucket_count)
+{
+  point_data.sum_            = static_cast<T>(0);
+  point_data.count_          = 0;
+  point_data.record_min_max_ = record_min_max;
+  point_data.min_            = (std::numeric_limits<T>::max)();
+  point_data.max_            = (std::numeric_limits<T>::min)();
+  point_data.counts_         = std::vector<uint64_t>(bucket_count, 0);
+}
+
+// Words of a cache line in the bucket counts of HistogramThreadCells.
+constexpr size_t kCacheLineCounts = 64 / sizeof(uint64_t);
+
+// Index of the calling thread, assigned the first time it records to a histogram aggregation with
+// thread cells. Threads of a pool get consecutive indexes, and so distinct cells.
+size_t ThreadCellIndex() noexcept
+{
+  static std::atomic<size_t> next_index{0};
+  static thread_local size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+  return index;
+}
+
+void IncrementCount(uint64_t *counts, size_t index) noexcept
+{
+  counts[index] += 1;
+}
+
+void IncrementCount(AdaptingIntegerArray *counts, size_t index) noexcept
+{
+  counts->Increment(index, 1);
+}
+
+// Aggregate a batch of values into the point data, with the same result as aggregating them one
+// by one. The point data is only loaded and stored once for the whole batch.
+template <class T, class Counts>
+void AggregateValues(nostd::span<const T> values,
+                     const HistogramBucketIndexer &indexer,
+                     bool record_min_max,
+                     uint64_t &count,
+                     T &sum,
+                     T &min,
+                     T &max,
+                     Counts counts) noexcept
+{
+  T batch_sum = sum;
+  T batch_min = min;
+  T batch_max = max;
+  for (T value : values)
+  {
+    batch_sum += value;
+    batch_min = (std::min)(batch_min, value);
+    batch_max = (std::max)(batch_max, value);
+    IncrementCount(counts, indexer.ComputeIndex(static_cast<double>(value)));
+  }
+  count += values.size();
+  sum = batch_sum;
+  if (record_min_max)
+  {
+    min = batch_min;
+    max = batch_max;
+  }
+}
+
+// The bucket counts are either those of the point data, or compact_counts when not null.
+template <class T>
+void AggregateValues(nostd::span<const T> values,
+                     const HistogramBucketIndexer &indexer,
+                     bool record_min_max,
+                     HistogramPointData &point_data,
+                     AdaptingIntegerArray *compact_counts) noexcept
+{
+  T sum = nostd::get<T>(point_data.sum_);
+  T min = nostd::get<T>(point_data.min_);
+  T max = nostd::get<T>(point_data.max_);
+  if (compact_counts)
+  {
+    AggregateValues(values, indexer, record_min_max, point_data.count_, sum, min, max,
+                    compact_counts);
+  }
+  else
+  {
+    AggregateValues(values, indexer, record_min_max, point_data.count_, sum, min, max,
+                    point_data.counts_.data());
+  }
+  point_data.sum_ = sum;
+  point_data.min_ = min;
+  point_data.max_ = max;
+}
+
+void IncrementCounts(AdaptingIntegerArray &compact_counts, const std::vector<uint64_t> &counts)
+{
+  for (size_t i = 0; i < counts.size(); i++)
+  {
+    if (counts[i] != 0)
+    {
+      compact_counts.Increment(i, counts[i]);
+    }
+  }
+}
+
+// Widen the compact bucket counts of an aggregation to the counts of its point.
+void ExpandCounts(const AdaptingIntegerArray &compact_counts, std::vector<uint64_t> &counts)
+{
+  counts.resize(compact_counts.Size());
+  for (size_t i = 0; i < counts.size(); i++)
+  {
+    counts[i] = compact_counts.Get(i);
+  }
+}
+
+}  // namespace
+
+template <class T>
+HistogramThreadCells<T>::HistogramThreadCells(size_t cell_count, size_t bucket_count)
+    : cells_(cell_count),
+      stride_((bucket_count + 2 * kCacheLineCounts - 1) / kCacheLineCounts * kCacheLineCounts),
+      counts_(cell_count * stride_, 0)
+{
+  for (size_t i = 0; i < cells_.size(); i++)
+  {
+    ResetCell(i);
+  }
+}
+
+template <class T>
+void HistogramThreadCells<T>::Aggregate(T value, size_t index, bool record_min_max) noexcept
+{
+  const size_t cell_index = ThreadCellIndex() % cells_.size();
+  Cell &cell              = cells_[cell_index];
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(cell.lock);
+  cell.count += 1;
+  cell.sum += value;
+  if (record_min_max)
+  {
+    cell.min = (std::min)(cell.min, value);
+    cell.max = (std::max)(cell.max, value);
+  }
+  counts_[cell_index * stride_ + index] += 1;
+}
+
+template <class T>
+void HistogramThreadCells<T>::AggregateBatch(nostd::span<const T> values,
+                                             const HistogramBucketIndexer &indexer,
+                                             bool record_min_max) noexcept
+{
+  const size_t cell_index = ThreadCellIndex() % cells_.size();
+  Cell &cell              = cells_[cell_index];
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(cell.lock);
+  AggregateValues(values, indexer, record_min_max, cell.count, cell.sum, cell.min, cell.max,
+                  &counts_[cell_index * stride_]);
+}
+
+template <class T>
+void HistogramThreadCells<T>::MergeInto(HistogramPointData &point_data) const noexcept
+{
+  T sum = nostd::get<T>(point_data.sum_);
+  T min = nostd::get<T>(point_data.min_);
+  T max = nostd::get<T>(point_data.max_);
+  for (size_t i = 0; i < cells_.size(); i++)
+  {
+    const Cell &cell = cells_[i];
+    const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(cell.lock);
+    point_data.count_ += cell.count;
+    sum += cell.sum;
+    min = (std::min)(min, cell.min);
+    max = (std::max)(max, cell.max);
+    for (size_t j = 0; j < point_data.counts_.size(); j++)
+    {
+      point_data.counts_[j] += counts_[i * stride_ + j];
+    }
+  }
+  point_data.sum_ = sum;
+  if (point_data.record_min_max_)
+  {
+    point_data.min_ = min;
+    point_data.max_ = max;
+  }
+}
+
+template <class T>
+void HistogramThreadCells<T>::Reset() noexcept
+{
+  for (size_t i = 0; i < cells_.size(); i++)
+  {
+    const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(cells_[i].lock);
+    ResetCell(i);
+  }
+}
+
+template <class T>
+size_t HistogramThreadCells<T>::GetMemoryUsage() const noexcept
+{
+  return cells_.MemoryUsage() + counts_.capacity() * sizeof(uint64_t);
+}
+
+template <class T>
+void HistogramThreadCells<T>::ResetCell(size_t cell_index) noexcept
+{
+  Cell &cell = cells_[cell_index];
+  cell.count = 0;
+  cell.sum   = 0;
+  cell.min   = (std::numeric_limits<T>::max)();
+  cell.max   = (std::numeric_limits<T>::min)();
+  std::fill(counts_.begin() + cell_index * stride_, counts_.begin() + (cell_index + 1) * stride_,
+            0);
+}
+
+template class HistogramThreadCells<int64_t>;
+template class HistogramThreadCells<double>;
+
 LongHistogramAggregation::LongHistogramAggregation(const AggregationConfig *aggregation_config)
 {
   auto ac = static_cast<const HistogramAggregationConfig *>(aggregation_config);
   if (ac)
   {
     point_data_.boundaries_ = ac->boundaries_;
+    indexer_                = ac->GetBucketIndexer();
   }
   else
   {
     point_data_.boundaries_ = HistogramAggregationConfig::DefaultBoundaries();
+    indexer_                = DefaultBucketIndexer();
   }
 
   if (ac)
   {
     record_min_max_ = ac->record_min_max_;
   }
-  point_data_.counts_         = std::vector<uint64_t>(point_data_.boundaries_.size() + 1, 0);
-  point_data_.sum_            = static_cast<int64_t>(0);
-  point_data_.count_          = 0;
-  point_data_.record_min_max_ = record_min_max_;
-  point_data_.min_            = (std::numeric_limits<int64_t>::max)();
-  point_data_.max_            = (std::numeric_limits<int64_t>::min)();
+  const size_t bucket_count = point_data_.boundaries_.size() + 1;
+  if (ac && ac->thread_cell_count_ > 0)
+  {
+    cells_.reset(new HistogramThreadCells<int64_t>(ac->thread_cell_count_, bucket_count));
+  }
+  if (ac && ac->compact_counts_ && !cells_)
+  {
+    compact_counts_.reset(new AdaptingIntegerArray(bucket_count));
+    InitPointData<int64_t>(point_data_, record_min_max_, 0);
+  }
+  else
+  {
+    InitPointData<int64_t>(point_data_, record_min_max_, bucket_count);
+  }
+}
+
+LongHistogramAggregation::LongHistogramAggregation(
+    const HistogramBoundaries &boundaries,
+    std::shared_ptr<const HistogramBucketIndexer> indexer,
+    bool record_min_max)
+    : indexer_(std::move(indexer)), record_min_max_(record_min_max)
+{
+  point_data_.boundaries_ = boundaries;
+  InitPointData<int64_t>(point_data_, record_min_max_, boundaries.size() + 1);
 }
 
 LongHistogramAggregation::LongHistogramAggregation(HistogramPointData &&data)
-    : point_data_{std::move(data)}, record_min_max_{point_data_.record_min_max_}
+    : point_data_{std::move(data)},
+      indexer_{std::make_shared<const HistogramBucketIndexer>(point_data_.boundaries_)},
+      record_min_max_{point_data_.record_min_max_}
 {}
 
 LongHistogramAggregation::LongHistogramAggregation(const HistogramPointData &data)
-    : point_data_{data}, record_min_max_{point_data_.record_min_max_}
+    : point_data_{data},
+      indexer_{std::make_shared<const HistogramBucketIndexer>(point_data_.boundaries_)},
+      record_min_max_{point_data_.record_min_max_}
 {}
 
 void LongHistogramAggregation::Aggregate(int64_t value,
                                          const PointAttributes & /* attributes */) noexcept
 {
+  if (cells_)
+  {
+    cells_->Aggregate(value, indexer_->ComputeIndex(static_cast<double>(value)), record_min_max_);
+    return;
+  }
   const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
   point_data_.count_ += 1;
   point_data_.sum_ = nostd::get<int64_t>(point_data_.sum_) + value;
@@ -68,33 +325,74 @@ void LongHistogramAggregation::Aggregate(int64_t value,
     point_data_.min_ = (std::min)(nostd::get<int64_t>(point_data_.min_), value);
     point_data_.max_ = (std::max)(nostd::get<int64_t>(point_data_.max_), value);
   }
-  size_t index = BucketBinarySearch(value, point_data_.boundaries_);
+  size_t index = indexer_->ComputeIndex(static_cast<double>(value));
+  if (compact_counts_)
+  {
+    compact_counts_->Increment(index, 1);
+    return;
+  }
   point_data_.counts_[index] += 1;
 }
 
+void LongHistogramAggregation::AggregateBatch(nostd::span<const int64_t> values) noexcept
+{
+  if (cells_)
+  {
+    cells_->AggregateBatch(values, *indexer_, record_min_max_);
+    return;
+  }
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  AggregateValues(values, *indexer_, record_min_max_, point_data_, compact_counts_.get());
+}
+
 std::unique_ptr<Aggregation> LongHistogramAggregation::Merge(
     const Aggregation &delta) const noexcept
 {
   auto curr_value  = nostd::get<HistogramPointData>(ToPoint());
   auto delta_value = nostd::get<HistogramPointData>(
       (static_cast<const LongHistogramAggregation &>(delta).ToPoint()));
-  HistogramAggregationConfig agg_config;
-  agg_config.boundaries_         = curr_value.boundaries_;
-  agg_config.record_min_max_     = record_min_max_;
-  LongHistogramAggregation *aggr = new LongHistogramAggregation(&agg_config);
+  LongHistogramAggregation *aggr =
+      new LongHistogramAggregation(curr_value.boundaries_, indexer_, record_min_max_);
   HistogramMerge<int64_t>(curr_value, delta_value, aggr->point_data_);
   return std::unique_ptr<Aggregation>(aggr);
 }
 
+bool LongHistogramAggregation::MergeFrom(const Aggregation &delta) noexcept
+{
+  const auto &other = static_cast<const LongHistogramAggregation &>(delta);
+  if (&other == this)
+  {
+    return false;
+  }
+  if (other.cells_ || other.compact_counts_)
+  {
+    auto delta_value = nostd::get<HistogramPointData>(other.ToPoint());
+    const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+    HistogramMergeFrom<int64_t>(point_data_, delta_value);
+    if (compact_counts_)
+    {
+      IncrementCounts(*compact_counts_, delta_value.counts_);
+    }
+    return true;
+  }
+  // The point data of the delta is read in place, without copying its bucket counts.
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> other_locked(other.lock_);
+  HistogramMergeFrom<int64_t>(point_data_, other.point_data_);
+  if (compact_counts_)
+  {
+    IncrementCounts(*compact_counts_, other.point_data_.counts_);
+  }
+  return true;
+}
+
 std::unique_ptr<Aggregation> LongHistogramAggregation::Diff(const Aggregation &next) const noexcept
 {
   auto curr_value = nostd::get<HistogramPointData>(ToPoint());
   auto next_value = nostd::get<HistogramPointData>(
       (static_cast<const LongHistogramAggregation &>(next).ToPoint()));
-  HistogramAggregationConfig agg_config;
-  agg_config.boundaries_         = curr_value.boundaries_;
-  agg_config.record_min_max_     = record_min_max_;
-  LongHistogramAggregation *aggr = new LongHistogramAggregation(&agg_config);
+  LongHistogramAggregation *aggr =
+      new LongHistogramAggregation(curr_value.boundaries_, indexer_, record_min_max_);
   HistogramDiff<int64_t>(curr_value, next_value, aggr->point_data_);
   return std::unique_ptr<Aggregation>(aggr);
 }
@@ -102,7 +400,54 @@ std::unique_ptr<Aggregation> LongHistogramAggregation::Diff(const Aggregation &n
 PointType LongHistogramAggregation::ToPoint() const noexcept
 {
   const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
-  return point_data_;
+  if (!cells_ && !compact_counts_)
+  {
+    return point_data_;
+  }
+  HistogramPointData point_data = point_data_;
+  if (cells_)
+  {
+    cells_->MergeInto(point_data);
+  }
+  else
+  {
+    ExpandCounts(*compact_counts_, point_data.counts_);
+  }
+  return point_data;
+}
+
+bool LongHistogramAggregation::Reset() noexcept
+{
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  std::fill(point_data_.counts_.begin(), point_data_.counts_.end(), 0);
+  point_data_.sum_   = static_cast<int64_t>(0);
+  point_data_.count_ = 0;
+  point_data_.min_   = (std::numeric_limits<int64_t>::max)();
+  point_data_.max_   = (std::numeric_limits<int64_t>::min)();
+  if (cells_)
+  {
+    cells_->Reset();
+  }
+  if (compact_counts_)
+  {
+    compact_counts_->Clear();
+  }
+  return true;
+}
+
+size_t LongHistogramAggregation::GetMemoryUsage() const noexcept
+{
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  size_t usage = sizeof(*this) + point_data_.counts_.capacity() * sizeof(uint64_t);
+  if (cells_)
+  {
+    usage += sizeof(*cells_) + cells_->GetMemoryUsage();
+  }
+  if (compact_counts_)
+  {
+    usage += sizeof(*compact_counts_) + compact_counts_->MemoryUsage();
+  }
+  return usage;
 }
 
 DoubleHistogramAggregation::DoubleHistogramAggregation(const AggregationConfig *aggregation_config)
@@ -111,34 +456,61 @@ DoubleHistogramAggregation::DoubleHistogramAggregation(const AggregationConfig *
   if (ac)
   {
     point_data_.boundaries_ = ac->boundaries_;
+    indexer_                = ac->GetBucketIndexer();
   }
   else
   {
     point_data_.boundaries_ = HistogramAggregationConfig::DefaultBoundaries();
+    indexer_                = DefaultBucketIndexer();
   }
   if (ac)
   {
     record_min_max_ = ac->record_min_max_;
   }
-  point_data_.counts_         = std::vector<uint64_t>(point_data_.boundaries_.size() + 1, 0);
-  point_data_.sum_            = 0.0;
-  point_data_.count_          = 0;
-  point_data_.record_min_max_ = record_min_max_;
-  point_data_.min_            = (std::numeric_limits<double>::max)();
-  point_data_.max_            = (std::numeric_limits<double>::min)();
+  const size_t bucket_count = point_data_.boundaries_.size() + 1;
+  if (ac && ac->thread_cell_count_ > 0)
+  {
+    cells_.reset(new HistogramThreadCells<double>(ac->thread_cell_count_, bucket_count));
+  }
+  if (ac && ac->compact_counts_ && !cells_)
+  {
+    compact_counts_.reset(new AdaptingIntegerArray(bucket_count));
+    InitPointData<double>(point_data_, record_min_max_, 0);
+  }
+  else
+  {
+    InitPointData<double>(point_data_, record_min_max_, bucket_count);
+  }
+}
+
+DoubleHistogramAggregation::DoubleHistogramAggregation(
+    const HistogramBoundaries &boundaries,
+    std::shared_ptr<const HistogramBucketIndexer> indexer,
+    bool record_min_max)
+    : indexer_(std::move(indexer)), record_min_max_(record_min_max)
+{
+  point_data_.boundaries_ = boundaries;
+  InitPointData<double>(point_data_, record_min_max_, boundaries.size() + 1);
 }
 
 DoubleHistogramAggregation::DoubleHistogramAggregation(HistogramPointData &&data)
-    : point_data_{std::move(data)}
+    : point_data_{std::move(data)},
+      indexer_{std::make_shared<const HistogramBucketIndexer>(point_data_.boundaries_)}
 {}
 
 DoubleHistogramAggregation::DoubleHistogramAggregation(const HistogramPointData &data)
-    : point_data_{data}
+    : point_data_{data},
+      indexer_{std::make_shared<const HistogramBucketIndexer>(point_data_.boundaries_)}
 {}
 
 void DoubleHistogramAggregation::Aggregate(double value,
                                            const PointAttributes & /* attributes */) noexcept
 {
+  if (cells_)
+  {
+    cells_->Aggregate(value, indexer_->ComputeIndex(value), record_min_max_);
+    return;
+  }
   const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
   point_data_.count_ += 1;
   point_data_.sum_ = nostd::get<double>(point_data_.sum_) + value;
@@ -147,34 +519,75 @@ void DoubleHistogramAggregation::Aggregate(double value,
     point_data_.min_ = (std::min)(nostd::get<double>(point_data_.min_), value);
     point_data_.max_ = (std::max)(nostd::get<double>(point_data_.max_), value);
   }
-  size_t index = BucketBinarySearch(value, point_data_.boundaries_);
+  size_t index = indexer_->ComputeIndex(value);
+  if (compact_counts_)
+  {
+    compact_counts_->Increment(index, 1);
+    return;
+  }
   point_data_.counts_[index] += 1;
 }
 
+void DoubleHistogramAggregation::AggregateBatch(nostd::span<const double> values) noexcept
+{
+  if (cells_)
+  {
+    cells_->AggregateBatch(values, *indexer_, record_min_max_);
+    return;
+  }
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  AggregateValues(values, *indexer_, record_min_max_, point_data_, compact_counts_.get());
+}
+
 std::unique_ptr<Aggregation> DoubleHistogramAggregation::Merge(
     const Aggregation &delta) const noexcept
 {
   auto curr_value  = nostd::get<HistogramPointData>(ToPoint());
   auto delta_value = nostd::get<HistogramPointData>(
       (static_cast<const DoubleHistogramAggregation &>(delta).ToPoint()));
-  HistogramAggregationConfig agg_config;
-  agg_config.boundaries_           = curr_value.boundaries_;
-  agg_config.record_min_max_       = record_min_max_;
-  DoubleHistogramAggregation *aggr = new DoubleHistogramAggregation(&agg_config);
+  DoubleHistogramAggregation *aggr =
+      new DoubleHistogramAggregation(curr_value.boundaries_, indexer_, record_min_max_);
   HistogramMerge<double>(curr_value, delta_value, aggr->point_data_);
   return std::unique_ptr<Aggregation>(aggr);
 }
 
+bool DoubleHistogramAggregation::MergeFrom(const Aggregation &delta) noexcept
+{
+  const auto &other = static_cast<const DoubleHistogramAggregation &>(delta);
+  if (&other == this)
+  {
+    return false;
+  }
+  if (other.cells_ || other.compact_counts_)
+  {
+    auto delta_value = nostd::get<HistogramPointData>(other.ToPoint());
+    const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+    HistogramMergeFrom<double>(point_data_, delta_value);
+    if (compact_counts_)
+    {
+      IncrementCounts(*compact_counts_, delta_value.counts_);
+    }
+    return true;
+  }
+  // The point data of the delta is read in place, without copying its bucket counts.
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> other_locked(other.lock_);
+  HistogramMergeFrom<double>(point_data_, other.point_data_);
+  if (compact_counts_)
+  {
+    IncrementCounts(*compact_counts_, other.point_data_.counts_);
+  }
+  return true;
+}
+
 std::unique_ptr<Aggregation> DoubleHistogramAggregation::Diff(
     const Aggregation &next) const noexcept
 {
   auto curr_value = nostd::get<HistogramPointData>(ToPoint());
   auto next_value = nostd::get<HistogramPointData>(
       (static_cast<const DoubleHistogramAggregation &>(next).ToPoint()));
-  HistogramAggregationConfig agg_config;
-  agg_config.boundaries_           = curr_value.boundaries_;
-  agg_config.record_min_max_       = record_min_max_;
-  DoubleHistogramAggregation *aggr = new DoubleHistogramAggregation(&agg_config);
+  DoubleHistogramAggregation *aggr =
+      new DoubleHistogramAggregation(curr_value.boundaries_, indexer_, record_min_max_);
   HistogramDiff<double>(curr_value, next_value, aggr->point_data_);
   return std::unique_ptr<Aggregation>(aggr);
 }
@@ -182,7 +595,54 @@ std::unique_ptr<Aggregation> DoubleHistogramAggregation::Diff(
 PointType DoubleHistogramAggregation::ToPoint() const noexcept
 {
   const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
-  return point_data_;
+  if (!cells_ && !compact_counts_)
+  {
+    return point_data_;
+  }
+  HistogramPointData point_data = point_data_;
+  if (cells_)
+  {
+    cells_->MergeInto(point_data);
+  }
+  else
+  {
+    ExpandCounts(*compact_counts_, point_data.counts_);
+  }
+  return point_data;
+}
+
+bool DoubleHistogramAggregation::Reset() noexcept
+{
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  std::fill(point_data_.counts_.begin(), point_data_.counts_.end(), 0);
+  point_data_.sum_   = 0.0;
+  point_data_.count_ = 0;
+  point_data_.min_   = (std::numeric_limits<double>::max)();
+  point_data_.max_   = (std::numeric_limits<double>::min)();
+  if (cells_)
+  {
+    cells_->Reset();
+  }
+  if (compact_counts_)
+  {
+    compact_counts_->Clear();
+  }
+  return true;
+}
+
+size_t DoubleHistogramAggregation::GetMemoryUsage() const noexcept
+{
+  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
+  size_t usage = sizeof(*this) + point_data_.counts_.capacity() * sizeof(uint64_t);
+  if (cells_)
+  {
+    usage += sizeof(*cells_) + cells_->GetMemoryUsage();
+  }
+  if (compact_counts_)
+  {
+    usage += sizeof(*compact_counts_) + compact_counts_->MemoryUsage();
+  }
+  return usage;
 }
 
 }  // namespace metrics
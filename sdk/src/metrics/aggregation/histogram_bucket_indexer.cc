@@ -0,0 +1,153 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/sdk/metrics/aggregation/histogram_bucket_indexer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "opentelemetry/sdk/metrics/data/histogram_boundaries.h"
+
+#if defined(__AVX2__)
+#  include <immintrin.h>
+#  define OPENTELEMETRY_HISTOGRAM_BUCKET_INDEXER_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#  define OPENTELEMETRY_HISTOGRAM_BUCKET_INDEXER_SSE2
+#endif
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+
+namespace
+{
+
+// Store the boundaries of the subtree rooted at index k of the Eytzinger layout, and return the
+// position in ascending order of the next boundary to store.
+size_t FillEytzinger(const std::vector<double> &sorted,
+                     size_t position,
+                     size_t k,
+                     std::vector<double> &layout,
+                     std::vector<uint32_t> &ranks)
+{
+  if (k < layout.size())
+  {
+    position  = FillEytzinger(sorted, position, 2 * k, layout, ranks);
+    layout[k] = sorted[position];
+    ranks[k]  = static_cast<uint32_t>(position);
+    position  = FillEytzinger(sorted, position + 1, 2 * k + 1, layout, ranks);
+  }
+  return position;
+}
+
+// Number of trailing 1 bits of k.
+size_t CountTrailingOnes(size_t k)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<size_t>(__builtin_ctzll(~static_cast<unsigned long long>(k)));
+#else
+  size_t count = 0;
+  while (k & 1)
+  {
+    k >>= 1;
+    ++count;
+  }
+  return count;
+#endif
+}
+
+}  // namespace
+
+HistogramBucketIndexer::HistogramBucketIndexer(const HistogramBoundaries &boundaries)
+    : eytzinger_(boundaries.size() > kMaxLinearSearchBoundaries)
+{
+  if (!eytzinger_)
+  {
+    sorted_     = boundaries;
+    boundaries_ = sorted_.data();
+    size_       = sorted_.size();
+    return;
+  }
+  std::shared_ptr<EytzingerLayout> layout = std::make_shared<EytzingerLayout>();
+  layout->boundaries.resize(boundaries.size() + 1);
+  layout->ranks.resize(boundaries.size() + 1);
+  layout->ranks[0] = static_cast<uint32_t>(boundaries.size());
+  FillEytzinger(boundaries, 0, 1, layout->boundaries, layout->ranks);
+  boundaries_ = layout->boundaries.data();
+  ranks_      = layout->ranks.data();
+  size_       = layout->boundaries.size();
+  layout_     = std::move(layout);
+}
+
+size_t HistogramBucketIndexer::ComputeIndex(double value) const noexcept
+{
+  return eytzinger_ ? ComputeIndexEytzinger(value) : ComputeIndexLinear(value);
+}
+
+size_t HistogramBucketIndexer::ComputeIndexLinear(double value) const noexcept
+{
+  // Every boundary is compared, and the results are added up instead of stopping at the first
+  // boundary not lower than the value. For a few dozen boundaries this avoids the mispredicted
+  // branches of a binary search.
+  const double *boundaries = boundaries_;
+  const size_t size        = size_;
+  size_t i                 = 0;
+  size_t index             = 0;
+#if defined(OPENTELEMETRY_HISTOGRAM_BUCKET_INDEXER_AVX2)
+  // A lane of the comparison is all ones, that is -1, when the boundary is lower than the value.
+  const __m256d values = _mm256_set1_pd(value);
+  __m256i counts       = _mm256_setzero_si256();
+  for (; i + 4 <= size; i += 4)
+  {
+    const __m256d lower = _mm256_cmp_pd(_mm256_loadu_pd(boundaries + i), values, _CMP_LT_OQ);
+    counts              = _mm256_sub_epi64(counts, _mm256_castpd_si256(lower));
+  }
+  alignas(32) int64_t lanes[4];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), counts);
+  index = static_cast<size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+#elif defined(OPENTELEMETRY_HISTOGRAM_BUCKET_INDEXER_SSE2)
+  // A lane of the comparison is all ones, that is -1, when the boundary is lower than the value.
+  const __m128d values = _mm_set1_pd(value);
+  __m128i counts       = _mm_setzero_si128();
+  for (; i + 2 <= size; i += 2)
+  {
+    const __m128d lower = _mm_cmplt_pd(_mm_loadu_pd(boundaries + i), values);
+    counts              = _mm_sub_epi64(counts, _mm_castpd_si128(lower));
+  }
+  alignas(16) int64_t lanes[2];
+  _mm_store_si128(reinterpret_cast<__m128i *>(lanes), counts);
+  index = static_cast<size_t>(lanes[0] + lanes[1]);
+#endif
+  for (; i < size; ++i)
+  {
+    index += static_cast<size_t>(boundaries[i] < value);
+  }
+  return index;
+}
+
+size_t HistogramBucketIndexer::ComputeIndexEytzinger(double value) const noexcept
+{
+  // Descend the implicit tree, going right when the boundary is lower than the value. The last
+  // left turn of the path is at the first boundary not lower than the value, which is found by
+  // dropping the trailing right turns and that left turn. When there is none, k becomes 0 and
+  // the value maps to the last bucket.
+  const double *boundaries = boundaries_;
+  const size_t size        = size_;
+  size_t k                 = 1;
+  while (k < size)
+  {
+    k = 2 * k + static_cast<size_t>(boundaries[k] < value);
+  }
+  k >>= CountTrailingOnes(k) + 1;
+  return ranks_[k];
+}
+
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -1,10 +1,12 @@
 // Copyright The OpenTelemetry Authors
 // SPDX-License-Identifier: Apache-2.0
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
-#include <mutex>
+#include <thread>
 
 #include "opentelemetry/common/spin_lock_mutex.h"
 #include "opentelemetry/common/timestamp.h"
@@ -21,23 +23,122 @@ namespace sdk
 namespace metrics
 {
 
-LongLastValueAggregation::LongLastValueAggregation()
+namespace
 {
-  point_data_.is_lastvalue_valid_ = false;
-  point_data_.value_              = static_cast<int64_t>(0);
+
+int64_t Now() noexcept
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+// Try to make the sequence odd, which excludes the other writers.
+bool TryBeginWrite(std::atomic<uint64_t> &sequence, uint64_t &current) noexcept
+{
+  current = sequence.load(std::memory_order_relaxed);
+  return (current & 1) == 0 &&
+         sequence.compare_exchange_strong(current, current + 1, std::memory_order_relaxed);
+}
+
+// Wait for the concurrent publications with the back-off of common::SpinLockMutex::lock(), and
+// return the even sequence number the publication starts from.
+uint64_t BeginWrite(std::atomic<uint64_t> &sequence) noexcept
+{
+  uint64_t current = 0;
+  for (;;)
+  {
+    // Try once
+    if (TryBeginWrite(sequence, current))
+    {
+      return current;
+    }
+    // Spin-Fast
+    for (std::size_t i = 0; i < opentelemetry::common::SPINLOCK_FAST_ITERATIONS; ++i)
+    {
+      if (TryBeginWrite(sequence, current))
+      {
+        return current;
+      }
+      opentelemetry::common::SpinLockMutex::fast_yield();
+    }
+    // Yield then try again
+    std::this_thread::yield();
+    if (TryBeginWrite(sequence, current))
+    {
+      return current;
+    }
+    // Sleep and then start the whole process again.
+    std::this_thread::sleep_for(
+        std::chrono::milliseconds(opentelemetry::common::SPINLOCK_SLEEP_MS));
+  }
 }
 
+// Publish a last value, after the concurrent publications. When sample_now is true, the sample
+// timestamp is taken once the sequence is acquired rather than new_sample_ts, so that the values
+// are published in the order of their timestamps.
+template <class T>
+void Publish(std::atomic<uint64_t> &sequence,
+             std::atomic<T> &value,
+             std::atomic<int64_t> &sample_ts,
+             std::atomic<bool> &is_lastvalue_valid,
+             T new_value,
+             int64_t new_sample_ts,
+             bool new_is_lastvalue_valid,
+             bool sample_now) noexcept
+{
+  uint64_t current = BeginWrite(sequence);
+  // Readers seeing any of the stores below also see the odd sequence number.
+  std::atomic_thread_fence(std::memory_order_release);
+  value.store(new_value, std::memory_order_relaxed);
+  sample_ts.store(sample_now ? Now() : new_sample_ts, std::memory_order_relaxed);
+  is_lastvalue_valid.store(new_is_lastvalue_valid, std::memory_order_relaxed);
+  sequence.store(current + 2, std::memory_order_release);
+}
+
+template <class T>
+LastValuePointData Read(const std::atomic<uint64_t> &sequence,
+                        const std::atomic<T> &value,
+                        const std::atomic<int64_t> &sample_ts,
+                        const std::atomic<bool> &is_lastvalue_valid) noexcept
+{
+  uint64_t begin;
+  T read_value;
+  int64_t read_sample_ts;
+  bool read_is_lastvalue_valid;
+  do
+  {
+    begin                   = sequence.load(std::memory_order_acquire);
+    read_value              = value.load(std::memory_order_relaxed);
+    read_sample_ts          = sample_ts.load(std::memory_order_relaxed);
+    read_is_lastvalue_valid = is_lastvalue_valid.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+  } while ((begin & 1) || begin != sequence.load(std::memory_order_relaxed));
+
+  LastValuePointData point_data;
+  point_data.value_ = read_value;
+  point_data.sample_ts_ =
+      opentelemetry::common::SystemTimestamp{std::chrono::nanoseconds(read_sample_ts)};
+  point_data.is_lastvalue_valid_ = read_is_lastvalue_valid;
+  return point_data;
+}
+
+}  // namespace
+
+LongLastValueAggregation::LongLastValueAggregation() = default;
+
 LongLastValueAggregation::LongLastValueAggregation(const LastValuePointData &data)
-    : point_data_{data}
-{}
+{
+  const auto *value = nostd::get_if<int64_t>(&data.value_);
+  value_.store(value ? *value : 0, std::memory_order_relaxed);
+  sample_ts_.store(data.sample_ts_.time_since_epoch().count(), std::memory_order_relaxed);
+  is_lastvalue_valid_.store(data.is_lastvalue_valid_, std::memory_order_relaxed);
+}
 
 void LongLastValueAggregation::Aggregate(int64_t value,
                                          const PointAttributes & /* attributes */) noexcept
 {
-  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
-  point_data_.is_lastvalue_valid_ = true;
-  point_data_.value_              = value;
-  point_data_.sample_ts_          = std::chrono::system_clock::now();
+  Publish<int64_t>(sequence_, value_, sample_ts_, is_lastvalue_valid_, value, 0, true, true);
 }
 
 std::unique_ptr<Aggregation> LongLastValueAggregation::Merge(
@@ -56,6 +157,22 @@ std::unique_ptr<Aggregation> LongLastValueAggregation::Merge(
   }
 }
 
+bool LongLastValueAggregation::MergeFrom(const Aggregation &delta) noexcept
+{
+  // Same as Merge(): the value with the most recent sample timestamp is kept.
+  LastValuePointData delta_data = nostd::get<LastValuePointData>(delta.ToPoint());
+  if (nostd::get<LastValuePointData>(ToPoint()).sample_ts_.time_since_epoch() >
+      delta_data.sample_ts_.time_since_epoch())
+  {
+    return true;
+  }
+  const auto *value = nostd::get_if<int64_t>(&delta_data.value_);
+  Publish<int64_t>(sequence_, value_, sample_ts_, is_lastvalue_valid_, value ? *value : 0,
+                   delta_data.sample_ts_.time_since_epoch().count(),
+                   delta_data.is_lastvalue_valid_, false);
+  return true;
+}
+
 std::unique_ptr<Aggregation> LongLastValueAggregation::Diff(const Aggregation &next) const noexcept
 {
   if (nostd::get<LastValuePointData>(ToPoint()).sample_ts_.time_since_epoch() >
@@ -73,27 +190,29 @@ std::unique_ptr<Aggregation> LongLastValueAggregation::Diff(const Aggregation &n
 
 PointType LongLastValueAggregation::ToPoint() const noexcept
 {
-  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
-  return point_data_;
+  return Read(sequence_, value_, sample_ts_, is_lastvalue_valid_);
 }
 
-DoubleLastValueAggregation::DoubleLastValueAggregation()
+bool LongLastValueAggregation::Reset() noexcept
 {
-  point_data_.is_lastvalue_valid_ = false;
-  point_data_.value_              = 0.0;
+  Publish<int64_t>(sequence_, value_, sample_ts_, is_lastvalue_valid_, 0, 0, false, false);
+  return true;
 }
 
+DoubleLastValueAggregation::DoubleLastValueAggregation() = default;
+
 DoubleLastValueAggregation::DoubleLastValueAggregation(const LastValuePointData &data)
-    : point_data_{data}
-{}
+{
+  const auto *value = nostd::get_if<double>(&data.value_);
+  value_.store(value ? *value : 0.0, std::memory_order_relaxed);
+  sample_ts_.store(data.sample_ts_.time_since_epoch().count(), std::memory_order_relaxed);
+  is_lastvalue_valid_.store(data.is_lastvalue_valid_, std::memory_order_relaxed);
+}
 
 void DoubleLastValueAggregation::Aggregate(double value,
                                            const PointAttributes & /* attributes */) noexcept
 {
-  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
-  point_data_.is_lastvalue_valid_ = true;
-  point_data_.value_              = value;
-  point_data_.sample_ts_          = std::chrono::system_clock::now();
+  Publish<double>(sequence_, value_, sample_ts_, is_lastvalue_valid_, value, 0, true, true);
 }
 
 std::unique_ptr<Aggregation> DoubleLastValueAggregation::Merge(
@@ -112,6 +231,22 @@ std::unique_ptr<Aggregation> DoubleLastValueAggregation::Merge(
   }
 }
 
+bool DoubleLastValueAggregation::MergeFrom(const Aggregation &delta) noexcept
+{
+  // Same as Merge(): the value with the most recent sample timestamp is kept.
+  LastValuePointData delta_data = nostd::get<LastValuePointData>(delta.ToPoint());
+  if (nostd::get<LastValuePointData>(ToPoint()).sample_ts_.time_since_epoch() >
+      delta_data.sample_ts_.time_since_epoch())
+  {
+    return true;
+  }
+  const auto *value = nostd::get_if<double>(&delta_data.value_);
+  Publish<double>(sequence_, value_, sample_ts_, is_lastvalue_valid_, value ? *value : 0,
+                  delta_data.sample_ts_.time_since_epoch().count(),
+                  delta_data.is_lastvalue_valid_, false);
+  return true;
+}
+
 std::unique_ptr<Aggregation> DoubleLastValueAggregation::Diff(
     const Aggregation &next) const noexcept
 {
@@ -130,8 +265,13 @@ std::unique_ptr<Aggregation> DoubleLastValueAggregation::Diff(
 
 PointType DoubleLastValueAggregation::ToPoint() const noexcept
 {
-  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
-  return point_data_;
+  return Read(sequence_, value_, sample_ts_, is_lastvalue_valid_);
+}
+
+bool DoubleLastValueAggregation::Reset() noexcept
+{
+  Publish<double>(sequence_, value_, sample_ts_, is_lastvalue_valid_, 0.0, 0, false, false);
+  return true;
 }
 }  // namespace metrics
 }  // namespace sdk
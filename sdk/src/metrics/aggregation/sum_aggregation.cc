@@ -1,12 +1,12 @@
 // Copyright The OpenTelemetry Authors
 // SPDX-License-Identifier: Apache-2.0
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
-#include <mutex>
 #include <ostream>
 
-#include "opentelemetry/common/spin_lock_mutex.h"
+#include "opentelemetry/nostd/span.h"
 #include "opentelemetry/nostd/variant.h"
 #include "opentelemetry/sdk/common/global_log_handler.h"
 #include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
@@ -21,17 +21,18 @@ namespace sdk
 namespace metrics
 {
 
-LongSumAggregation::LongSumAggregation(bool is_monotonic)
+LongSumAggregation::LongSumAggregation(bool is_monotonic) : is_monotonic_{is_monotonic} {}
+
+LongSumAggregation::LongSumAggregation(const SumPointData &data)
+    : is_monotonic_{data.is_monotonic_}
 {
-  point_data_.value_        = static_cast<int64_t>(0);
-  point_data_.is_monotonic_ = is_monotonic;
+  const auto *value = nostd::get_if<int64_t>(&data.value_);
+  value_.store(value ? *value : 0, std::memory_order_relaxed);
 }
 
-LongSumAggregation::LongSumAggregation(const SumPointData &data) : point_data_{data} {}
-
 void LongSumAggregation::Aggregate(int64_t value, const PointAttributes & /* attributes */) noexcept
 {
-  if (point_data_.is_monotonic_ && value < 0)
+  if (is_monotonic_ && value < 0)
   {
     OTEL_INTERNAL_LOG_WARN(
         " LongSumAggregation::Aggregate Negative value ignored for Monotonic increasing "
@@ -39,8 +40,31 @@ void LongSumAggregation::Aggregate(int64_t value, const PointAttributes & /* att
         << value);
     return;
   }
-  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
-  point_data_.value_ = nostd::get<int64_t>(point_data_.value_) + value;
+  value_.fetch_add(value, std::memory_order_relaxed);
+}
+
+void LongSumAggregation::AggregateBatch(nostd::span<const int64_t> values) noexcept
+{
+  // The values are summed as unsigned integers, which wrap around on overflow like the atomic
+  // additions of Aggregate() instead of being undefined behavior.
+  uint64_t sum         = 0;
+  bool negative_values = false;
+  for (int64_t value : values)
+  {
+    if (is_monotonic_ && value < 0)
+    {
+      negative_values = true;
+      continue;
+    }
+    sum += static_cast<uint64_t>(value);
+  }
+  if (negative_values)
+  {
+    OTEL_INTERNAL_LOG_WARN(
+        " LongSumAggregation::AggregateBatch Negative values ignored for Monotonic increasing "
+        "measurement.");
+  }
+  value_.fetch_add(static_cast<int64_t>(sum), std::memory_order_relaxed);
 }
 
 std::unique_ptr<Aggregation> LongSumAggregation::Merge(const Aggregation &delta) const noexcept
@@ -53,7 +77,7 @@ std::unique_ptr<Aggregation> LongSumAggregation::Merge(const Aggregation &delta)
   if (delta_sum == nullptr || curr_sum == nullptr)
   {
     OTEL_INTERNAL_LOG_ERROR("LongSumAggregation::Merge - Loss of type");
-    return std::unique_ptr<Aggregation>(new LongSumAggregation(point_data_.is_monotonic_));
+    return std::unique_ptr<Aggregation>(new LongSumAggregation(is_monotonic_));
   }
 
   const auto *delta_val = nostd::get_if<int64_t>(&delta_sum->value_);
@@ -61,14 +85,23 @@ std::unique_ptr<Aggregation> LongSumAggregation::Merge(const Aggregation &delta)
   if (delta_val == nullptr || curr_val == nullptr)
   {
     OTEL_INTERNAL_LOG_ERROR("LongSumAggregation::Merge - Loss of type");
-    return std::unique_ptr<Aggregation>(new LongSumAggregation(point_data_.is_monotonic_));
+    return std::unique_ptr<Aggregation>(new LongSumAggregation(is_monotonic_));
   }
 
-  std::unique_ptr<Aggregation> aggr(new LongSumAggregation(point_data_.is_monotonic_));
-  static_cast<LongSumAggregation *>(aggr.get())->point_data_.value_ = *delta_val + *curr_val;
+  std::unique_ptr<Aggregation> aggr(new LongSumAggregation(is_monotonic_));
+  static_cast<LongSumAggregation *>(aggr.get())
+      ->value_.store(*delta_val + *curr_val, std::memory_order_relaxed);
   return aggr;
 }
 
+bool LongSumAggregation::MergeFrom(const Aggregation &delta) noexcept
+{
+  const int64_t delta_value =
+      static_cast<const LongSumAggregation &>(delta).value_.load(std::memory_order_relaxed);
+  value_.fetch_add(delta_value, std::memory_order_relaxed);
+  return true;
+}
+
 std::unique_ptr<Aggregation> LongSumAggregation::Diff(const Aggregation &next) const noexcept
 {
   auto next_point = static_cast<const LongSumAggregation &>(next).ToPoint();
@@ -79,7 +112,7 @@ std::unique_ptr<Aggregation> LongSumAggregation::Diff(const Aggregation &next) c
   if (next_sum == nullptr || curr_sum == nullptr)
   {
     OTEL_INTERNAL_LOG_ERROR("LongSumAggregation::Diff - Loss of type");
-    return std::unique_ptr<Aggregation>(new LongSumAggregation(point_data_.is_monotonic_));
+    return std::unique_ptr<Aggregation>(new LongSumAggregation(is_monotonic_));
   }
 
   const auto *next_val = nostd::get_if<int64_t>(&next_sum->value_);
@@ -87,32 +120,42 @@ std::unique_ptr<Aggregation> LongSumAggregation::Diff(const Aggregation &next) c
   if (next_val == nullptr || curr_val == nullptr)
   {
     OTEL_INTERNAL_LOG_ERROR("LongSumAggregation::Diff - Loss of type");
-    return std::unique_ptr<Aggregation>(new LongSumAggregation(point_data_.is_monotonic_));
+    return std::unique_ptr<Aggregation>(new LongSumAggregation(is_monotonic_));
   }
 
-  std::unique_ptr<Aggregation> aggr(new LongSumAggregation(point_data_.is_monotonic_));
-  static_cast<LongSumAggregation *>(aggr.get())->point_data_.value_ = *next_val - *curr_val;
+  std::unique_ptr<Aggregation> aggr(new LongSumAggregation(is_monotonic_));
+  static_cast<LongSumAggregation *>(aggr.get())
+      ->value_.store(*next_val - *curr_val, std::memory_order_relaxed);
   return aggr;
 }
 
 PointType LongSumAggregation::ToPoint() const noexcept
 {
-  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
-  return point_data_;
+  SumPointData point_data;
+  point_data.value_        = value_.load(std::memory_order_relaxed);
+  point_data.is_monotonic_ = is_monotonic_;
+  return point_data;
 }
 
-DoubleSumAggregation::DoubleSumAggregation(bool is_monotonic)
+bool LongSumAggregation::Reset() noexcept
 {
-  point_data_.value_        = 0.0;
-  point_data_.is_monotonic_ = is_monotonic;
+  value_.store(0, std::memory_order_relaxed);
+  return true;
 }
 
-DoubleSumAggregation::DoubleSumAggregation(const SumPointData &data) : point_data_(data) {}
+DoubleSumAggregation::DoubleSumAggregation(bool is_monotonic) : is_monotonic_{is_monotonic} {}
+
+DoubleSumAggregation::DoubleSumAggregation(const SumPointData &data)
+    : is_monotonic_{data.is_monotonic_}
+{
+  const auto *value = nostd::get_if<double>(&data.value_);
+  value_.store(value ? *value : 0.0, std::memory_order_relaxed);
+}
 
 void DoubleSumAggregation::Aggregate(double value,
                                      const PointAttributes & /* attributes */) noexcept
 {
-  if (point_data_.is_monotonic_ && value < 0)
+  if (is_monotonic_ && value < 0)
   {
     OTEL_INTERNAL_LOG_WARN(
         " DoubleSumAggregation::Aggregate Negative value ignored for Monotonic increasing "
@@ -120,8 +163,38 @@ void DoubleSumAggregation::Aggregate(double value,
         << value);
     return;
   }
-  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
-  point_data_.value_ = nostd::get<double>(point_data_.value_) + value;
+  double current = value_.load(std::memory_order_relaxed);
+  while (!value_.compare_exchange_weak(current, current + value, std::memory_order_relaxed))
+  {
+  }
+}
+
+void DoubleSumAggregation::AggregateBatch(nostd::span<const double> values) noexcept
+{
+  bool negative_values = false;
+  double current       = value_.load(std::memory_order_relaxed);
+  double next;
+  do
+  {
+    // The values are added to the current sum in order, so that the result is the same as
+    // aggregating them one by one.
+    next = current;
+    for (double value : values)
+    {
+      if (is_monotonic_ && value < 0)
+      {
+        negative_values = true;
+        continue;
+      }
+      next += value;
+    }
+  } while (!value_.compare_exchange_weak(current, next, std::memory_order_relaxed));
+  if (negative_values)
+  {
+    OTEL_INTERNAL_LOG_WARN(
+        " DoubleSumAggregation::AggregateBatch Negative values ignored for Monotonic increasing "
+        "measurement.");
+  }
 }
 
 std::unique_ptr<Aggregation> DoubleSumAggregation::Merge(const Aggregation &delta) const noexcept
@@ -134,7 +207,7 @@ std::unique_ptr<Aggregation> DoubleSumAggregation::Merge(const Aggregation &delt
   if (delta_sum == nullptr || curr_sum == nullptr)
   {
     OTEL_INTERNAL_LOG_ERROR("DoubleSumAggregation::Merge - Loss of type");
-    return std::unique_ptr<Aggregation>(new DoubleSumAggregation(point_data_.is_monotonic_));
+    return std::unique_ptr<Aggregation>(new DoubleSumAggregation(is_monotonic_));
   }
 
   const auto *delta_val = nostd::get_if<double>(&delta_sum->value_);
@@ -142,14 +215,26 @@ std::unique_ptr<Aggregation> DoubleSumAggregation::Merge(const Aggregation &delt
   if (delta_val == nullptr || curr_val == nullptr)
   {
     OTEL_INTERNAL_LOG_ERROR("DoubleSumAggregation::Merge - Loss of type");
-    return std::unique_ptr<Aggregation>(new DoubleSumAggregation(point_data_.is_monotonic_));
+    return std::unique_ptr<Aggregation>(new DoubleSumAggregation(is_monotonic_));
   }
 
-  std::unique_ptr<Aggregation> aggr(new DoubleSumAggregation(point_data_.is_monotonic_));
-  static_cast<DoubleSumAggregation *>(aggr.get())->point_data_.value_ = *delta_val + *curr_val;
+  std::unique_ptr<Aggregation> aggr(new DoubleSumAggregation(is_monotonic_));
+  static_cast<DoubleSumAggregation *>(aggr.get())
+      ->value_.store(*delta_val + *curr_val, std::memory_order_relaxed);
   return aggr;
 }
 
+bool DoubleSumAggregation::MergeFrom(const Aggregation &delta) noexcept
+{
+  const double delta_value =
+      static_cast<const DoubleSumAggregation &>(delta).value_.load(std::memory_order_relaxed);
+  double current = value_.load(std::memory_order_relaxed);
+  while (!value_.compare_exchange_weak(current, current + delta_value, std::memory_order_relaxed))
+  {
+  }
+  return true;
+}
+
 std::unique_ptr<Aggregation> DoubleSumAggregation::Diff(const Aggregation &next) const noexcept
 {
   auto next_point = static_cast<const DoubleSumAggregation &>(next).ToPoint();
@@ -160,7 +245,7 @@ std::unique_ptr<Aggregation> DoubleSumAggregation::Diff(const Aggregation &next)
   if (next_sum == nullptr || curr_sum == nullptr)
   {
     OTEL_INTERNAL_LOG_ERROR("DoubleSumAggregation::Diff - Loss of type");
-    return std::unique_ptr<Aggregation>(new DoubleSumAggregation(point_data_.is_monotonic_));
+    return std::unique_ptr<Aggregation>(new DoubleSumAggregation(is_monotonic_));
   }
 
   const auto *next_val = nostd::get_if<double>(&next_sum->value_);
@@ -168,18 +253,27 @@ std::unique_ptr<Aggregation> DoubleSumAggregation::Diff(const Aggregation &next)
   if (next_val == nullptr || curr_val == nullptr)
   {
     OTEL_INTERNAL_LOG_ERROR("DoubleSumAggregation::Diff - Loss of type");
-    return std::unique_ptr<Aggregation>(new DoubleSumAggregation(point_data_.is_monotonic_));
+    return std::unique_ptr<Aggregation>(new DoubleSumAggregation(is_monotonic_));
   }
 
-  std::unique_ptr<Aggregation> aggr(new DoubleSumAggregation(point_data_.is_monotonic_));
-  static_cast<DoubleSumAggregation *>(aggr.get())->point_data_.value_ = *next_val - *curr_val;
+  std::unique_ptr<Aggregation> aggr(new DoubleSumAggregation(is_monotonic_));
+  static_cast<DoubleSumAggregation *>(aggr.get())
+      ->value_.store(*next_val - *curr_val, std::memory_order_relaxed);
   return aggr;
 }
 
 PointType DoubleSumAggregation::ToPoint() const noexcept
 {
-  const std::lock_guard<opentelemetry::common::SpinLockMutex> locked(lock_);
-  return point_data_;
+  SumPointData point_data;
+  point_data.value_        = value_.load(std::memory_order_relaxed);
+  point_data.is_monotonic_ = is_monotonic_;
+  return point_data;
+}
+
+bool DoubleSumAggregation::Reset() noexcept
+{
+  value_.store(0.0, std::memory_order_relaxed);
+  return true;
 }
 
 }  // namespace metrics
@@ -1,6 +1,7 @@
 // Copyright The OpenTelemetry Authors
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -59,6 +60,15 @@ struct AdaptingIntegerArraySize
   }
 };
 
+struct AdaptingIntegerArrayMemoryUsage
+{
+  template <typename T>
+  size_t operator()(const std::vector<T> &backing)
+  {
+    return backing.capacity() * sizeof(T);
+  }
+};
+
 struct AdaptingIntegerArrayClear
 {
   template <typename T>
@@ -106,6 +116,118 @@ struct AdaptingIntegerArrayCopy
   }
 };
 
+// Position of a bucket index in a circular backing array starting at base_index.
+size_t ToSlot(int32_t index, int32_t base_index, size_t size)
+{
+  const int64_t offset = static_cast<int64_t>(index) - base_index;
+  return static_cast<size_t>(offset < 0 ? offset + static_cast<int64_t>(size) : offset);
+}
+
+// Adds the count of the cell at `from` to the cell at `to`, and resets the cell at `from`. Returns
+// the merged count, leaving both cells untouched, when it does not fit the cell type.
+template <typename T>
+uint64_t FoldCell(std::vector<T> &backing, size_t from, size_t to)
+{
+  const uint64_t count = backing[from];
+  if (count == 0 || from == to)
+  {
+    return 0;
+  }
+  const uint64_t result = backing[to] + count;
+  if OPENTELEMETRY_UNLIKELY_CONDITION (result > uint64_t(std::numeric_limits<T>::max()))
+  {
+    return result;
+  }
+  backing[to]   = static_cast<T>(result);
+  backing[from] = static_cast<T>(0);
+  return 0;
+}
+
+// Folds the buckets of a circular buffer counter into the buckets of the reduced scale, in a
+// single pass over the typed cells. `folded` counts the buckets already folded, so that the pass
+// can resume at the bucket which did not fit after the cells were widened.
+//
+// Buckets [base_index, end_index] sit at the front of the backing array in ascending slot order.
+// Folding never moves one of them to a higher slot, so walking up means every destination slot
+// has already been consumed. Buckets [start_index, base_index) sit at the tail of the backing
+// array, again in ascending slot order. Folding never moves one of them to a lower slot, so this
+// half is walked down instead. Any of them that folds into the new base index lands in the front
+// half, which is already fully consumed.
+struct AdaptingCircularBufferDownscale
+{
+  int32_t start_index;
+  int32_t end_index;
+  int32_t base_index;
+  int32_t new_base_index;
+  uint32_t shift;
+  int64_t &folded;
+
+  template <typename T>
+  uint64_t operator()(std::vector<T> &backing)
+  {
+    const size_t size         = backing.size();
+    const int64_t front_count = static_cast<int64_t>(end_index) - base_index + 1;
+    const int64_t total_count = static_cast<int64_t>(end_index) - start_index + 1;
+    for (; folded < front_count; ++folded)
+    {
+      const int32_t index   = static_cast<int32_t>(base_index + folded);
+      const uint64_t result = FoldCell(backing, ToSlot(index, base_index, size),
+                                       ToSlot(index >> shift, new_base_index, size));
+      if (result != 0)
+      {
+        return result;
+      }
+    }
+    for (; folded < total_count; ++folded)
+    {
+      const int32_t index   = static_cast<int32_t>(base_index - 1 - (folded - front_count));
+      const uint64_t result = FoldCell(backing, ToSlot(index, base_index, size),
+                                       ToSlot(index >> shift, new_base_index, size));
+      if (result != 0)
+      {
+        return result;
+      }
+    }
+    return 0;
+  }
+};
+
+// Adds the cells of the buckets [start_index, end_index] of another counter to the cells of the
+// same buckets of a counter whose index range already covers them. `merged` counts the buckets
+// already added, so that the pass can resume at the bucket which did not fit after the cells were
+// widened.
+struct AdaptingCircularBufferMerge
+{
+  int32_t start_index;
+  int32_t end_index;
+  int32_t from_base_index;
+  int32_t to_base_index;
+  int64_t &merged;
+
+  template <typename T1, typename T2>
+  uint64_t operator()(const std::vector<T1> &from, std::vector<T2> &to)
+  {
+    const int64_t total_count = static_cast<int64_t>(end_index) - start_index + 1;
+    for (; merged < total_count; ++merged)
+    {
+      const int32_t index  = static_cast<int32_t>(start_index + merged);
+      const uint64_t count = from[ToSlot(index, from_base_index, from.size())];
+      if (count == 0)
+      {
+        continue;
+      }
+      T2 &cell              = to[ToSlot(index, to_base_index, to.size())];
+      const uint64_t result = cell + count;
+      if OPENTELEMETRY_UNLIKELY_CONDITION (result > uint64_t(std::numeric_limits<T2>::max()))
+      {
+        return result;
+      }
+      cell = static_cast<T2>(result);
+    }
+    return 0;
+  }
+};
+
 }  // namespace
 
 void AdaptingIntegerArray::Increment(size_t index, uint64_t count)
@@ -133,6 +255,11 @@ size_t AdaptingIntegerArray::Size() const
   return nostd::visit(AdaptingIntegerArraySize{}, backing_);
 }
 
+size_t AdaptingIntegerArray::MemoryUsage() const
+{
+  return nostd::visit(AdaptingIntegerArrayMemoryUsage{}, backing_);
+}
+
 void AdaptingIntegerArray::Clear()
 {
   nostd::visit(AdaptingIntegerArrayClear{}, backing_);
@@ -242,21 +369,17 @@ void AdaptingCircularBufferCounter::Downscale(uint32_t by)
   const uint32_t shift         = by > kMaxShift ? kMaxShift : by;
   const int32_t new_base_index = base_index_ >> shift;
 
-  // Buckets [base_index_, end_index_] sit at the front of the backing array in
-  // ascending slot order. Folding never moves one of them to a higher slot, so
-  // walking up means every destination slot has already been consumed.
-  for (int64_t index = base_index_; index <= end_index_; ++index)
-  {
-    FoldBucket(static_cast<int32_t>(index), new_base_index, shift);
-  }
-
-  // Buckets [start_index_, base_index_) sit at the tail of the backing array,
-  // again in ascending slot order. Folding never moves one of them to a lower
-  // slot, so this half is walked down instead. Any of them that folds into the
-  // new base index lands in the front half, which is already fully consumed.
-  for (int64_t index = static_cast<int64_t>(base_index_) - 1; index >= start_index_; --index)
+  // The destinations are expressed against the post-downscale base index, which
+  // cannot be installed yet because the remaining slots still hold buckets of
+  // the current scale.
+  int64_t folded = 0;
+  uint64_t result;
+  while ((result = nostd::visit(AdaptingCircularBufferDownscale{start_index_, end_index_,
+                                                                base_index_, new_base_index,
+                                                                shift, folded},
+                                backing_.backing_)) != 0)
   {
-    FoldBucket(static_cast<int32_t>(index), new_base_index, shift);
+    backing_.EnlargeToFit(result);
   }
 
   start_index_ = start_index_ >> shift;
@@ -264,15 +387,36 @@ void AdaptingCircularBufferCounter::Downscale(uint32_t by)
   base_index_  = new_base_index;
 }
 
-void AdaptingCircularBufferCounter::FoldBucket(int32_t index,
-                                               int32_t new_base_index,
-                                               uint32_t shift)
+bool AdaptingCircularBufferCounter::MergeFrom(const AdaptingCircularBufferCounter &other)
 {
-  // The destination is expressed against the post-downscale base index, which
-  // cannot be installed yet because the remaining slots still hold buckets of
-  // the current scale. Downscale() guarantees that destination slot has already
-  // been read, or is the source slot itself.
-  backing_.Fold(ToBufferIndex(index), ToBufferIndex(index >> shift, new_base_index));
+  if (other.Empty())
+  {
+    return true;
+  }
+  const int32_t start_index =
+      Empty() ? other.start_index_ : (std::min)(start_index_, other.start_index_);
+  const int32_t end_index = Empty() ? other.end_index_ : (std::max)(end_index_, other.end_index_);
+  if (static_cast<int64_t>(end_index) - start_index + 1 > static_cast<int64_t>(backing_.Size()))
+  {
+    return false;
+  }
+  if (Empty())
+  {
+    base_index_ = other.base_index_;
+  }
+  start_index_ = start_index;
+  end_index_   = end_index;
+
+  int64_t merged = 0;
+  uint64_t result;
+  while ((result = nostd::visit(AdaptingCircularBufferMerge{other.start_index_, other.end_index_,
+                                                            other.base_index_, base_index_,
+                                                            merged},
+                                other.backing_.backing_, backing_.backing_)) != 0)
+  {
+    backing_.EnlargeToFit(result);
+  }
+  return true;
 }
 
 size_t AdaptingCircularBufferCounter::ToBufferIndex(int32_t index) const
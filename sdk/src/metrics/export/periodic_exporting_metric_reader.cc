@@ -13,11 +13,13 @@
 
 #include "opentelemetry/common/timestamp.h"
 #include "opentelemetry/nostd/function_ref.h"
+#include "opentelemetry/sdk/common/exporter_utils.h"
 #include "opentelemetry/sdk/common/global_log_handler.h"
 #include "opentelemetry/sdk/metrics/export/metric_producer.h"
 #include "opentelemetry/sdk/metrics/export/periodic_exporting_metric_reader.h"
 #include "opentelemetry/sdk/metrics/export/periodic_exporting_metric_reader_options.h"
 #include "opentelemetry/sdk/metrics/export/periodic_exporting_metric_reader_runtime_options.h"
+#include "opentelemetry/sdk/metrics/metric_reader.h"
 #include "opentelemetry/sdk/metrics/push_metric_exporter.h"
 #include "opentelemetry/version.h"
 
@@ -85,6 +87,17 @@ AggregationTemporality PeriodicExportingMetricReader::GetAggregationTemporality(
 {
   return exporter_->GetAggregationTemporality(instrument_type);
 }
+
+MetricExportStats PeriodicExportingMetricReader::GetExportStats() const noexcept
+{
+  MetricExportStats stats;
+  stats.export_count    = export_count_.load(std::memory_order_relaxed);
+  stats.failure_count   = export_failure_count_.load(std::memory_order_relaxed);
+  stats.export_duration = std::chrono::nanoseconds(
+      static_cast<int64_t>(export_duration_ns_.load(std::memory_order_relaxed)));
+  return stats;
+}
+
 void PeriodicExportingMetricReader::OnInitialized() noexcept
 {
   worker_thread_ = std::thread(&PeriodicExportingMetricReader::DoBackgroundWork, this);
@@ -175,7 +188,17 @@ bool PeriodicExportingMetricReader::CollectAndExportOnce()
             << this->export_timeout_millis_.count() << " ms, and timed out");
         return false;
       }
-      this->exporter_->Export(metric_data);
+      auto export_start    = std::chrono::steady_clock::now();
+      auto result          = this->exporter_->Export(metric_data);
+      auto export_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - export_start);
+      export_duration_ns_.fetch_add(static_cast<uint64_t>(export_duration.count()),
+                                    std::memory_order_relaxed);
+      export_count_.fetch_add(1, std::memory_order_relaxed);
+      if (result != opentelemetry::sdk::common::ExportResult::kSuccess)
+      {
+        export_failure_count_.fetch_add(1, std::memory_order_relaxed);
+      }
       return true;
     });
 
@@ -1,79 +1,74 @@
 // Copyright The OpenTelemetry Authors
 // SPDX-License-Identifier: Apache-2.0
 
-#include "opentelemetry/sdk/metrics/instrument_metadata_validator.h"
+#include <cstddef>
+
 #include "opentelemetry/nostd/string_view.h"
+#include "opentelemetry/sdk/metrics/instrument_metadata_validator.h"
 #include "opentelemetry/version.h"
 
-#if OPENTELEMETRY_HAVE_WORKING_REGEX
-#  include <regex>
-#else
-#  include <algorithm>
-#  include <cctype>
-#endif
-
 OPENTELEMETRY_BEGIN_NAMESPACE
 namespace sdk
 {
 namespace metrics
 {
-#if OPENTELEMETRY_HAVE_WORKING_REGEX
+
+namespace
+{
+
 // instrument-name = ALPHA 0*254 ("_" / "." / "-" / "/" / ALPHA / DIGIT)
-constexpr const char *kInstrumentNamePattern = "[a-zA-Z][-_./a-zA-Z0-9]{0,254}";
-//
-constexpr const char *kInstrumentUnitPattern = "[\x01-\x7F]{0,63}";
+constexpr size_t kMaxInstrumentNameSize = 255;
 // instrument-unit = It can have a maximum length of 63 ASCII chars
-#endif
+constexpr size_t kMaxInstrumentUnitSize = 63;
 
-InstrumentMetaDataValidator::InstrumentMetaDataValidator()
-#if OPENTELEMETRY_HAVE_WORKING_REGEX
-    // clang-format off
-    : name_reg_key_{kInstrumentNamePattern},
-      unit_reg_key_{kInstrumentUnitPattern}
-// clang-format on
-#endif
-{}
+// The character classes are tested explicitly rather than with <cctype>, which depends on the
+// locale.
+inline bool IsAlpha(char c) noexcept
+{
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
 
-bool InstrumentMetaDataValidator::ValidateName(nostd::string_view name) const
+inline bool IsNameChar(char c) noexcept
 {
+  return IsAlpha(c) || (c >= '0' && c <= '9') || c == '_' || c == '.' || c == '-' || c == '/';
+}
+
+}  // namespace
+
+InstrumentMetaDataValidator::InstrumentMetaDataValidator() {}
 
-#if OPENTELEMETRY_HAVE_WORKING_REGEX
-  return std::regex_match(name.data(), name_reg_key_);
-#else
-  const size_t kMaxSize = 255;
-  // size atmost 255 chars
-  if (name.size() > kMaxSize)
+bool InstrumentMetaDataValidator::ValidateName(nostd::string_view name) const
+{
+  if (name.empty() || name.size() > kMaxInstrumentNameSize || !IsAlpha(name[0]))
   {
     return false;
   }
-  // first char should be alpha
-  if (!std::isalpha(name[0]))
+  for (size_t i = 1; i < name.size(); i++)
   {
-    return false;
+    if (!IsNameChar(name[i]))
+    {
+      return false;
+    }
   }
-  // subsequent chars should be either of alphabets, digits, underscore,
-  // minus, dot, slash
-  return !std::any_of(std::next(name.begin()), name.end(), [](char c) {
-    return !std::isalnum(c) && (c != '-') && (c != '_') && (c != '.') && (c != '/');
-  });
-#endif
+  return true;
 }
 
 bool InstrumentMetaDataValidator::ValidateUnit(nostd::string_view unit) const
 {
-#if OPENTELEMETRY_HAVE_WORKING_REGEX
-  return std::regex_match(unit.data(), unit_reg_key_);
-#else
-  const size_t kMaxSize = 63;
-  // length atmost 63 chars
-  if (unit.size() > kMaxSize)
+  if (unit.size() > kMaxInstrumentUnitSize)
   {
     return false;
   }
-  // all should be ascii chars.
-  return !std::any_of(unit.begin(), unit.end(),
-                      [](char c) { return static_cast<unsigned char>(c) > 127; });
-#endif
+  // All the characters should be non null ASCII characters.
+  for (char c : unit)
+  {
+    const unsigned char uc = static_cast<unsigned char>(c);
+    if (uc == 0 || uc > 127)
+    {
+      return false;
+    }
+  }
+  return true;
 }
 
 bool InstrumentMetaDataValidator::ValidateDescription(nostd::string_view /*description*/) const
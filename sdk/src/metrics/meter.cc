@@ -1,6 +1,7 @@
 // Copyright The OpenTelemetry Authors
 // SPDX-License-Identifier: Apache-2.0
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <mutex>
@@ -28,9 +29,11 @@
 #include "opentelemetry/sdk/metrics/meter_config.h"
 #include "opentelemetry/sdk/metrics/meter_context.h"
 #include "opentelemetry/sdk/metrics/state/async_metric_storage.h"
+#include "opentelemetry/sdk/metrics/state/collection_executor.h"
 #include "opentelemetry/sdk/metrics/state/metric_collector.h"
 #include "opentelemetry/sdk/metrics/state/metric_storage.h"
 #include "opentelemetry/sdk/metrics/state/multi_metric_storage.h"
+#include "opentelemetry/sdk/metrics/state/observable_callback_executor.h"
 #include "opentelemetry/sdk/metrics/state/observable_registry.h"
 #include "opentelemetry/sdk/metrics/state/sync_metric_storage.h"
 #include "opentelemetry/sdk/metrics/sync_instruments.h"
@@ -645,7 +648,6 @@ std::vector<MetricData> Meter::Collect(CollectorHandle *collector,
   {
     return std::vector<MetricData>();
   }
-  observable_registry_->Observe(collect_ts);
   std::vector<MetricData> metric_data_list;
   auto ctx = meter_context_.lock();
   if (!ctx)
@@ -654,18 +656,66 @@ std::vector<MetricData> Meter::Collect(CollectorHandle *collector,
                             << "The metric context is invalid");
     return std::vector<MetricData>{};
   }
+  observable_registry_->Observe(collect_ts, ctx->GetObservableCallbackExecutor());
   std::lock_guard<std::mutex> guard(storage_lock_);
+  CollectionExecutor *executor = ctx->GetCollectionExecutor();
+  if (executor == nullptr || storage_registry_.size() <= 1)
+  {
+    for (auto &metric_storage : storage_registry_)
+    {
+      metric_storage.second->Collect(collector, ctx->GetCollectors(), ctx->GetSDKStartTime(),
+                                     collect_ts, [&metric_data_list](MetricData metric_data) {
+                                       metric_data_list.push_back(std::move(metric_data));
+                                       return true;
+                                     });
+    }
+    return metric_data_list;
+  }
+
+  // Each storage is collected into its own list, and the lists are then concatenated in the order
+  // of the registry, as in a sequential collection.
+  std::vector<MetricStorage *> storages;
+  storages.reserve(storage_registry_.size());
   for (auto &metric_storage : storage_registry_)
   {
-    metric_storage.second->Collect(collector, ctx->GetCollectors(), ctx->GetSDKStartTime(),
-                                   collect_ts, [&metric_data_list](const MetricData &metric_data) {
-                                     metric_data_list.push_back(metric_data);
-                                     return true;
-                                   });
+    storages.push_back(metric_storage.second.get());
+  }
+  std::vector<std::vector<MetricData>> storage_metric_data(storages.size());
+  auto collectors   = ctx->GetCollectors();
+  auto sdk_start_ts = ctx->GetSDKStartTime();
+  executor->ForEach(storages.size(), [&](size_t i) {
+    std::vector<MetricData> &storage_data = storage_metric_data[i];
+    storages[i]->Collect(collector, collectors, sdk_start_ts, collect_ts,
+                         [&storage_data](MetricData metric_data) {
+                           storage_data.push_back(std::move(metric_data));
+                           return true;
+                         });
+  });
+  for (auto &storage_data : storage_metric_data)
+  {
+    for (auto &metric_data : storage_data)
+    {
+      metric_data_list.emplace_back(std::move(metric_data));
+    }
   }
   return metric_data_list;
 }
 
+bool Meter::ForEachMetricStorage(
+    nostd::function_ref<bool(const InstrumentDescriptor &, const MetricStorage &)>
+        callback) noexcept
+{
+  std::lock_guard<std::mutex> guard(storage_lock_);
+  for (auto &metric_storage : storage_registry_)
+  {
+    if (!callback(metric_storage.first, *metric_storage.second))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 #if OPENTELEMETRY_ABI_VERSION_NO >= 2
 uintptr_t Meter::RegisterCallback(
     opentelemetry::metrics::MultiObservableCallbackPtr callback,
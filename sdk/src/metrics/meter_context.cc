@@ -24,6 +24,8 @@
 #include "opentelemetry/sdk/metrics/meter_config.h"
 #include "opentelemetry/sdk/metrics/meter_context.h"
 #include "opentelemetry/sdk/metrics/metric_reader.h"
+#include "opentelemetry/sdk/metrics/state/collection_executor.h"
+#include "opentelemetry/sdk/metrics/state/observable_callback_executor.h"
 #include "opentelemetry/sdk/metrics/state/metric_collector.h"
 #include "opentelemetry/sdk/metrics/view/instrument_selector.h"
 #include "opentelemetry/sdk/metrics/view/meter_selector.h"
@@ -141,6 +143,13 @@ nostd::span<std::shared_ptr<Meter>> MeterContext::GetMeters() noexcept
   return nostd::span<std::shared_ptr<Meter>>{meters_.data(), meters_.size()};
 }
 
+std::shared_ptr<const std::vector<std::shared_ptr<Meter>>>
+MeterContext::GetMetersSnapshot() noexcept
+{
+  std::lock_guard<std::mutex> guard(meters_snapshot_lock_);
+  return meters_snapshot_;
+}
+
 nostd::span<std::shared_ptr<CollectorHandle>> MeterContext::GetCollectors() noexcept
 {
   return nostd::span<std::shared_ptr<CollectorHandle>>(collectors_.data(), collectors_.size());
@@ -151,6 +160,28 @@ opentelemetry::common::SystemTimestamp MeterContext::GetSDKStartTime() noexcept
   return sdk_start_ts_;
 }
 
+void MeterContext::SetCollectionExecutor(
+    std::shared_ptr<CollectionExecutor> collection_executor) noexcept
+{
+  collection_executor_ = std::move(collection_executor);
+}
+
+CollectionExecutor *MeterContext::GetCollectionExecutor() const noexcept
+{
+  return collection_executor_.get();
+}
+
+void MeterContext::SetObservableCallbackExecutor(
+    std::shared_ptr<ObservableCallbackExecutor> callback_executor) noexcept
+{
+  callback_executor_ = std::move(callback_executor);
+}
+
+ObservableCallbackExecutor *MeterContext::GetObservableCallbackExecutor() const noexcept
+{
+  return callback_executor_.get();
+}
+
 void MeterContext::AddMetricReader(std::shared_ptr<MetricReader> reader,
                                    std::unique_ptr<MetricFilter> metric_filter) noexcept
 {
@@ -184,6 +215,9 @@ void MeterContext::AddMeter(const std::shared_ptr<Meter> &meter)
 {
   std::lock_guard<std::mutex> guard(meter_lock_);
   meters_.push_back(meter);
+  auto snapshot = std::make_shared<const std::vector<std::shared_ptr<Meter>>>(meters_);
+  std::lock_guard<std::mutex> snapshot_guard(meters_snapshot_lock_);
+  meters_snapshot_ = std::move(snapshot);
 }
 
 void MeterContext::RemoveMeter(nostd::string_view name,
@@ -210,6 +244,9 @@ void MeterContext::RemoveMeter(nostd::string_view name,
   }
 
   meters_.swap(filtered_meters);
+  auto snapshot = std::make_shared<const std::vector<std::shared_ptr<Meter>>>(meters_);
+  std::lock_guard<std::mutex> snapshot_guard(meters_snapshot_lock_);
+  meters_snapshot_ = std::move(snapshot);
 }
 
 bool MeterContext::Shutdown(std::chrono::microseconds timeout) noexcept
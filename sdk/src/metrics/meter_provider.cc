@@ -3,6 +3,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <memory>
 #include <mutex>
 #include <utility>
 
@@ -19,11 +20,15 @@
 #include "opentelemetry/sdk/metrics/meter_context.h"
 #include "opentelemetry/sdk/metrics/meter_provider.h"
 #include "opentelemetry/sdk/metrics/metric_reader.h"
+#include "opentelemetry/sdk/metrics/self_observability.h"
+#include "opentelemetry/sdk/metrics/state/collection_executor.h"
+#include "opentelemetry/sdk/metrics/state/observable_callback_executor.h"
 #include "opentelemetry/sdk/metrics/view/instrument_selector.h"
 #include "opentelemetry/sdk/metrics/view/meter_selector.h"
 #include "opentelemetry/sdk/metrics/view/view.h"
 #include "opentelemetry/sdk/metrics/view/view_registry.h"
 #include "opentelemetry/sdk/resource/resource.h"
+#include "opentelemetry/sdk/version/version.h"
 #include "opentelemetry/version.h"
 
 #ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
@@ -130,6 +135,28 @@ void MeterProvider::AddView(std::unique_ptr<InstrumentSelector> instrument_selec
   context_->AddView(std::move(instrument_selector), std::move(meter_selector), std::move(view));
 }
 
+void MeterProvider::SetCollectionExecutor(
+    std::shared_ptr<CollectionExecutor> collection_executor) noexcept
+{
+  context_->SetCollectionExecutor(std::move(collection_executor));
+}
+
+void MeterProvider::SetObservableCallbackExecutor(
+    std::shared_ptr<ObservableCallbackExecutor> callback_executor) noexcept
+{
+  context_->SetObservableCallbackExecutor(std::move(callback_executor));
+}
+
+void MeterProvider::EnableSelfObservability() noexcept
+{
+  auto meter = GetMeter(kSelfObservabilityMeterName, OPENTELEMETRY_SDK_VERSION);
+  const std::lock_guard<std::mutex> guard(lock_);
+  if (!self_observability_)
+  {
+    self_observability_.reset(new MetricsSelfObservability(context_.get(), *meter));
+  }
+}
+
 #ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
 
 void MeterProvider::SetExemplarFilter(metrics::ExemplarFilterType exemplar_filter_type) noexcept
@@ -0,0 +1,242 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "opentelemetry/common/attribute_value.h"
+#include "opentelemetry/metrics/async_instruments.h"
+#include "opentelemetry/metrics/meter.h"
+#include "opentelemetry/metrics/observer_result.h"
+#include "opentelemetry/nostd/function_ref.h"
+#include "opentelemetry/nostd/shared_ptr.h"
+#include "opentelemetry/nostd/string_view.h"
+#include "opentelemetry/nostd/variant.h"
+#include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
+#include "opentelemetry/sdk/metrics/instruments.h"
+#include "opentelemetry/sdk/metrics/meter.h"
+#include "opentelemetry/sdk/metrics/meter_context.h"
+#include "opentelemetry/sdk/metrics/metric_reader.h"
+#include "opentelemetry/sdk/metrics/self_observability.h"
+#include "opentelemetry/sdk/metrics/state/metric_collector.h"
+#include "opentelemetry/sdk/metrics/state/metric_storage.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+
+namespace
+{
+
+using Attributes =
+    std::initializer_list<std::pair<nostd::string_view, opentelemetry::common::AttributeValue>>;
+
+template <class T>
+void ObserveValue(opentelemetry::metrics::ObserverResult &result, T value, Attributes attributes)
+{
+  using ObserverResultPtr = nostd::shared_ptr<opentelemetry::metrics::ObserverResultT<T>>;
+  if (nostd::holds_alternative<ObserverResultPtr>(result))
+  {
+    nostd::get<ObserverResultPtr>(result)->Observe(value, attributes);
+  }
+}
+
+double ToSeconds(std::chrono::nanoseconds duration)
+{
+  return std::chrono::duration_cast<std::chrono::duration<double>>(duration).count();
+}
+
+std::string ComponentName(size_t index)
+{
+  return "metric_reader/" + std::to_string(index);
+}
+
+}  // namespace
+
+MetricsSelfObservability::MetricsSelfObservability(MeterContext *context,
+                                                   opentelemetry::metrics::Meter &meter) noexcept
+    : context_(context),
+      storage_series_(meter.CreateInt64ObservableGauge(
+          "otel.sdk.metric.storage.series",
+          "The number of series built by the last collection of the metric storage.",
+          "{series}")),
+      storage_overflow_(meter.CreateInt64ObservableCounter(
+          "otel.sdk.metric.storage.overflow",
+          "The number of measurements routed to the overflow series of the metric storage.",
+          "{measurement}")),
+      storage_memory_(meter.CreateInt64ObservableGauge(
+          "otel.sdk.metric.storage.memory",
+          "An estimate of the memory held by the series of the metric storage.",
+          "By")),
+      collection_count_(
+          meter.CreateInt64ObservableCounter("otel.sdk.metric_reader.collection.count",
+                                             "The number of collections of the metric reader.",
+                                             "{collection}")),
+      collection_duration_(meter.CreateDoubleObservableCounter(
+          "otel.sdk.metric_reader.collection.duration",
+          "The total duration of the collections of the metric reader.",
+          "s")),
+      export_count_(
+          meter.CreateInt64ObservableCounter("otel.sdk.metric_reader.export.count",
+                                             "The number of exports of the metric reader.",
+                                             "{export}")),
+      export_failed_(
+          meter.CreateInt64ObservableCounter("otel.sdk.metric_reader.export.failed",
+                                             "The number of failed exports of the metric reader.",
+                                             "{export}")),
+      export_duration_(meter.CreateDoubleObservableCounter(
+          "otel.sdk.metric_reader.export.duration",
+          "The total duration of the exports of the metric reader.",
+          "s"))
+{
+  storage_series_->AddCallback(ObserveStorageSeries, this);
+  storage_overflow_->AddCallback(ObserveStorageOverflow, this);
+  storage_memory_->AddCallback(ObserveStorageMemory, this);
+  collection_count_->AddCallback(ObserveCollectionCount, this);
+  collection_duration_->AddCallback(ObserveCollectionDuration, this);
+  export_count_->AddCallback(ObserveExportCount, this);
+  export_failed_->AddCallback(ObserveExportFailed, this);
+  export_duration_->AddCallback(ObserveExportDuration, this);
+}
+
+void MetricsSelfObservability::ObserveStorageSeries(opentelemetry::metrics::ObserverResult result,
+                                                    void *state) noexcept
+{
+  static_cast<MetricsSelfObservability *>(state)->ForEachMetricStorage(
+      [&result](const instrumentationscope::InstrumentationScope &scope,
+                const InstrumentDescriptor &descriptor, const MetricStorage &storage) {
+        ObserveValue<int64_t>(result, static_cast<int64_t>(storage.GetSeriesCount()),
+                              {{"otel.scope.name", nostd::string_view{scope.GetName()}},
+                               {"otel.metric.name", nostd::string_view{descriptor.name_}}});
+      });
+}
+
+void MetricsSelfObservability::ObserveStorageOverflow(
+    opentelemetry::metrics::ObserverResult result,
+    void *state) noexcept
+{
+  static_cast<MetricsSelfObservability *>(state)->ForEachMetricStorage(
+      [&result](const instrumentationscope::InstrumentationScope &scope,
+                const InstrumentDescriptor &descriptor, const MetricStorage &storage) {
+        ObserveValue<int64_t>(result, static_cast<int64_t>(storage.GetOverflowCount()),
+                              {{"otel.scope.name", nostd::string_view{scope.GetName()}},
+                               {"otel.metric.name", nostd::string_view{descriptor.name_}}});
+      });
+}
+
+void MetricsSelfObservability::ObserveStorageMemory(opentelemetry::metrics::ObserverResult result,
+                                                    void *state) noexcept
+{
+  static_cast<MetricsSelfObservability *>(state)->ForEachMetricStorage(
+      [&result](const instrumentationscope::InstrumentationScope &scope,
+                const InstrumentDescriptor &descriptor, const MetricStorage &storage) {
+        ObserveValue<int64_t>(result, static_cast<int64_t>(storage.GetMemoryUsage()),
+                              {{"otel.scope.name", nostd::string_view{scope.GetName()}},
+                               {"otel.metric.name", nostd::string_view{descriptor.name_}}});
+      });
+}
+
+void MetricsSelfObservability::ObserveCollectionCount(
+    opentelemetry::metrics::ObserverResult result,
+    void *state) noexcept
+{
+  static_cast<MetricsSelfObservability *>(state)->ForEachCollector(
+      [&result](size_t index, const MetricCollector &collector) {
+        const std::string component_name = ComponentName(index);
+        ObserveValue<int64_t>(result, static_cast<int64_t>(collector.GetCollectionCount()),
+                              {{"otel.component.name", nostd::string_view{component_name}}});
+      });
+}
+
+void MetricsSelfObservability::ObserveCollectionDuration(
+    opentelemetry::metrics::ObserverResult result,
+    void *state) noexcept
+{
+  static_cast<MetricsSelfObservability *>(state)->ForEachCollector(
+      [&result](size_t index, const MetricCollector &collector) {
+        const std::string component_name = ComponentName(index);
+        ObserveValue<double>(result, ToSeconds(collector.GetCollectionDuration()),
+                             {{"otel.component.name", nostd::string_view{component_name}}});
+      });
+}
+
+void MetricsSelfObservability::ObserveExportCount(opentelemetry::metrics::ObserverResult result,
+                                                  void *state) noexcept
+{
+  static_cast<MetricsSelfObservability *>(state)->ForEachCollector(
+      [&result](size_t index, const MetricCollector &collector) {
+        const std::string component_name = ComponentName(index);
+        MetricExportStats stats          = collector.GetMetricReader()->GetExportStats();
+        ObserveValue<int64_t>(result, static_cast<int64_t>(stats.export_count),
+                              {{"otel.component.name", nostd::string_view{component_name}}});
+      });
+}
+
+void MetricsSelfObservability::ObserveExportFailed(opentelemetry::metrics::ObserverResult result,
+                                                   void *state) noexcept
+{
+  static_cast<MetricsSelfObservability *>(state)->ForEachCollector(
+      [&result](size_t index, const MetricCollector &collector) {
+        const std::string component_name = ComponentName(index);
+        MetricExportStats stats          = collector.GetMetricReader()->GetExportStats();
+        ObserveValue<int64_t>(result, static_cast<int64_t>(stats.failure_count),
+                              {{"otel.component.name", nostd::string_view{component_name}}});
+      });
+}
+
+void MetricsSelfObservability::ObserveExportDuration(
+    opentelemetry::metrics::ObserverResult result,
+    void *state) noexcept
+{
+  static_cast<MetricsSelfObservability *>(state)->ForEachCollector(
+      [&result](size_t index, const MetricCollector &collector) {
+        const std::string component_name = ComponentName(index);
+        MetricExportStats stats          = collector.GetMetricReader()->GetExportStats();
+        ObserveValue<double>(result, ToSeconds(stats.export_duration),
+                             {{"otel.component.name", nostd::string_view{component_name}}});
+      });
+}
+
+void MetricsSelfObservability::ForEachMetricStorage(
+    nostd::function_ref<void(const instrumentationscope::InstrumentationScope &,
+                             const InstrumentDescriptor &,
+                             const MetricStorage &)> callback) const noexcept
+{
+  auto meters = context_->GetMetersSnapshot();
+  if (meters == nullptr)
+  {
+    return;
+  }
+  for (const auto &meter : *meters)
+  {
+    const instrumentationscope::InstrumentationScope &scope = *meter->GetInstrumentationScope();
+    meter->ForEachMetricStorage(
+        [&](const InstrumentDescriptor &descriptor, const MetricStorage &storage) {
+          callback(scope, descriptor, storage);
+          return true;
+        });
+  }
+}
+
+void MetricsSelfObservability::ForEachCollector(
+    nostd::function_ref<void(size_t index, const MetricCollector &)> callback) const noexcept
+{
+  auto collectors = context_->GetCollectors();
+  for (size_t i = 0; i < collectors.size(); i++)
+  {
+    callback(i, *std::static_pointer_cast<MetricCollector>(collectors[i]));
+  }
+}
+
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
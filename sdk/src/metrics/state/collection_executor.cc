@@ -0,0 +1,142 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "opentelemetry/nostd/function_ref.h"
+#include "opentelemetry/sdk/metrics/state/collection_executor.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+
+namespace
+{
+
+// Number of chunks claimed by each thread on average. More chunks balance the load better when
+// the tasks take different times, at the cost of more contention on the shared cursor.
+constexpr size_t kChunksPerThread = 8;
+
+}  // namespace
+
+CollectionExecutor::CollectionExecutor(size_t parallelism) : parallelism_(parallelism)
+{
+  if (parallelism_ == 0)
+  {
+    parallelism_ = (std::max)(std::thread::hardware_concurrency(), 1u);
+  }
+  workers_.reserve(parallelism_ - 1);
+  for (size_t i = 1; i < parallelism_; i++)
+  {
+    workers_.emplace_back(&CollectionExecutor::DoWork, this);
+  }
+}
+
+CollectionExecutor::~CollectionExecutor()
+{
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    is_shutdown_ = true;
+  }
+  work_cv_.notify_all();
+  for (auto &worker : workers_)
+  {
+    worker.join();
+  }
+}
+
+void CollectionExecutor::ForEach(size_t count, nostd::function_ref<void(size_t)> task) noexcept
+{
+  bool expected = false;
+  if (workers_.empty() || count <= 1 ||
+      !busy_.compare_exchange_strong(expected, true, std::memory_order_acquire))
+  {
+    for (size_t i = 0; i < count; i++)
+    {
+      task(i);
+    }
+    return;
+  }
+
+  const size_t chunk = (std::max)(count / (parallelism_ * kChunksPerThread), size_t{1});
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    task_  = &task;
+    count_ = count;
+    chunk_ = chunk;
+    next_.store(0, std::memory_order_relaxed);
+    running_workers_ = workers_.size();
+    generation_++;
+  }
+  work_cv_.notify_all();
+
+  RunTasks(task, count, chunk);
+
+  {
+    std::unique_lock<std::mutex> guard(lock_);
+    done_cv_.wait(guard, [this] { return running_workers_ == 0; });
+    task_ = nullptr;
+  }
+  busy_.store(false, std::memory_order_release);
+}
+
+void CollectionExecutor::DoWork()
+{
+  uint64_t generation = 0;
+  std::unique_lock<std::mutex> guard(lock_);
+  for (;;)
+  {
+    work_cv_.wait(guard, [this, generation] { return is_shutdown_ || generation_ != generation; });
+    if (is_shutdown_)
+    {
+      return;
+    }
+    // Every worker takes part in each generation, so that none can be missed.
+    generation = generation_;
+    const nostd::function_ref<void(size_t)> task = *task_;
+    const size_t count                           = count_;
+    const size_t chunk                           = chunk_;
+    guard.unlock();
+
+    RunTasks(task, count, chunk);
+
+    guard.lock();
+    if (--running_workers_ == 0)
+    {
+      done_cv_.notify_one();
+    }
+  }
+}
+
+void CollectionExecutor::RunTasks(nostd::function_ref<void(size_t)> task,
+                                  size_t count,
+                                  size_t chunk) noexcept
+{
+  for (;;)
+  {
+    const size_t begin = next_.fetch_add(chunk, std::memory_order_relaxed);
+    if (begin >= count)
+    {
+      return;
+    }
+    const size_t end = (std::min)(begin + chunk, count);
+    for (size_t i = begin; i < end; i++)
+    {
+      task(i);
+    }
+  }
+}
+
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
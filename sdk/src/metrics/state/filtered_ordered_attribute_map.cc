@@ -1,8 +1,16 @@
 // Copyright The OpenTelemetry Authors
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
 #include "opentelemetry/sdk/metrics/state/filtered_ordered_attribute_map.h"
+#include "opentelemetry/common/attribute_value.h"
+#include "opentelemetry/common/key_value_iterable.h"
 #include "opentelemetry/nostd/function_ref.h"
+#include "opentelemetry/nostd/string_view.h"
+#include "opentelemetry/nostd/variant.h"
 #include "opentelemetry/sdk/common/attribute_utils.h"
 #include "opentelemetry/sdk/metrics/view/attributes_processor.h"
 
@@ -11,6 +19,89 @@ namespace sdk
 {
 namespace metrics
 {
+namespace
+{
+
+// Hashes of the attributes of a KeyValueIterable, sorted by key as in the map built from it. The
+// last value of a duplicated key wins, as in the map. Small attribute sets are kept inline.
+class SortedAttributeHashes
+{
+public:
+  void Insert(nostd::string_view key, size_t hash)
+  {
+    if (overflow_.empty())
+    {
+      if (Replace(inline_, inline_ + size_, key, hash))
+      {
+        return;
+      }
+      if (size_ < kInlineSize)
+      {
+        InsertAt(inline_, inline_ + size_++, key, hash);
+        return;
+      }
+      overflow_.assign(inline_, inline_ + size_);
+    }
+    if (!Replace(overflow_.data(), overflow_.data() + overflow_.size(), key, hash))
+    {
+      auto it = std::lower_bound(overflow_.begin(), overflow_.end(), key, KeyLess);
+      overflow_.insert(it, KeyHash{key, hash});
+    }
+  }
+
+  size_t Combine() const noexcept
+  {
+    const KeyHash *first = overflow_.empty() ? inline_ : overflow_.data();
+    const size_t count   = overflow_.empty() ? size_ : overflow_.size();
+    size_t seed          = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+      AttributeValueHasher::Combine(seed, first[i].hash);
+    }
+    return seed;
+  }
+
+private:
+  struct KeyHash
+  {
+    nostd::string_view key;
+    size_t hash;
+  };
+
+  static bool KeyLess(const KeyHash &entry, nostd::string_view key) noexcept
+  {
+    return entry.key.compare(key) < 0;
+  }
+
+  // Replace the hash of an existing key, and return whether there was one.
+  static bool Replace(KeyHash *first, KeyHash *last, nostd::string_view key, size_t hash) noexcept
+  {
+    KeyHash *it = std::lower_bound(first, last, key, KeyLess);
+    if (it == last || it->key != key)
+    {
+      return false;
+    }
+    it->hash = hash;
+    return true;
+  }
+
+  // Insert a new key in [first, last), which has room for one more entry.
+  static void InsertAt(KeyHash *first, KeyHash *last, nostd::string_view key, size_t hash) noexcept
+  {
+    KeyHash *it = std::lower_bound(first, last, key, KeyLess);
+    std::move_backward(it, last, last + 1);
+    *it = KeyHash{key, hash};
+  }
+
+  static constexpr size_t kInlineSize = 16;
+
+  KeyHash inline_[kInlineSize];
+  size_t size_ = 0;
+  std::vector<KeyHash> overflow_;
+};
+
+}  // namespace
+
 FilteredOrderedAttributeMap::FilteredOrderedAttributeMap(
     const opentelemetry::common::KeyValueIterable &attributes,
     const AttributesProcessor *processor)
@@ -28,6 +119,52 @@ FilteredOrderedAttributeMap::FilteredOrderedAttributeMap(
   UpdateHash();
 }
 
+size_t FilteredOrderedAttributeMap::ComputeHash(
+    const opentelemetry::common::KeyValueIterable &attributes,
+    const AttributesProcessor *processor)
+{
+  SortedAttributeHashes hashes;
+  attributes.ForEachKeyValue(
+      [&](nostd::string_view key, opentelemetry::common::AttributeValue value) noexcept {
+        if (!processor || processor->isPresent(key))
+        {
+          hashes.Insert(key, AttributeValueHasher::HashAttribute(key, value));
+        }
+        return true;
+      });
+  return hashes.Combine();
+}
+
+bool FilteredOrderedAttributeMap::EqualTo(
+    const opentelemetry::common::KeyValueIterable &attributes,
+    const AttributesProcessor *processor) const
+{
+  size_t matched = 0;
+  bool equal     = true;
+  attributes.ForEachKeyValue(
+      [&](nostd::string_view key, opentelemetry::common::AttributeValue value) noexcept {
+        if (processor && !processor->isPresent(key))
+        {
+          return true;
+        }
+        // Attribute sets are small, so a linear scan is cheaper than building a std::string key
+        // for std::map::find().
+        auto it = begin();
+        while (it != end() && it->first != key)
+        {
+          ++it;
+        }
+        equal = it != end() &&
+                nostd::visit(opentelemetry::sdk::common::AttributeEqualToVisitor(), it->second,
+                             value);
+        matched++;
+        return equal;
+      });
+  // A duplicated key is counted twice, and reported as not equal to the map where the last value
+  // wins: the caller then falls back to building the map.
+  return equal && matched == size();
+}
+
 FilteredOrderedAttributeMap::FilteredOrderedAttributeMap(
     std::initializer_list<std::pair<nostd::string_view, opentelemetry::common::AttributeValue>>
         attributes,
@@ -1,8 +1,10 @@
 // Copyright The OpenTelemetry Authors
 // SPDX-License-Identifier: Apache-2.0
 
+#include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <ostream>
 #include <utility>
@@ -59,6 +61,7 @@ MetricProducer::Result MetricCollector::Produce() noexcept
                             << "The metric context is invalid");
     return {{}, MetricProducer::Status::kFailure};
   }
+  auto start = std::chrono::steady_clock::now();
   ResourceMetrics resource_metrics;
   meter_context_->ForEachMeter([&](const std::shared_ptr<Meter> &meter) noexcept {
     auto collection_ts = std::chrono::system_clock::now();
@@ -122,9 +125,30 @@ MetricProducer::Result MetricCollector::Produce() noexcept
     return true;
   });
   resource_metrics.resource_ = &meter_context_->GetResource();
+  auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start);
+  collection_duration_ns_.fetch_add(static_cast<uint64_t>(duration.count()),
+                                    std::memory_order_relaxed);
+  collection_count_.fetch_add(1, std::memory_order_relaxed);
   return {resource_metrics, MetricProducer::Status::kSuccess};
 }
 
+uint64_t MetricCollector::GetCollectionCount() const noexcept
+{
+  return collection_count_.load(std::memory_order_relaxed);
+}
+
+std::chrono::nanoseconds MetricCollector::GetCollectionDuration() const noexcept
+{
+  return std::chrono::nanoseconds(
+      static_cast<int64_t>(collection_duration_ns_.load(std::memory_order_relaxed)));
+}
+
+MetricReader *MetricCollector::GetMetricReader() const noexcept
+{
+  return metric_reader_.get();
+}
+
 bool MetricCollector::ForceFlush(std::chrono::microseconds timeout) noexcept
 {
   return metric_reader_->ForceFlush(timeout);
@@ -0,0 +1,93 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "opentelemetry/sdk/metrics/state/observable_callback_executor.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+
+ObservableCallbackExecutor::ObservableCallbackExecutor(size_t parallelism,
+                                                       std::chrono::milliseconds callback_timeout)
+    : parallelism_(parallelism), callback_timeout_(callback_timeout)
+{
+  if (parallelism_ == 0)
+  {
+    parallelism_ = (std::max)(std::thread::hardware_concurrency(), 1u);
+  }
+  // The workers are idle from the start, even before they wait for a job.
+  idle_workers_ = parallelism_ - 1;
+  workers_.reserve(parallelism_ - 1);
+  for (size_t i = 1; i < parallelism_; i++)
+  {
+    workers_.emplace_back(&ObservableCallbackExecutor::DoWork, this);
+  }
+}
+
+ObservableCallbackExecutor::~ObservableCallbackExecutor()
+{
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    is_shutdown_ = true;
+  }
+  work_cv_.notify_all();
+  for (auto &worker : workers_)
+  {
+    worker.join();
+  }
+}
+
+size_t ObservableCallbackExecutor::Dispatch(size_t count, const std::function<void()> &job)
+{
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    // Workers busy with a late callback are not waited for.
+    count = (std::min)(count, idle_workers_);
+    for (size_t i = 0; i < count; i++)
+    {
+      jobs_.push_back(job);
+    }
+    idle_workers_ -= count;
+  }
+  for (size_t i = 0; i < count; i++)
+  {
+    work_cv_.notify_one();
+  }
+  return count;
+}
+
+void ObservableCallbackExecutor::DoWork()
+{
+  std::unique_lock<std::mutex> guard(lock_);
+  for (;;)
+  {
+    work_cv_.wait(guard, [this] { return is_shutdown_ || !jobs_.empty(); });
+    if (jobs_.empty())
+    {
+      return;
+    }
+    std::function<void()> job = std::move(jobs_.front());
+    jobs_.pop_front();
+    guard.unlock();
+
+    job();
+
+    guard.lock();
+    idle_workers_++;
+  }
+}
+
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -1,10 +1,16 @@
 // Copyright The OpenTelemetry Authors
 // SPDX-License-Identifier: Apache-2.0
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "opentelemetry/common/key_value_iterable.h"
 #include "opentelemetry/common/timestamp.h"
@@ -18,6 +24,7 @@
 #include "opentelemetry/sdk/metrics/async_instruments.h"
 #include "opentelemetry/sdk/metrics/instruments.h"
 #include "opentelemetry/sdk/metrics/multi_observer_result.h"
+#include "opentelemetry/sdk/metrics/state/observable_callback_executor.h"
 #include "opentelemetry/sdk/metrics/state/observable_registry.h"
 #include "opentelemetry/version.h"
 
@@ -52,10 +59,49 @@ struct ObservableCallbackRecord
       callback;
   void *state;
   MultiObserverResult observable_result;
+
+  // The state of the invocation of the callback, guarded by the lock of the registry.
+  // Set while the record is used by an Observe() call, or by a late callback.
+  bool busy     = false;
+  bool started  = false;
+  bool returned = false;
+  // Set when the callback did not return in time: the thread invoking it releases the record.
+  bool late = false;
+  std::chrono::steady_clock::time_point start_time;
+};
+
+// The callbacks invoked by an Observe() call, shared with the worker threads which may still be
+// invoking a late callback after the call returned.
+struct ObserveRound
+{
+  std::vector<ObservableCallbackRecord *> records;
+  // Index of the next callback to claim.
+  std::atomic<size_t> next{0};
 };
 
-ObservableRegistry::ObservableRegistry()  = default;
-ObservableRegistry::~ObservableRegistry() = default;
+ObservableRegistry::ObservableRegistry() = default;
+
+ObservableRegistry::~ObservableRegistry()
+{
+  // Late callbacks may still be running on the threads of an executor.
+  std::unique_lock<std::mutex> lock{callbacks_m_};
+  callbacks_cv_.wait(lock, [this] { return busy_callbacks_ == 0; });
+}
+
+template <class Predicate>
+void ObservableRegistry::WaitForCallbacks(std::unique_lock<std::mutex> &lock, Predicate predicate)
+{
+  callbacks_cv_.wait(lock, [this, &predicate] {
+    for (const auto &pair : callbacks_)
+    {
+      if (pair.second->busy && predicate(*pair.second))
+      {
+        return false;
+      }
+    }
+    return true;
+  });
+}
 
 void ObservableRegistry::AddCallback(opentelemetry::metrics::ObservableCallbackPtr callback,
                                      void *state,
@@ -85,15 +131,18 @@ void ObservableRegistry::RemoveCallback(opentelemetry::metrics::ObservableCallba
                                         void *state,
                                         opentelemetry::metrics::ObservableInstrument *instrument)
 {
-  std::lock_guard<std::mutex> lock_guard{callbacks_m_};
+  // Remove the callback if it's registered with the the single-instrument signature
+  auto matches = [&](const ObservableCallbackRecord &record) {
+    auto observable_callback_ptr =
+        nostd::get_if<opentelemetry::metrics::ObservableCallbackPtr>(&record.callback);
+    return observable_callback_ptr && *observable_callback_ptr == callback &&
+           record.state == state && record.observable_result.HasInstrument(instrument);
+  };
+  std::unique_lock<std::mutex> lock{callbacks_m_};
+  WaitForCallbacks(lock, matches);
   for (auto it = callbacks_.begin(); it != callbacks_.end();)
   {
-    const auto &record = it->second;
-    // Remove the callback if it's registered with the the single-instrument signature
-    auto observable_callback_ptr =
-        nostd::get_if<opentelemetry::metrics::ObservableCallbackPtr>(&record->callback);
-    if (observable_callback_ptr && *observable_callback_ptr == callback && record->state == state &&
-        record->observable_result.HasInstrument(instrument))
+    if (matches(*it->second))
     {
       it = callbacks_.erase(it);
     }
@@ -106,13 +155,19 @@ void ObservableRegistry::RemoveCallback(opentelemetry::metrics::ObservableCallba
 
 void ObservableRegistry::RemoveCallback(uintptr_t id)
 {
-  std::lock_guard<std::mutex> lock_guard{callbacks_m_};
+  std::unique_lock<std::mutex> lock{callbacks_m_};
+  WaitForCallbacks(lock, [id](const ObservableCallbackRecord &record) {
+    return reinterpret_cast<uintptr_t>(&record) == id;
+  });
   callbacks_.erase(id);
 }
 
 void ObservableRegistry::CleanupCallback(opentelemetry::metrics::ObservableInstrument *instrument)
 {
-  std::lock_guard<std::mutex> lock_guard{callbacks_m_};
+  std::unique_lock<std::mutex> lock{callbacks_m_};
+  WaitForCallbacks(lock, [instrument](const ObservableCallbackRecord &record) {
+    return record.observable_result.HasInstrument(instrument);
+  });
   auto sdk_instrument = static_cast<ObservableInstrument *>(instrument);
   for (auto it = callbacks_.begin(); it != callbacks_.end();)
   {
@@ -212,16 +267,120 @@ struct InvokeCallbackVisitor
 };
 }  // namespace
 
-void ObservableRegistry::Observe(opentelemetry::common::SystemTimestamp collection_ts)
+void ObservableRegistry::Observe(opentelemetry::common::SystemTimestamp collection_ts,
+                                 ObservableCallbackExecutor *executor)
 {
-  std::lock_guard<std::mutex> lock_guard{callbacks_m_};
-  for (const auto &pair : callbacks_)
+  auto round = std::make_shared<ObserveRound>();
   {
-    auto &cb_record = pair.second;
-    cb_record->observable_result.Reset();
+    std::unique_lock<std::mutex> lock{callbacks_m_};
+    // Wait for the callbacks invoked by a concurrent Observe() call, as they are about to return.
+    WaitForCallbacks(lock, [](const ObservableCallbackRecord &record) { return !record.late; });
+    round->records.reserve(callbacks_.size());
+    for (const auto &pair : callbacks_)
+    {
+      ObservableCallbackRecord *record = pair.second.get();
+      if (record->busy)
+      {
+        // The callback is still running late from a previous collection.
+        if (executor != nullptr)
+        {
+          executor->RecordSkippedCallback();
+        }
+        continue;
+      }
+      record->busy     = true;
+      record->started  = false;
+      record->returned = false;
+      record->late     = false;
+      record->observable_result.Reset();
+      round->records.push_back(record);
+    }
+    busy_callbacks_ += round->records.size();
+  }
+  if (round->records.empty())
+  {
+    return;
+  }
+
+  size_t workers = 0;
+  if (executor != nullptr)
+  {
+    workers =
+        executor->Dispatch(round->records.size(), [this, round]() { InvokeCallbacks(*round); });
+  }
+  if (workers == 0)
+  {
+    InvokeCallbacks(*round);
+  }
+
+  std::unique_lock<std::mutex> lock{callbacks_m_};
+  for (ObservableCallbackRecord *record : round->records)
+  {
+    // Without workers, every callback returned before this loop.
+    while (!record->returned)
+    {
+      const std::chrono::milliseconds timeout = executor->GetCallbackTimeout();
+      if (!record->started)
+      {
+        if (callbacks_cv_.wait_for(lock, timeout) == std::cv_status::timeout && !record->started)
+        {
+          // The workers are busy with late callbacks: invoke the callbacks left on this thread.
+          lock.unlock();
+          InvokeCallbacks(*round);
+          lock.lock();
+        }
+      }
+      else if (callbacks_cv_.wait_until(lock, record->start_time + timeout) ==
+                   std::cv_status::timeout &&
+               !record->returned)
+      {
+        // The thread invoking the callback releases the record once it returns.
+        record->late = true;
+        executor->RecordLateCallback();
+        break;
+      }
+    }
+    if (record->returned)
+    {
+      record->observable_result.StoreResults(collection_ts);
+      record->busy = false;
+      busy_callbacks_--;
+    }
+  }
+  callbacks_cv_.notify_all();
+}
+
+void ObservableRegistry::InvokeCallbacks(ObserveRound &round)
+{
+  for (;;)
+  {
+    const size_t index = round.next.fetch_add(1, std::memory_order_relaxed);
+    if (index >= round.records.size())
+    {
+      return;
+    }
+    // The record is busy until it is released below or by the Observe() call, which keeps the
+    // record and the registry alive while the callback is invoked.
+    ObservableCallbackRecord *record = round.records[index];
+    {
+      std::lock_guard<std::mutex> lock_guard{callbacks_m_};
+      record->started    = true;
+      record->start_time = std::chrono::steady_clock::now();
+      callbacks_cv_.notify_all();
+    }
     // Visitor will either invoke the single-instrument or multi-instrument form of the callback
-    nostd::visit(InvokeCallbackVisitor{cb_record.get()}, cb_record->callback);
-    cb_record->observable_result.StoreResults(collection_ts);
+    nostd::visit(InvokeCallbackVisitor{record}, record->callback);
+    {
+      std::lock_guard<std::mutex> lock_guard{callbacks_m_};
+      record->returned = true;
+      if (record->late)
+      {
+        record->observable_result.Reset();
+        record->busy = false;
+        busy_callbacks_--;
+      }
+      callbacks_cv_.notify_all();
+    }
   }
 }
 
@@ -1,16 +1,21 @@
 // Copyright The OpenTelemetry Authors
 // SPDX-License-Identifier: Apache-2.0
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <utility>
 
 #include "opentelemetry/common/timestamp.h"
 #include "opentelemetry/nostd/function_ref.h"
 #include "opentelemetry/nostd/span.h"
+#include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
 #include "opentelemetry/sdk/metrics/aggregation/aggregation_config.h"
 #include "opentelemetry/sdk/metrics/data/metric_data.h"
 #include "opentelemetry/sdk/metrics/state/attributes_hashmap.h"
+#include "opentelemetry/sdk/metrics/state/sharded_attributes_hashmap.h"
 #include "opentelemetry/sdk/metrics/state/sync_metric_storage.h"
 #include "opentelemetry/sdk/metrics/state/temporal_metric_storage.h"
 #include "opentelemetry/version.h"
@@ -24,7 +29,6 @@
 
 #  include "opentelemetry/common/spin_lock_mutex.h"
 #  include "opentelemetry/sdk/common/global_log_handler.h"
-#  include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
 #  include "opentelemetry/sdk/metrics/data/exemplar_data.h"
 #  include "opentelemetry/sdk/metrics/instruments.h"
 #endif
@@ -45,16 +49,16 @@ bool SyncMetricStorage::Collect(CollectorHandle *collector,
   // this will also empty the delta metrics hashmap, and make it available for
   // recordings
   std::shared_ptr<AttributesHashMap> delta_metrics = nullptr;
-#ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
+#ifndef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
+  delta_metrics = attributes_hashmap_->Collect(create_default_aggregation_);
+  CollectNoAttributes(*delta_metrics);
+#else
   // Snapshot of bound entries (under map lock) that we will rotate without
   // holding the map lock. Each entry has its own spinlock for the swap.
   std::vector<std::shared_ptr<BoundEntry>> entry_snapshot;
-#endif
   {
     std::lock_guard<std::mutex> guard(attribute_hashmap_lock_);
-    delta_metrics = std::move(attributes_hashmap_);
-    attributes_hashmap_.reset(new AttributesHashMap(aggregation_config_->cardinality_limit_));
-#ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
+    delta_metrics = attributes_hashmap_->Collect(create_default_aggregation_);
     // Garbage-collect entries the user has dropped that have no pending data.
     // Cleanup happens during Collect(); if no collection runs, dropped bound
     // entries remain until storage destruction. We only erase entries the user
@@ -91,8 +95,8 @@ bool SyncMetricStorage::Collect(CollectorHandle *collector,
     {
       entry_snapshot.push_back(kv.second);
     }
-#endif
   }
+#endif
 
 #ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
   // Rotate dirty bound entries: under each entry's own spinlock, swap out the
@@ -113,15 +117,7 @@ bool SyncMetricStorage::Collect(CollectorHandle *collector,
       entry->dirty_   = false;
       attrs_copy      = entry->attributes_;
     }
-    auto *existing = delta_metrics->Get(attrs_copy);
-    if (existing)
-    {
-      delta_metrics->Set(attrs_copy, existing->Merge(*rotated));
-    }
-    else
-    {
-      delta_metrics->Set(std::move(attrs_copy), std::move(rotated));
-    }
+    delta_metrics->Merge(std::move(attrs_copy), *rotated, create_default_aggregation_);
   }
 
   // Targeted post-rotation cleanup. The pre-rotation GC pass cannot remove
@@ -182,6 +178,38 @@ bool SyncMetricStorage::Collect(CollectorHandle *collector,
                                                delta_metrics, callback);
 }
 
+#ifndef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
+void SyncMetricStorage::CollectNoAttributes(AttributesHashMap &delta_metrics) noexcept
+{
+  std::lock_guard<std::mutex> guard(no_attributes_collect_lock_);
+  // New measurements are recorded to the other cell from now on. The writers still registered on
+  // the collected cell may be recording to it, and are waited for.
+  const size_t index = active_no_attributes_cell_.load();
+  active_no_attributes_cell_.store(1 - index);
+  NoAttributesCell &cell = no_attributes_cells_[index];
+  while (cell.writers.load() != 0)
+  {
+    std::this_thread::yield();
+  }
+  if (!cell.recorded.load(std::memory_order_relaxed))
+  {
+    return;
+  }
+  cell.recorded.store(false, std::memory_order_relaxed);
+
+  static const MetricAttributes kNoAttributes{};
+  Aggregation *aggregation = cell.aggregation.load(std::memory_order_relaxed);
+
+  delta_metrics.Merge(kNoAttributes, *aggregation, create_default_aggregation_);
+  if (!aggregation->Reset())
+  {
+    // A new aggregation is created by the next measurement.
+    cell.aggregation.store(nullptr, std::memory_order_relaxed);
+    delete aggregation;
+  }
+}
+#endif
+
 #ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
 std::shared_ptr<BoundSyncWritableMetricStorage> SyncMetricStorage::Bind(
     const opentelemetry::common::KeyValueIterable &attributes) noexcept
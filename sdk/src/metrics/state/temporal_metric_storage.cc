@@ -1,8 +1,9 @@
 // Copyright The OpenTelemetry Authors
 // SPDX-License-Identifier: Apache-2.0
 
+#include <atomic>
 #include <chrono>
-#include <list>
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -49,14 +50,6 @@ bool TemporalMetricStorage::buildMetrics(CollectorHandle *collector,
   std::lock_guard<opentelemetry::common::SpinLockMutex> guard(lock_);
   AggregationTemporality aggregation_temporarily =
       collector->GetAggregationTemporality(instrument_descriptor_.type_);
-  // Per OTel spec (issue #4062): the start_ts for the first delta collection
-  // interval must be the instrument creation time, not the MeterProvider
-  // start time (which is what sdk_start_ts carries). For cumulative, sdk_start_ts
-  // is acceptable per spec ("creation of the instrument or the timestamp from
-  // when the SDK was started, whichever happened first").
-  opentelemetry::common::SystemTimestamp last_collection_ts =
-      (aggregation_temporarily == AggregationTemporality::kDelta) ? instrument_creation_ts_
-                                                                  : sdk_start_ts;
 
   // Fast path for single collector with delta temporality.
   // This path doesn't need to aggregated-with/contribute-to the unreported_metric_, as there is
@@ -70,6 +63,7 @@ bool TemporalMetricStorage::buildMetrics(CollectorHandle *collector,
       last_delta_collection_ts_     = instrument_creation_ts_;
       has_last_delta_collection_ts_ = true;
     }
+    series_count_.store(delta_metrics->Size(), std::memory_order_relaxed);
     // If no metrics, early return
     if (delta_metrics->Size() == 0)
     {
@@ -85,123 +79,162 @@ bool TemporalMetricStorage::buildMetrics(CollectorHandle *collector,
     last_delta_collection_ts_           = collection_ts;
 
     // Direct conversion of delta metrics to point data
-    delta_metrics->GetAllEntries(
-        [&metric_data](const MetricAttributes &attributes, Aggregation &aggregation) {
+    metric_data.point_data_attr_.reserve(delta_metrics->Size());
+    delta_metrics->GetAllSharedEntries(
+        [&metric_data](const std::shared_ptr<const MetricAttributes> &attributes,
+                       Aggregation &aggregation) {
           PointDataAttributes point_data_attr;
           point_data_attr.point_data = aggregation.ToPoint();
-          point_data_attr.attributes = attributes;
+          point_data_attr.attributes = PointAttributes(attributes);
           metric_data.point_data_attr_.emplace_back(std::move(point_data_attr));
           return true;
         });
-    return callback(metric_data);
+    return callback(std::move(metric_data));
   }
 
+  const size_t cardinality_limit =
+      aggregation_config_ ? aggregation_config_->cardinality_limit_ : kAggregationCardinalityLimit;
+  const bool evict_stale = aggregation_config_ && aggregation_config_->max_stale_collections_;
+
+  // Merge the newly collected delta once into the cumulative metrics shared by the collectors with
+  // cumulative temporality, and into the unreported metrics of each collector with delta
+  // temporality.
   if (delta_metrics->Size())
   {
+    bool has_cumulative_collector = false;
     for (auto &col : collectors)
     {
-      unreported_metrics_[col.get()].push_back(delta_metrics);
+      if (col->GetAggregationTemporality(instrument_descriptor_.type_) ==
+          AggregationTemporality::kCumulative)
+      {
+        has_cumulative_collector = true;
+        continue;
+      }
+      auto &unreported = unreported_metrics_[col.get()];
+      if (!unreported.attributes_map)
+      {
+        unreported.attributes_map.reset(new AttributesHashMap(cardinality_limit));
+        unreported.last_collection_ts = instrument_creation_ts_;
+      }
+      MergeInto(*unreported.attributes_map, *delta_metrics);
+    }
+    if (has_cumulative_collector)
+    {
+      if (!cumulative_metrics_)
+      {
+        cumulative_metrics_.reset(new AttributesHashMap(cardinality_limit));
+      }
+      if (evict_stale)
+      {
+        // The series created by this merge were first recorded after the previous merge.
+        cumulative_metrics_->SetStartTimestamp(last_merge_ts_);
+      }
+      MergeInto(*cumulative_metrics_, *delta_metrics);
     }
   }
+  last_merge_ts_ = collection_ts;
 
-  // Get the unreported metrics for the `collector` from `unreported metrics stash`
-  // since last collection, this will also cleanup the unreported metrics for `collector`
-  // from the stash.
-  auto present = unreported_metrics_.find(collector);
-  if (present == unreported_metrics_.end())
+  // Evict the cumulative series without measurements in the last max_stale_collections_
+  // collections, so that churning attribute sets do not grow the memory without bound. An evicted
+  // series is not exported anymore, and restarts from zero if it is recorded to again: it is then
+  // exported with its own start timestamp, the collection preceding its first measurement. The
+  // idle counters advance once per collection round, when the first collector collects, so that
+  // the number of readers does not shorten the eviction delay.
+  if (cumulative_metrics_ && evict_stale && collectors.size() > 0 &&
+      collectors[0].get() == collector)
   {
-    return true;
+    cumulative_metrics_->EvictStale(aggregation_config_->max_stale_collections_);
   }
-  auto unreported_list = std::move(present->second);
-  // Iterate over the unreporter metrics for `collector` and store result in `merged_metrics`
-  std::unique_ptr<AttributesHashMap> merged_metrics(
-      new AttributesHashMap(aggregation_config_ ? aggregation_config_->cardinality_limit_
-                                                : kAggregationCardinalityLimit));
-  for (auto &agg_hashmap : unreported_list)
+
+  // Per OTel spec (issue #4062): the start_ts for the first delta collection
+  // interval must be the instrument creation time, not the MeterProvider
+  // start time (which is what sdk_start_ts carries). For cumulative, sdk_start_ts
+  // is acceptable per spec ("creation of the instrument or the timestamp from
+  // when the SDK was started, whichever happened first").
+  MetricData metric_data;
+  metric_data.instrument_descriptor   = instrument_descriptor_;
+  metric_data.aggregation_temporality = aggregation_temporarily;
+  metric_data.end_ts                  = collection_ts;
+  AttributesHashMap *result_to_export = nullptr;
+  if (aggregation_temporarily == AggregationTemporality::kCumulative)
   {
-    agg_hashmap->GetAllEntries(
-        [&merged_metrics, this](const MetricAttributes &attributes, Aggregation &aggregation) {
-          auto agg = merged_metrics->Get(attributes);
-          if (agg)
-          {
-            merged_metrics->Set(attributes, agg->Merge(aggregation));
-          }
-          else
-          {
-            merged_metrics->Set(attributes,
-                                DefaultAggregation::CreateAggregation(
-                                    aggregation_type_, instrument_descriptor_, aggregation_config_)
-                                    ->Merge(aggregation));
-          }
-          return true;
-        });
+    metric_data.start_ts = sdk_start_ts;
+    result_to_export     = cumulative_metrics_.get();
   }
-  // Get the last reported metrics for the `collector` from `last reported metrics` stash
-  //   - If the aggregation_temporarily for the collector is cumulative
-  //       - Merge the last reported metrics with unreported metrics (which is in merged_metrics),
-  //           Final result of merge would be in merged_metrics.
-  //       - Move the final merge to the `last reported metrics` stash.
-  //   - If the aggregation_temporarily is delta
-  //       - Store the unreported metrics for `collector` (which is in merged_mtrics) to
-  //          `last reported metrics` stash.
-
-  auto reported = last_reported_metrics_.find(collector);
-  if (reported != last_reported_metrics_.end())
+  else
   {
-    auto last_aggr_hashmap = std::move(last_reported_metrics_[collector].attributes_map);
-    if (aggregation_temporarily == AggregationTemporality::kCumulative)
-    {
-      // merge current delta to previous cumulative
-      last_aggr_hashmap->GetAllEntries(
-          [&merged_metrics, this](const MetricAttributes &attributes, Aggregation &aggregation) {
-            auto agg = merged_metrics->Get(attributes);
-            if (agg)
-            {
-              merged_metrics->Set(attributes, agg->Merge(aggregation));
-            }
-            else
-            {
-              auto def_agg = DefaultAggregation::CreateAggregation(
-                  aggregation_type_, instrument_descriptor_, aggregation_config_);
-              merged_metrics->Set(attributes, def_agg->Merge(aggregation));
-            }
-            return true;
-          });
-    }
-    else
+    auto &unreported = unreported_metrics_[collector];
+    if (!unreported.attributes_map)
     {
-      last_collection_ts = last_reported_metrics_[collector].collection_ts;
+      unreported.attributes_map.reset(new AttributesHashMap(cardinality_limit));
+      unreported.last_collection_ts = instrument_creation_ts_;
     }
-    last_reported_metrics_[collector] =
-        LastReportedMetrics{std::move(merged_metrics), collection_ts};
-  }
-  else
-  {
-    last_reported_metrics_.insert(
-        std::make_pair(collector, LastReportedMetrics{std::move(merged_metrics), collection_ts}));
+    metric_data.start_ts          = unreported.last_collection_ts;
+    unreported.last_collection_ts = collection_ts;
+    result_to_export              = unreported.attributes_map.get();
   }
 
-  // Generate the MetricData from the final merged_metrics, and invoke callback over it.
-
-  AttributesHashMap *result_to_export = (last_reported_metrics_[collector]).attributes_map.get();
-  if (result_to_export->Size() == 0)
+  // Generate the MetricData from the metrics to export, and invoke callback over it.
+  series_count_.store(result_to_export ? result_to_export->Size() : 0, std::memory_order_relaxed);
+  if (result_to_export == nullptr || result_to_export->Size() == 0)
   {
     return true;
   }
-  MetricData metric_data;
-  metric_data.instrument_descriptor   = instrument_descriptor_;
-  metric_data.aggregation_temporality = aggregation_temporarily;
-  metric_data.start_ts                = last_collection_ts;
-  metric_data.end_ts                  = collection_ts;
-  result_to_export->GetAllEntries(
-      [&metric_data](const MetricAttributes &attributes, Aggregation &aggregation) {
+  metric_data.point_data_attr_.reserve(result_to_export->Size());
+  result_to_export->GetAllSharedEntriesWithStart(
+      [&metric_data](const std::shared_ptr<const MetricAttributes> &attributes,
+                     opentelemetry::common::SystemTimestamp start_ts, Aggregation &aggregation) {
         PointDataAttributes point_data_attr;
         point_data_attr.point_data = aggregation.ToPoint();
-        point_data_attr.attributes = attributes;
+        point_data_attr.attributes = PointAttributes(attributes);
+        point_data_attr.start_ts   = start_ts;
         metric_data.point_data_attr_.emplace_back(std::move(point_data_attr));
         return true;
       });
-  return callback(metric_data);
+  if (aggregation_temporarily == AggregationTemporality::kDelta)
+  {
+    // The unreported metrics were reported: reset them in place for the next collection.
+    result_to_export->Reset(aggregation_config_ ? aggregation_config_->max_idle_collections_ : 0,
+                            [this]() {
+                              return DefaultAggregation::CreateAggregation(
+                                  aggregation_type_, instrument_descriptor_, aggregation_config_);
+                            });
+  }
+  return callback(std::move(metric_data));
+}
+
+size_t TemporalMetricStorage::GetMemoryUsage() const noexcept
+{
+  std::lock_guard<opentelemetry::common::SpinLockMutex> guard(lock_);
+  size_t usage = 0;
+  if (cumulative_metrics_)
+  {
+    usage += sizeof(AttributesHashMap) + cumulative_metrics_->MemoryUsage();
+  }
+  for (auto &unreported : unreported_metrics_)
+  {
+    if (unreported.second.attributes_map)
+    {
+      usage += sizeof(AttributesHashMap) + unreported.second.attributes_map->MemoryUsage();
+    }
+  }
+  return usage;
+}
+
+void TemporalMetricStorage::MergeInto(AttributesHashMap &target,
+                                      const AttributesHashMap &delta) noexcept
+{
+  auto create_aggregation = [this]() {
+    return DefaultAggregation::CreateAggregation(aggregation_type_, instrument_descriptor_,
+                                                 aggregation_config_);
+  };
+  // The attribute sets of new entries are shared with the delta rather than copied.
+  delta.GetAllSharedEntries([&target, &create_aggregation](
+                                const std::shared_ptr<const MetricAttributes> &attributes,
+                                Aggregation &aggregation) {
+    target.Merge(attributes, aggregation, create_aggregation);
+    return true;
+  });
 }
 
 }  // namespace metrics
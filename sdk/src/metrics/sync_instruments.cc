@@ -1,11 +1,14 @@
 // Copyright The OpenTelemetry Authors
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
 #include <cstdint>
+#include <iterator>
 #include <limits>
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "opentelemetry/context/context.h"
 #include "opentelemetry/version.h"
@@ -14,6 +17,7 @@
 #  include "opentelemetry/metrics/sync_instruments.h"
 #endif
 
+#include "opentelemetry/nostd/span.h"
 #include "opentelemetry/nostd/unique_ptr.h"
 #include "opentelemetry/sdk/common/global_log_handler.h"
 #include "opentelemetry/sdk/metrics/instruments.h"
@@ -39,6 +43,65 @@ bool ToInt64Value(uint64_t value, const char *operation, int64_t &converted) noe
   return true;
 }
 
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+// Record a batch of unsigned values as int64_t values. Values exceeding int64_t max are not
+// recorded, like in the single value operations.
+void RecordUnsignedBatch(SyncWritableMetricStorage &storage,
+                         nostd::span<const uint64_t> values,
+                         const opentelemetry::common::KeyValueIterable &attributes,
+                         const char *operation) noexcept
+{
+  auto context           = opentelemetry::context::Context{};
+  const auto exceeds_max = [](uint64_t value) {
+    return value > static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+  };
+  if (std::none_of(values.begin(), values.end(), exceeds_max))
+  {
+    // Values up to int64_t max have the same representation in both types, so the batch does not
+    // need to be copied.
+    storage.RecordLongBatch(
+        nostd::span<const int64_t>{reinterpret_cast<const int64_t *>(values.data()), values.size()},
+        attributes, context);
+    return;
+  }
+  std::vector<int64_t> converted;
+  converted.reserve(values.size());
+  for (uint64_t value : values)
+  {
+    int64_t converted_value = 0;
+    if (ToInt64Value(value, operation, converted_value))
+    {
+      converted.push_back(converted_value);
+    }
+  }
+  storage.RecordLongBatch(nostd::span<const int64_t>{converted.data(), converted.size()},
+                          attributes, context);
+}
+
+// Record a batch of double values. Negative values are not recorded, like in the single value
+// operations.
+void RecordNonNegativeBatch(SyncWritableMetricStorage &storage,
+                            nostd::span<const double> values,
+                            const opentelemetry::common::KeyValueIterable &attributes,
+                            const char *operation,
+                            const std::string &name) noexcept
+{
+  auto context        = opentelemetry::context::Context{};
+  const auto negative = [](double value) { return value < 0; };
+  if (std::none_of(values.begin(), values.end(), negative))
+  {
+    storage.RecordDoubleBatch(values, attributes, context);
+    return;
+  }
+  OTEL_INTERNAL_LOG_WARN(operation << " Values not recorded - negative values for: " << name);
+  std::vector<double> non_negative;
+  non_negative.reserve(values.size());
+  std::remove_copy_if(values.begin(), values.end(), std::back_inserter(non_negative), negative);
+  storage.RecordDoubleBatch(nostd::span<const double>{non_negative.data(), non_negative.size()},
+                            attributes, context);
+}
+#endif
+
 }  // namespace
 
 LongCounter::LongCounter(const InstrumentDescriptor &instrument_descriptor,
@@ -117,6 +180,21 @@ void LongCounter::Add(uint64_t value, const opentelemetry::context::Context &con
   }
 }
 
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+void LongCounter::AddBatch(opentelemetry::nostd::span<const uint64_t> values,
+                           const opentelemetry::common::KeyValueIterable &attributes) noexcept
+{
+  if (!storage_)
+  {
+    OTEL_INTERNAL_LOG_WARN(
+        "[LongCounter::AddBatch(V,A)] Values not recorded - invalid storage for: "
+        << instrument_descriptor_.name_);
+    return;
+  }
+  RecordUnsignedBatch(*storage_, values, attributes, "[LongCounter::AddBatch(V,A)]");
+}
+#endif
+
 DoubleCounter::DoubleCounter(const InstrumentDescriptor &instrument_descriptor,
                              std::unique_ptr<SyncWritableMetricStorage> storage)
     : Synchronous(instrument_descriptor, std::move(storage))
@@ -201,6 +279,22 @@ void DoubleCounter::Add(double value, const opentelemetry::context::Context &con
   return storage_->RecordDouble(value, context);
 }
 
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+void DoubleCounter::AddBatch(opentelemetry::nostd::span<const double> values,
+                             const opentelemetry::common::KeyValueIterable &attributes) noexcept
+{
+  if (!storage_)
+  {
+    OTEL_INTERNAL_LOG_WARN(
+        "[DoubleCounter::AddBatch(V,A)] Values not recorded - invalid storage for: "
+        << instrument_descriptor_.name_);
+    return;
+  }
+  RecordNonNegativeBatch(*storage_, values, attributes, "[DoubleCounter::AddBatch(V,A)]",
+                         instrument_descriptor_.name_);
+}
+#endif
+
 LongUpDownCounter::LongUpDownCounter(const InstrumentDescriptor &instrument_descriptor,
                                      std::unique_ptr<SyncWritableMetricStorage> storage)
     : Synchronous(instrument_descriptor, std::move(storage))
@@ -527,6 +621,19 @@ void LongHistogram::Record(uint64_t value) noexcept
     return storage_->RecordLong(converted, context);
   }
 }
+
+void LongHistogram::RecordBatch(opentelemetry::nostd::span<const uint64_t> values,
+                                const opentelemetry::common::KeyValueIterable &attributes) noexcept
+{
+  if (!storage_)
+  {
+    OTEL_INTERNAL_LOG_WARN(
+        "[LongHistogram::RecordBatch(V,A)] Values not recorded - invalid storage for: "
+        << instrument_descriptor_.name_);
+    return;
+  }
+  RecordUnsignedBatch(*storage_, values, attributes, "[LongHistogram::RecordBatch(V,A)]");
+}
 #endif
 
 DoubleHistogram::DoubleHistogram(const InstrumentDescriptor &instrument_descriptor,
@@ -620,6 +727,21 @@ void DoubleHistogram::Record(double value) noexcept
   auto context = opentelemetry::context::Context{};
   return storage_->RecordDouble(value, context);
 }
+
+void DoubleHistogram::RecordBatch(
+    opentelemetry::nostd::span<const double> values,
+    const opentelemetry::common::KeyValueIterable &attributes) noexcept
+{
+  if (!storage_)
+  {
+    OTEL_INTERNAL_LOG_WARN(
+        "[DoubleHistogram::RecordBatch(V,A)] Values not recorded - invalid storage for: "
+        << instrument_descriptor_.name_);
+    return;
+  }
+  RecordNonNegativeBatch(*storage_, values, attributes, "[DoubleHistogram::RecordBatch(V,A)]",
+                         instrument_descriptor_.name_);
+}
 #endif
 
 #ifdef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
@@ -2,8 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <cassert>
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -97,6 +99,16 @@ void ViewRegistry::AddView(
     }
   }
 
+  const std::string *instrument_name = instrument_selector->GetNameFilter()->GetExactMatch();
+  if (instrument_name != nullptr)
+  {
+    views_by_instrument_name_[*instrument_name].push_back(registered_views_.size());
+  }
+  else
+  {
+    wildcard_views_.push_back(registered_views_.size());
+  }
+
   auto registered_view = std::unique_ptr<RegisteredView>(new RegisteredView{
       std::move(instrument_selector), std::move(meter_selector), std::move(view)});
   registered_views_.push_back(std::move(registered_view));
@@ -107,9 +119,29 @@ bool ViewRegistry::FindViews(
     const opentelemetry::sdk::instrumentationscope::InstrumentationScope &instrumentation_scope,
     nostd::function_ref<bool(const View &)> callback) const
 {
-  bool found = false;
-  for (auto const &registered_view : registered_views_)
+  static const std::vector<size_t> kNoViews;
+  auto by_name = views_by_instrument_name_.find(instrument_descriptor.name_);
+  const std::vector<size_t> &named_views =
+      by_name == views_by_instrument_name_.end() ? kNoViews : by_name->second;
+
+  // Merge the views selecting the instrument by name and the wildcard views, so that the views
+  // are still matched in registration order.
+  bool found   = false;
+  size_t named = 0;
+  size_t wild  = 0;
+  while (named < named_views.size() || wild < wildcard_views_.size())
   {
+    size_t index;
+    if (wild == wildcard_views_.size() ||
+        (named < named_views.size() && named_views[named] < wildcard_views_[wild]))
+    {
+      index = named_views[named++];
+    }
+    else
+    {
+      index = wildcard_views_[wild++];
+    }
+    auto const &registered_view = registered_views_[index];
     if (MatchMeter(registered_view->meter_selector_.get(), instrumentation_scope) &&
         MatchInstrument(registered_view->instrument_selector_.get(), instrument_descriptor))
     {
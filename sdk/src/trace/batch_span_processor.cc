@@ -1,11 +1,13 @@
 // Copyright The OpenTelemetry Authors
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -25,6 +27,8 @@
 #include "opentelemetry/sdk/trace/recordable.h"
 #include "opentelemetry/version.h"
 
+#include "src/trace/recordable_pool.h"
+
 #ifdef ENABLE_THREAD_INSTRUMENTATION_PREVIEW
 #  include "opentelemetry/sdk/common/thread_instrumentation.h"
 #endif /* ENABLE_THREAD_INSTRUMENTATION_PREVIEW */
@@ -45,12 +49,20 @@ BatchSpanProcessor::BatchSpanProcessor(std::unique_ptr<SpanExporter> &&exporter,
       max_queue_size_(options.max_queue_size),
       schedule_delay_millis_(options.schedule_delay_millis),
       max_export_batch_size_(options.max_export_batch_size),
+      max_export_batches_in_flight_((std::max)(options.max_export_batches_in_flight, size_t{1})),
       buffer_(max_queue_size_),
+      recordable_pool_(options.recordable_pool_size > 0
+                           ? std::make_shared<RecordablePool>(options.recordable_pool_size)
+                           : nullptr),
       synchronization_data_(std::make_shared<SynchronizationData>()),
       worker_thread_instrumentation_(nullptr),
-      worker_thread_()
+      worker_thread_(),
+      export_pipeline_(max_export_batches_in_flight_ > 1 ? new ExportPipelineData() : nullptr),
+      export_thread_instrumentation_(nullptr),
+      export_threads_()
 {
   // Make sure the constructor is complete before giving 'this' to a thread.
+  StartExportThreads();
   worker_thread_ = std::thread(&BatchSpanProcessor::DoBackgroundWork, this);
 }
 
@@ -61,17 +73,51 @@ BatchSpanProcessor::BatchSpanProcessor(std::unique_ptr<SpanExporter> &&exporter,
       max_queue_size_(options.max_queue_size),
       schedule_delay_millis_(options.schedule_delay_millis),
       max_export_batch_size_(options.max_export_batch_size),
+      max_export_batches_in_flight_((std::max)(options.max_export_batches_in_flight, size_t{1})),
       buffer_(max_queue_size_),
+      recordable_pool_(options.recordable_pool_size > 0
+                           ? std::make_shared<RecordablePool>(options.recordable_pool_size)
+                           : nullptr),
       synchronization_data_(std::make_shared<SynchronizationData>()),
       worker_thread_instrumentation_(runtime_options.thread_instrumentation),
-      worker_thread_()
+      worker_thread_(),
+      export_pipeline_(max_export_batches_in_flight_ > 1 ? new ExportPipelineData() : nullptr),
+      export_thread_instrumentation_(runtime_options.export_thread_instrumentation),
+      export_threads_()
 {
   // Make sure the constructor is complete before giving 'this' to a thread.
+  StartExportThreads();
   worker_thread_ = std::thread(&BatchSpanProcessor::DoBackgroundWork, this);
 }
 
+void BatchSpanProcessor::StartExportThreads()
+{
+  if (export_pipeline_ == nullptr)
+  {
+    return;
+  }
+
+  size_t max_concurrent_exports = exporter_ != nullptr ? exporter_->GetMaxConcurrentExports() : 1;
+  size_t num_threads =
+      (std::min)(max_export_batches_in_flight_, (std::max)(max_concurrent_exports, size_t{1}));
+  export_pipeline_->running_threads = num_threads;
+  export_threads_.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; ++i)
+  {
+    export_threads_.emplace_back(&BatchSpanProcessor::DoExportWork, this);
+  }
+}
+
 std::unique_ptr<Recordable> BatchSpanProcessor::MakeRecordable() noexcept
 {
+  if (recordable_pool_ != nullptr)
+  {
+    std::unique_ptr<Recordable> recordable = recordable_pool_->Acquire();
+    if (recordable != nullptr)
+    {
+      return recordable;
+    }
+  }
   return exporter_->MakeRecordable();
 }
 
@@ -231,6 +277,14 @@ void BatchSpanProcessor::DoBackgroundWork()
     timeout = schedule_delay_millis_ - duration;
   }
 
+  if (export_pipeline_ != nullptr)
+  {
+    // Let the export threads finish once they exported the batches of the drained queue.
+    std::lock_guard<std::mutex> guard(export_pipeline_->m);
+    export_pipeline_->is_closed = true;
+    export_pipeline_->cv.notify_all();
+  }
+
 #ifdef ENABLE_THREAD_INSTRUMENTATION_PREVIEW
   if (worker_thread_instrumentation_ != nullptr)
   {
@@ -250,7 +304,8 @@ void BatchSpanProcessor::Export()
 
   do
   {
-    std::vector<std::unique_ptr<Recordable>> spans_arr;
+    std::vector<std::unique_ptr<Recordable>> &spans_arr = export_batch_;
+    spans_arr.clear();
     size_t num_records_to_export{};
     std::uint64_t notify_force_flush =
         synchronization_data_->force_flush_pending_sequence.load(std::memory_order_acquire);
@@ -266,7 +321,11 @@ void BatchSpanProcessor::Export()
 
     if (num_records_to_export == 0)
     {
-      NotifyCompletion(notify_force_flush, exporter_, synchronization_data_);
+      if (notify_force_flush > force_flush_submitted_sequence_)
+      {
+        // Notify the completion of force flush once the batches submitted before are exported.
+        SubmitBatch(spans_arr, notify_force_flush);
+      }
       break;
     }
 
@@ -283,8 +342,7 @@ void BatchSpanProcessor::Export()
                       });
                     });
 
-    exporter_->Export(nostd::span<std::unique_ptr<Recordable>>(spans_arr.data(), spans_arr.size()));
-    NotifyCompletion(notify_force_flush, exporter_, synchronization_data_);
+    SubmitBatch(spans_arr, notify_force_flush);
   } while (true);
 
 #ifdef ENABLE_THREAD_INSTRUMENTATION_PREVIEW
@@ -295,6 +353,149 @@ void BatchSpanProcessor::Export()
 #endif /* ENABLE_THREAD_INSTRUMENTATION_PREVIEW */
 }
 
+void BatchSpanProcessor::SubmitBatch(std::vector<std::unique_ptr<Recordable>> &spans,
+                                     std::uint64_t notify_force_flush)
+{
+  force_flush_submitted_sequence_ = (std::max)(force_flush_submitted_sequence_, notify_force_flush);
+  if (export_pipeline_ == nullptr)
+  {
+    ExportBatch(spans, notify_force_flush);
+    return;
+  }
+
+  std::unique_lock<std::mutex> lk(export_pipeline_->m);
+  // The ended spans keep on being queued in buffer_ while waiting for a batch to be exported.
+  export_pipeline_->cv.wait(
+      lk, [this] { return export_pipeline_->in_flight < max_export_batches_in_flight_; });
+  std::uint64_t id = export_pipeline_->next_batch_id++;
+  export_pipeline_->batches.push_back(ExportBatchData{std::move(spans), notify_force_flush, id});
+  export_pipeline_->completions.push_back(ExportCompletionData{notify_force_flush, false});
+  ++export_pipeline_->in_flight;
+  if (export_pipeline_->free_batches.empty())
+  {
+    spans = std::vector<std::unique_ptr<Recordable>>();
+  }
+  else
+  {
+    spans = std::move(export_pipeline_->free_batches.back());
+    export_pipeline_->free_batches.pop_back();
+  }
+  export_pipeline_->cv.notify_all();
+}
+
+void BatchSpanProcessor::ExportBatch(std::vector<std::unique_ptr<Recordable>> &spans,
+                                     std::uint64_t notify_force_flush)
+{
+  if (!spans.empty())
+  {
+    exporter_->Export(nostd::span<std::unique_ptr<Recordable>>(spans.data(), spans.size()));
+    if (recordable_pool_ != nullptr)
+    {
+      recordable_pool_->Release(
+          nostd::span<std::unique_ptr<Recordable>>(spans.data(), spans.size()));
+    }
+    spans.clear();
+  }
+  NotifyCompletion(notify_force_flush, exporter_, synchronization_data_);
+}
+
+void BatchSpanProcessor::DoExportWork()
+{
+#ifdef ENABLE_THREAD_INSTRUMENTATION_PREVIEW
+  if (export_thread_instrumentation_ != nullptr)
+  {
+    export_thread_instrumentation_->OnStart();
+  }
+#endif /* ENABLE_THREAD_INSTRUMENTATION_PREVIEW */
+
+  while (true)
+  {
+#ifdef ENABLE_THREAD_INSTRUMENTATION_PREVIEW
+    if (export_thread_instrumentation_ != nullptr)
+    {
+      export_thread_instrumentation_->BeforeWait();
+    }
+#endif /* ENABLE_THREAD_INSTRUMENTATION_PREVIEW */
+
+    ExportBatchData batch;
+    bool is_closed = false;
+    {
+      std::unique_lock<std::mutex> lk(export_pipeline_->m);
+      export_pipeline_->cv.wait(
+          lk, [this] { return !export_pipeline_->batches.empty() || export_pipeline_->is_closed; });
+      is_closed = export_pipeline_->batches.empty();
+      if (!is_closed)
+      {
+        batch = std::move(export_pipeline_->batches.front());
+        export_pipeline_->batches.pop_front();
+      }
+    }
+
+#ifdef ENABLE_THREAD_INSTRUMENTATION_PREVIEW
+    if (export_thread_instrumentation_ != nullptr)
+    {
+      export_thread_instrumentation_->AfterWait();
+    }
+#endif /* ENABLE_THREAD_INSTRUMENTATION_PREVIEW */
+
+    if (is_closed)
+    {
+      break;
+    }
+
+#ifdef ENABLE_THREAD_INSTRUMENTATION_PREVIEW
+    if (export_thread_instrumentation_ != nullptr)
+    {
+      export_thread_instrumentation_->BeforeLoad();
+    }
+#endif /* ENABLE_THREAD_INSTRUMENTATION_PREVIEW */
+
+    // Export without the lock, so that the worker thread fills the next batches and the other
+    // export threads export them meanwhile.
+    ExportBatch(batch.spans, 0);
+
+    std::uint64_t notify_force_flush = 0;
+    {
+      std::lock_guard<std::mutex> guard(export_pipeline_->m);
+      --export_pipeline_->in_flight;
+      export_pipeline_->free_batches.push_back(std::move(batch.spans));
+
+      // Force flush is notified once every batch taken from the queue before it is exported.
+      std::deque<ExportCompletionData> &completions = export_pipeline_->completions;
+      completions[static_cast<size_t>(batch.id - export_pipeline_->first_completion_id)]
+          .is_exported = true;
+      while (!completions.empty() && completions.front().is_exported)
+      {
+        notify_force_flush = (std::max)(notify_force_flush, completions.front().notify_force_flush);
+        completions.pop_front();
+        ++export_pipeline_->first_completion_id;
+      }
+      export_pipeline_->cv.notify_all();
+    }
+    NotifyCompletion(notify_force_flush, exporter_, synchronization_data_);
+
+#ifdef ENABLE_THREAD_INSTRUMENTATION_PREVIEW
+    if (export_thread_instrumentation_ != nullptr)
+    {
+      export_thread_instrumentation_->AfterLoad();
+    }
+#endif /* ENABLE_THREAD_INSTRUMENTATION_PREVIEW */
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(export_pipeline_->m);
+    --export_pipeline_->running_threads;
+    export_pipeline_->cv.notify_all();
+  }
+
+#ifdef ENABLE_THREAD_INSTRUMENTATION_PREVIEW
+  if (export_thread_instrumentation_ != nullptr)
+  {
+    export_thread_instrumentation_->OnEnd();
+  }
+#endif /* ENABLE_THREAD_INSTRUMENTATION_PREVIEW */
+}
+
 void BatchSpanProcessor::NotifyCompletion(
     std::uint64_t notify_force_flush,
     const std::unique_ptr<SpanExporter> &exporter,
@@ -335,7 +536,7 @@ void BatchSpanProcessor::DrainQueue()
   {
     if (buffer_.empty() &&
         synchronization_data_->force_flush_pending_sequence.load(std::memory_order_acquire) <=
-            synchronization_data_->force_flush_notified_sequence.load(std::memory_order_acquire))
+            force_flush_submitted_sequence_)
     {
       break;
     }
@@ -393,6 +594,46 @@ bool BatchSpanProcessor::InternalShutdown(std::chrono::microseconds timeout) noe
     }
     worker_thread_.join();
   }
+  if (!export_threads_.empty())
+  {
+    std::unique_lock<std::mutex> lk(export_pipeline_->m);
+    auto is_exported = [this] { return export_pipeline_->running_threads == 0; };
+    std::chrono::microseconds wait_timeout =
+        opentelemetry::common::DurationUtil::AdjustWaitForTimeout(
+            timeout, std::chrono::microseconds::zero());
+    if (wait_timeout <= std::chrono::microseconds::zero())
+    {
+      export_pipeline_->cv.wait(lk, is_exported);
+    }
+    else
+    {
+      wait_timeout -= std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::system_clock::now() - start_time);
+      if (!export_pipeline_->cv.wait_for(lk, (std::max)(wait_timeout, std::chrono::microseconds{0}),
+                                         is_exported))
+      {
+        // Drop the batches not exported yet, only the exports already running are waited for.
+        size_t num_dropped_spans = 0;
+        for (const ExportBatchData &batch : export_pipeline_->batches)
+        {
+          num_dropped_spans += batch.spans.size();
+        }
+        export_pipeline_->in_flight -= export_pipeline_->batches.size();
+        export_pipeline_->batches.clear();
+        OTEL_INTERNAL_LOG_WARN("[BatchSpanProcessor] Shutdown timed out, dropping "
+                               << num_dropped_spans << " span(s) not exported yet.");
+      }
+    }
+    lk.unlock();
+
+    for (std::thread &export_thread : export_threads_)
+    {
+      if (export_thread.joinable())
+      {
+        export_thread.join();
+      }
+    }
+  }
 
   GetWaitAdjustedTime(timeout, start_time);
   // Should only shutdown exporter ONCE.
@@ -0,0 +1,132 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "opentelemetry/nostd/span.h"
+#include "opentelemetry/sdk/trace/recordable.h"
+#include "opentelemetry/sdk/trace/span_data.h"
+#include "opentelemetry/version.h"
+
+#include "src/trace/recordable_pool.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+
+namespace
+{
+
+// The number of recordables moved at once from the shared free list to the free list of a thread.
+constexpr std::size_t kThreadBatchSize = 32;
+
+struct ThreadFreeList
+{
+  // The pool the recordables were taken from. owner_ref tells apart a pool destroyed, then another
+  // one created at the same address.
+  const RecordablePool *owner = nullptr;
+  std::weak_ptr<const RecordablePool> owner_ref;
+  std::vector<std::unique_ptr<Recordable>> recordables;
+};
+
+ThreadFreeList &GetThreadFreeList() noexcept
+{
+  static thread_local ThreadFreeList free_list;
+  return free_list;
+}
+
+SpanData *AsSpanData(const std::unique_ptr<Recordable> &recordable) noexcept
+{
+  return recordable ? static_cast<SpanData *>(*recordable) : nullptr;
+}
+
+}  // namespace
+
+RecordablePool::RecordablePool(std::size_t capacity) : capacity_(capacity)
+{
+  recordables_.reserve(capacity_);
+}
+
+std::unique_ptr<Recordable> RecordablePool::Acquire() noexcept
+{
+  ThreadFreeList &free_list = GetThreadFreeList();
+  if (free_list.owner != this || free_list.owner_ref.expired())
+  {
+    if (!free_list.owner_ref.expired())
+    {
+      // The thread makes recordables for several processors: only the first one uses the free
+      // list of the thread.
+      return AcquireShared();
+    }
+    free_list.recordables.clear();
+    free_list.recordables.reserve(kThreadBatchSize);
+    free_list.owner     = this;
+    free_list.owner_ref = shared_from_this();
+  }
+
+  if (free_list.recordables.empty())
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    std::size_t count = (std::min)(recordables_.size(), kThreadBatchSize);
+    std::move(recordables_.end() - count, recordables_.end(),
+              std::back_inserter(free_list.recordables));
+    recordables_.resize(recordables_.size() - count);
+  }
+  if (free_list.recordables.empty())
+  {
+    return nullptr;
+  }
+  std::unique_ptr<Recordable> recordable = std::move(free_list.recordables.back());
+  free_list.recordables.pop_back();
+  return recordable;
+}
+
+std::unique_ptr<Recordable> RecordablePool::AcquireShared() noexcept
+{
+  std::lock_guard<std::mutex> guard(lock_);
+  if (recordables_.empty())
+  {
+    return nullptr;
+  }
+  std::unique_ptr<Recordable> recordable = std::move(recordables_.back());
+  recordables_.pop_back();
+  return recordable;
+}
+
+void RecordablePool::Release(nostd::span<std::unique_ptr<Recordable>> recordables) noexcept
+{
+  // Reset the recordables before locking, to not delay the threads making recordables.
+  for (auto &recordable : recordables)
+  {
+    SpanData *span_data = AsSpanData(recordable);
+    if (span_data != nullptr)
+    {
+      span_data->Reset();
+    }
+  }
+
+  std::lock_guard<std::mutex> guard(lock_);
+  for (auto &recordable : recordables)
+  {
+    if (recordables_.size() >= capacity_)
+    {
+      break;
+    }
+    if (AsSpanData(recordable) != nullptr)
+    {
+      recordables_.push_back(std::move(recordable));
+    }
+  }
+}
+
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
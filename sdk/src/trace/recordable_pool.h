@@ -0,0 +1,58 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "opentelemetry/nostd/span.h"
+#include "opentelemetry/sdk/trace/recordable.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+
+/**
+ * Recycles the exported SpanData recordables of a span processor.
+ *
+ * The exported recordables are reset and kept in a shared free list, up to the pool capacity.
+ * Each thread making recordables moves them from the shared free list into a free list of its own
+ * by small batches, so that the shared free list is only locked once per batch.
+ */
+class RecordablePool : public std::enable_shared_from_this<RecordablePool>
+{
+public:
+  /**
+   * @param capacity The maximum number of recordables kept by the shared free list.
+   */
+  explicit RecordablePool(std::size_t capacity);
+
+  /**
+   * Take a recycled recordable.
+   * @return a reset recordable, or nullptr if none is available.
+   */
+  std::unique_ptr<Recordable> Acquire() noexcept;
+
+  /**
+   * Recycle the exported SpanData recordables. The recordables which are recycled are moved out
+   * of recordables, the others are left untouched.
+   */
+  void Release(nostd::span<std::unique_ptr<Recordable>> recordables) noexcept;
+
+private:
+  std::unique_ptr<Recordable> AcquireShared() noexcept;
+
+  const std::size_t capacity_;
+  std::mutex lock_;
+  std::vector<std::unique_ptr<Recordable>> recordables_;
+};
+
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -1,8 +1,11 @@
 // Copyright The OpenTelemetry Authors
 // SPDX-License-Identifier: Apache-2.0
 
+#include <cassert>
 #include <chrono>
 #include <map>
+#include <mutex>
+#include <thread>
 #include <utility>
 
 #include "opentelemetry/nostd/function_ref.h"
@@ -60,7 +63,13 @@ Span::Span(std::shared_ptr<Tracer> &&tracer,
            const opentelemetry::trace::SpanContext &parent_span_context,
            opentelemetry::trace::SpanContext span_context) noexcept
     : tracer_{std::move(tracer)},
-      recordable_{tracer_->GetProcessor().MakeRecordable()},
+      // Bypasses the MultiSpanProcessor, and its MultiRecordable, when it has a single processor.
+      processor_{tracer_->GetRecordingProcessor()},
+      thread_confined_{tracer_->IsSpanThreadConfined()},
+#ifndef NDEBUG
+      owner_thread_{std::this_thread::get_id()},
+#endif
+      recordable_{processor_.MakeRecordable()},
       start_steady_time{options.start_steady_time},
       span_context_(std::move(span_context))
 {
@@ -100,21 +109,36 @@ Span::Span(std::shared_ptr<Tracer> &&tracer,
   recordable_->SetStartTime(NowOr(options.start_system_time));
   start_steady_time = NowOr(options.start_steady_time);
   recordable_->SetResource(tracer_->GetResource());
-  tracer_->GetProcessor().OnStart(*recordable_, parent_span_context);
+  processor_.OnStart(*recordable_, parent_span_context);
 }
 
 Span::~Span()
 {
+#ifndef NDEBUG
+  // The last reference to a thread-confined span may be released by any thread.
+  owner_thread_ = std::this_thread::get_id();
+#endif
   End();
 }
 
+std::unique_lock<std::mutex> Span::Lock() const noexcept
+{
+  if (thread_confined_)
+  {
+    assert(owner_thread_ == std::this_thread::get_id() &&
+           "thread-confined span used by another thread");
+    return std::unique_lock<std::mutex>{mu_, std::defer_lock};
+  }
+  return std::unique_lock<std::mutex>{mu_};
+}
+
 void Span::SetAttribute(nostd::string_view key, const common::AttributeValue &value) noexcept
 {
   if (key.empty())
   {
     return;
   }
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::unique_lock<std::mutex> lock = Lock();
   if (recordable_ == nullptr)
   {
     return;
@@ -125,7 +149,7 @@ void Span::SetAttribute(nostd::string_view key, const common::AttributeValue &va
 
 void Span::AddEvent(nostd::string_view name) noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::unique_lock<std::mutex> lock = Lock();
   if (recordable_ == nullptr)
   {
     return;
@@ -135,7 +159,7 @@ void Span::AddEvent(nostd::string_view name) noexcept
 
 void Span::AddEvent(nostd::string_view name, SystemTimestamp timestamp) noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::unique_lock<std::mutex> lock = Lock();
   if (recordable_ == nullptr)
   {
     return;
@@ -145,7 +169,7 @@ void Span::AddEvent(nostd::string_view name, SystemTimestamp timestamp) noexcept
 
 void Span::AddEvent(nostd::string_view name, const common::KeyValueIterable &attributes) noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::unique_lock<std::mutex> lock = Lock();
   if (recordable_ == nullptr)
   {
     return;
@@ -157,7 +181,7 @@ void Span::AddEvent(nostd::string_view name,
                     SystemTimestamp timestamp,
                     const common::KeyValueIterable &attributes) noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::unique_lock<std::mutex> lock = Lock();
   if (recordable_ == nullptr)
   {
     return;
@@ -169,7 +193,7 @@ void Span::AddEvent(nostd::string_view name,
 void Span::AddLink(const opentelemetry::trace::SpanContext &target,
                    const opentelemetry::common::KeyValueIterable &attrs) noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::unique_lock<std::mutex> lock = Lock();
   if (recordable_ == nullptr)
   {
     return;
@@ -180,7 +204,7 @@ void Span::AddLink(const opentelemetry::trace::SpanContext &target,
 
 void Span::AddLinks(const opentelemetry::trace::SpanContextKeyValueIterable &links) noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::unique_lock<std::mutex> lock = Lock();
   if (recordable_ == nullptr)
   {
     return;
@@ -196,7 +220,7 @@ void Span::AddLinks(const opentelemetry::trace::SpanContextKeyValueIterable &lin
 
 void Span::SetStatus(opentelemetry::trace::StatusCode code, nostd::string_view description) noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::unique_lock<std::mutex> lock = Lock();
   if (recordable_ == nullptr)
   {
     return;
@@ -206,7 +230,7 @@ void Span::SetStatus(opentelemetry::trace::StatusCode code, nostd::string_view d
 
 void Span::UpdateName(nostd::string_view name) noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::unique_lock<std::mutex> lock = Lock();
   if (recordable_ == nullptr)
   {
     return;
@@ -216,7 +240,7 @@ void Span::UpdateName(nostd::string_view name) noexcept
 
 void Span::End(const opentelemetry::trace::EndSpanOptions &options) noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::unique_lock<std::mutex> lock = Lock();
 
   if (has_ended_ == true)
   {
@@ -233,13 +257,13 @@ void Span::End(const opentelemetry::trace::EndSpanOptions &options) noexcept
   recordable_->SetDuration(std::chrono::steady_clock::time_point(end_steady_time) -
                            std::chrono::steady_clock::time_point(start_steady_time));
 
-  tracer_->GetProcessor().OnEnd(std::move(recordable_));
+  processor_.OnEnd(std::move(recordable_));
   recordable_.reset();
 }
 
 bool Span::IsRecording() const noexcept
 {
-  std::lock_guard<std::mutex> lock_guard{mu_};
+  std::unique_lock<std::mutex> lock = Lock();
   return recordable_ != nullptr;
 }
 }  // namespace trace
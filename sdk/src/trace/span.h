@@ -5,11 +5,13 @@
 
 #include <memory>
 #include <mutex>
+#include <thread>
 
 #include "opentelemetry/common/attribute_value.h"
 #include "opentelemetry/common/key_value_iterable.h"
 #include "opentelemetry/common/timestamp.h"
 #include "opentelemetry/nostd/string_view.h"
+#include "opentelemetry/sdk/trace/processor.h"
 #include "opentelemetry/sdk/trace/recordable.h"
 #include "opentelemetry/sdk/trace/sampler.h"
 #include "opentelemetry/sdk/trace/tracer.h"
@@ -78,8 +80,20 @@ class Span final : public opentelemetry::trace::Span
   opentelemetry::trace::SpanContext GetContext() const noexcept override { return span_context_; }
 
 private:
+  // Lock the span, unless it is thread-confined. Debug builds then check that the calling thread is
+  // the one which started the span.
+  std::unique_lock<std::mutex> Lock() const noexcept;
+
   std::shared_ptr<Tracer> tracer_;
+  // The processor which made recordable_, and which is given it when the span ends. With a single
+  // processor in the context, this is that processor itself rather than the MultiSpanProcessor,
+  // so that the span records directly into the processor's recordable without a MultiRecordable.
+  SpanProcessor &processor_;
+  const bool thread_confined_;
   mutable std::mutex mu_;
+#ifndef NDEBUG
+  std::thread::id owner_thread_;
+#endif
   std::unique_ptr<Recordable> recordable_;
   opentelemetry::common::SteadyTimestamp start_steady_time;
   opentelemetry::trace::SpanContext span_context_;
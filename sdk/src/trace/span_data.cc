@@ -7,7 +7,6 @@
 #include <cstdint>
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -18,6 +17,7 @@
 #include "opentelemetry/nostd/string_view.h"
 #include "opentelemetry/nostd/variant.h"
 #include "opentelemetry/sdk/common/attribute_utils.h"
+#include "opentelemetry/sdk/common/flat_attribute_map.h"
 #include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
 #include "opentelemetry/sdk/resource/resource.h"
 #include "opentelemetry/sdk/trace/span_data.h"
@@ -36,7 +36,8 @@ namespace trace
 namespace
 {
 
-bool SetAttributeImpl(opentelemetry::sdk::common::AttributeMap &attribute_map,
+template <class AttributeMap>
+bool SetAttributeImpl(AttributeMap &attribute_map,
                       nostd::string_view key,
                       const opentelemetry::common::AttributeValue &value,
                       std::uint32_t attribute_count_limit,
@@ -45,7 +46,7 @@ bool SetAttributeImpl(opentelemetry::sdk::common::AttributeMap &attribute_map,
   if (attribute_map.size() >= attribute_count_limit)
   {
     // The map is at the limit. Can only update existing keys.
-    auto it = attribute_map.find(std::string(key));
+    auto it = attribute_map.find(key);
     if (it == attribute_map.end())
     {
       return false;  // The key is not in the map. Cannot add new attributes.
@@ -67,13 +68,13 @@ bool SetAttributeImpl(opentelemetry::sdk::common::AttributeMap &attribute_map,
 
 // Create the attribute map from KeyValueIterable attributes enforcing count and value-length
 // limits.
-opentelemetry::sdk::common::AttributeMap CreateAttributeMap(
+SpanDataEventAttributes CreateAttributeMap(
     const opentelemetry::common::KeyValueIterable &attributes,
     std::uint32_t attribute_count_limit,
     std::size_t attribute_value_length_limit,
     std::uint32_t &dropped_count)
 {
-  opentelemetry::sdk::common::AttributeMap map;
+  SpanDataEventAttributes map;
   map.reserve((std::min)(static_cast<std::size_t>(attribute_count_limit), attributes.size()));
   dropped_count = 0;
   // Insert attributes until the count limit of unique keys is reached.
@@ -102,10 +103,9 @@ SpanDataEvent::SpanDataEvent(std::string name,
                                       attribute_value_length_limit, dropped_attributes_count_);
 }
 
-const std::unordered_map<std::string, opentelemetry::sdk::common::OwnedAttributeValue> &
-SpanDataEvent::GetAttributes() const noexcept
+const SpanDataEventAttributes &SpanDataEvent::GetAttributes() const noexcept
 {
-  return attribute_map_.GetAttributes();
+  return attribute_map_;
 }
 
 SpanDataLink::SpanDataLink(opentelemetry::trace::SpanContext span_context,
@@ -118,10 +118,9 @@ SpanDataLink::SpanDataLink(opentelemetry::trace::SpanContext span_context,
                                       attribute_value_length_limit, dropped_attributes_count_);
 }
 
-const std::unordered_map<std::string, opentelemetry::sdk::common::OwnedAttributeValue> &
-SpanDataLink::GetAttributes() const noexcept
+const SpanDataEventAttributes &SpanDataLink::GetAttributes() const noexcept
 {
-  return attribute_map_.GetAttributes();
+  return attribute_map_;
 }
 
 const opentelemetry::sdk::resource::Resource &SpanData::GetResource() const noexcept
@@ -151,10 +150,9 @@ const opentelemetry::sdk::trace::InstrumentationScope &SpanData::GetInstrumentat
   return *instrumentation_scope_;
 }
 
-const std::unordered_map<std::string, opentelemetry::sdk::common::OwnedAttributeValue> &
-SpanData::GetAttributes() const noexcept
+const SpanDataAttributes &SpanData::GetAttributes() const noexcept
 {
-  return attribute_map_.GetAttributes();
+  return attribute_map_;
 }
 
 void SpanData::SetIdentity(const opentelemetry::trace::SpanContext &span_context,
@@ -246,6 +244,28 @@ void SpanData::SetInstrumentationScope(const InstrumentationScope &instrumentati
   instrumentation_scope_ = &instrumentation_scope;
 }
 
+void SpanData::Reset() noexcept
+{
+  span_context_   = opentelemetry::trace::SpanContext(false, false);
+  parent_span_id_ = opentelemetry::trace::SpanId();
+  start_time_     = opentelemetry::common::SystemTimestamp();
+  duration_       = std::chrono::nanoseconds(0);
+  name_.clear();
+  status_code_ = opentelemetry::trace::StatusCode::kUnset;
+  status_desc_.clear();
+  attribute_map_.clear();
+  events_.clear();
+  links_.clear();
+  flags_                    = opentelemetry::trace::TraceFlags();
+  span_kind_                = opentelemetry::trace::SpanKind::kInternal;
+  resource_                 = nullptr;
+  instrumentation_scope_    = nullptr;
+  limits_                   = SpanLimits::NoLimits();
+  dropped_attributes_count_ = 0;
+  dropped_events_count_     = 0;
+  dropped_links_count_      = 0;
+}
+
 }  // namespace trace
 }  // namespace sdk
 OPENTELEMETRY_END_NAMESPACE
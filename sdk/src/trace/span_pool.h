@@ -0,0 +1,170 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+
+/**
+ * Per-thread free lists of memory blocks of BlockSize bytes.
+ *
+ * A block deallocated by a thread is kept in the free list of that thread, whichever thread
+ * allocated it, and is reused by the next allocation made on that thread. The blocks left in a
+ * free list are released when the thread exits.
+ */
+template <std::size_t BlockSize>
+class SpanBlockFreeList
+{
+public:
+  static void *Allocate()
+  {
+    FreeList &free_list = GetFreeList();
+    if (free_list.head == nullptr)
+    {
+      return ::operator new(sizeof(Block));
+    }
+    Block *block   = free_list.head;
+    free_list.head = block->next;
+    free_list.size--;
+    return block;
+  }
+
+  /**
+   * Give a block back to the free list of this thread, or release it if the free list already
+   * holds max_free_blocks blocks.
+   */
+  static void Deallocate(void *memory, std::size_t max_free_blocks) noexcept
+  {
+    FreeList &free_list = GetFreeList();
+    if (free_list.size >= max_free_blocks || free_list.closed)
+    {
+      ::operator delete(memory);
+      return;
+    }
+    if (!free_list.cleanup_registered)
+    {
+      // Constructed on first use, so its destructor runs when this thread exits.
+      static thread_local FreeListCleanup cleanup;
+      (void)cleanup;
+      free_list.cleanup_registered = true;
+    }
+    Block *block   = static_cast<Block *>(memory);
+    block->next    = free_list.head;
+    free_list.head = block;
+    free_list.size++;
+  }
+
+private:
+  union Block
+  {
+    Block *next;
+    alignas(std::max_align_t) unsigned char storage[BlockSize];
+  };
+
+  // Trivially destructible, so it stays usable by the thread local objects destroyed after the
+  // cleanup ran: the blocks they deallocate are then released immediately.
+  struct FreeList
+  {
+    Block *head;
+    std::size_t size;
+    bool cleanup_registered;
+    bool closed;
+  };
+
+  struct FreeListCleanup
+  {
+    ~FreeListCleanup()
+    {
+      FreeList &free_list = GetFreeList();
+      while (free_list.head != nullptr)
+      {
+        Block *next = free_list.head->next;
+        ::operator delete(free_list.head);
+        free_list.head = next;
+      }
+      free_list.size   = 0;
+      free_list.closed = true;
+    }
+  };
+
+  static FreeList &GetFreeList() noexcept
+  {
+    static thread_local FreeList free_list{nullptr, 0, false, false};
+    return free_list;
+  }
+};
+
+/**
+ * An allocator taking single objects from the per-thread free lists of SpanBlockFreeList, used to
+ * allocate spans together with their shared pointer control block.
+ */
+template <class T>
+class SpanPoolAllocator
+{
+public:
+  using value_type = T;
+
+  /**
+   * @param max_free_blocks The maximum number of blocks kept by the free list of each thread.
+   */
+  explicit SpanPoolAllocator(std::size_t max_free_blocks) noexcept
+      : max_free_blocks_(max_free_blocks)
+  {}
+
+  template <class U>
+  SpanPoolAllocator(const SpanPoolAllocator<U> &other) noexcept
+      : max_free_blocks_(other.GetMaxFreeBlocks())
+  {}
+
+  T *allocate(std::size_t n)
+  {
+    static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned types are not pooled");
+    if (n != 1)
+    {
+      return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+    return static_cast<T *>(SpanBlockFreeList<sizeof(T)>::Allocate());
+  }
+
+  void deallocate(T *p, std::size_t n) noexcept
+  {
+    if (n != 1)
+    {
+      ::operator delete(p);
+      return;
+    }
+    SpanBlockFreeList<sizeof(T)>::Deallocate(p, max_free_blocks_);
+  }
+
+  std::size_t GetMaxFreeBlocks() const noexcept { return max_free_blocks_; }
+
+  // All the instances share the same free lists, so any of them can deallocate the memory
+  // allocated by another.
+  template <class U>
+  bool operator==(const SpanPoolAllocator<U> &) const noexcept
+  {
+    return true;
+  }
+
+  template <class U>
+  bool operator!=(const SpanPoolAllocator<U> &) const noexcept
+  {
+    return false;
+  }
+
+private:
+  std::size_t max_free_blocks_;
+};
+
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
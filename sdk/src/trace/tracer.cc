@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <new>
 #include <utility>
@@ -33,6 +35,7 @@
 #include "opentelemetry/version.h"
 
 #include "src/trace/span.h"
+#include "src/trace/span_pool.h"
 
 OPENTELEMETRY_BEGIN_NAMESPACE namespace sdk
 {
@@ -70,11 +73,19 @@ OPENTELEMETRY_BEGIN_NAMESPACE namespace sdk
       const opentelemetry::trace::StartSpanOptions &options,
       const opentelemetry::sdk::trace::SamplingResult &sampling_result,
       const opentelemetry::trace::SpanContext &parent_context,
-      opentelemetry::trace::SpanContext &&span_context) noexcept
+      opentelemetry::trace::SpanContext &&span_context,
+      std::size_t span_pool_size) noexcept
   {
 #if OPENTELEMETRY_HAVE_EXCEPTIONS
     try
     {
+      if (span_pool_size > 0)
+      {
+        return {std::allocate_shared<Span>(SpanPoolAllocator<Span>(span_pool_size),
+                                           std::move(tracer), name, attributes, links, options,
+                                           sampling_result, parent_context,
+                                           std::move(span_context))};
+      }
 #endif
       return {std::make_shared<Span>(std::move(tracer), name, attributes, links, options,
                                      sampling_result, parent_context, std::move(span_context))};
@@ -85,6 +96,8 @@ OPENTELEMETRY_BEGIN_NAMESPACE namespace sdk
       return {};
     }
 #else
+    // The span pool is not used, std::allocate_shared can not report an allocation failure.
+    (void)span_pool_size;
     return nostd::shared_ptr<opentelemetry::trace::Span>{
         new (std::nothrow) Span{std::move(tracer), name, attributes, links, options,
                                 sampling_result, parent_context, std::move(span_context)}};
@@ -101,6 +114,7 @@ OPENTELEMETRY_BEGIN_NAMESPACE namespace sdk
         noop_span_{std::make_shared<opentelemetry::trace::DefaultSpan>(
             opentelemetry::trace::SpanContext::GetInvalid())}
   {
+    span_thread_confined_.store(tracer_config_.IsSpanThreadConfined(), std::memory_order_relaxed);
     UpdateEnabled(tracer_config_.IsEnabled());
   }
 
@@ -212,7 +226,7 @@ OPENTELEMETRY_BEGIN_NAMESPACE namespace sdk
     }
 
     auto span = MakeSpan(shared_from_this(), name, attributes, links, options, sampling_result,
-                         parent_context, std::move(span_context));
+                         parent_context, std::move(span_context), context_->GetSpanPoolSize());
     if (!span)
     {
       return noop_span_;
@@ -247,6 +261,7 @@ OPENTELEMETRY_BEGIN_NAMESPACE namespace sdk
       std::lock_guard<std::mutex> lock(tracer_config_mutex_);
       tracer_config_ = config;
     }
+    span_thread_confined_.store(config.IsSpanThreadConfined(), std::memory_order_relaxed);
     UpdateEnabled(enabled);
   }
 
@@ -26,14 +26,25 @@ OPENTELEMETRY_EXPORT TracerConfig TracerConfig::Default()
   return kDefaultConfig;
 }
 
+OPENTELEMETRY_EXPORT TracerConfig TracerConfig::ThreadConfinedSpans()
+{
+  static const auto kThreadConfinedSpansConfig = TracerConfig(true, true);
+  return kThreadConfinedSpansConfig;
+}
+
 OPENTELEMETRY_EXPORT bool TracerConfig::IsEnabled() const noexcept
 {
   return enabled_;
 }
 
+OPENTELEMETRY_EXPORT bool TracerConfig::IsSpanThreadConfined() const noexcept
+{
+  return span_thread_confined_;
+}
+
 OPENTELEMETRY_EXPORT bool TracerConfig::operator==(const TracerConfig &other) const noexcept
 {
-  return enabled_ == other.enabled_;
+  return enabled_ == other.enabled_ && span_thread_confined_ == other.span_thread_confined_;
 }
 
 }  // namespace trace
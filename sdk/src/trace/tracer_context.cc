@@ -2,10 +2,12 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <chrono>
+#include <cstddef>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "opentelemetry/common/macros.h"
 #include "opentelemetry/sdk/common/global_log_handler.h"
 #include "opentelemetry/sdk/instrumentationscope/scope_configurator.h"
 #include "opentelemetry/sdk/resource/resource.h"
@@ -66,6 +68,24 @@ const SpanLimits &TracerContext::GetSpanLimits() const noexcept
   return span_limits_;
 }
 
+std::size_t TracerContext::GetSpanPoolSize() const noexcept
+{
+  return span_pool_size_;
+}
+
+void TracerContext::SetSpanPoolSize(std::size_t span_pool_size) noexcept
+{
+#if !OPENTELEMETRY_HAVE_EXCEPTIONS
+  if (span_pool_size > 0)
+  {
+    OTEL_INTERNAL_LOG_WARN(
+        "[TracerContext::SetSpanPoolSize] The span pool is not available without exceptions, the "
+        "span pool size is ignored.");
+  }
+#endif
+  span_pool_size_ = span_pool_size;
+}
+
 void TracerContext::AddProcessor(std::unique_ptr<SpanProcessor> processor) noexcept
 {
   auto multi_processor = static_cast<MultiSpanProcessor *>(processor_.get());
@@ -90,6 +110,12 @@ SpanProcessor &TracerContext::GetProcessor() const noexcept
   return *processor_;
 }
 
+SpanProcessor &TracerContext::GetRecordingProcessor() const noexcept
+{
+  auto multi_processor = static_cast<MultiSpanProcessor *>(processor_.get());
+  return multi_processor->GetRecordingProcessor();
+}
+
 bool TracerContext::ForceFlush(std::chrono::microseconds timeout) noexcept
 {
   return processor_->ForceFlush(timeout);
@@ -0,0 +1,50 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "opentelemetry/sdk/common/aligned_array.h"
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+
+using opentelemetry::sdk::common::AlignedArray;
+
+namespace
+{
+struct alignas(64) CacheLine
+{
+  int value = 7;
+};
+
+struct Counted
+{
+  static int live;
+  Counted() noexcept { ++live; }
+  ~Counted() { --live; }
+};
+
+int Counted::live = 0;
+}  // namespace
+
+TEST(AlignedArrayTest, ElementsAreAligned)
+{
+  for (size_t size = 1; size < 8; ++size)
+  {
+    AlignedArray<CacheLine> array(size);
+    EXPECT_EQ(array.size(), size);
+    for (const auto &element : array)
+    {
+      EXPECT_EQ(reinterpret_cast<uintptr_t>(&element) % 64, 0u);
+      EXPECT_EQ(element.value, 7);
+    }
+  }
+}
+
+TEST(AlignedArrayTest, ConstructsAndDestroysElements)
+{
+  {
+    AlignedArray<Counted> array(5);
+    EXPECT_EQ(Counted::live, 5);
+  }
+  EXPECT_EQ(Counted::live, 0);
+}
@@ -18,6 +18,7 @@
 #include "opentelemetry/nostd/utility.h"
 #include "opentelemetry/nostd/variant.h"
 #include "opentelemetry/sdk/common/attribute_utils.h"
+#include "opentelemetry/sdk/common/flat_attribute_map.h"
 
 TEST(AttributeMapTest, DefaultConstruction)
 {
@@ -215,6 +216,74 @@ TEST(OrderedAttributeMapTest, SetAttributeTruncation)
   EXPECT_EQ(string_value, "abcde");
 }
 
+TEST(FlatAttributeMapTest, InsertionOrderAndAssign)
+{
+  opentelemetry::sdk::common::FlatAttributeMap<2> attribute_map;
+  EXPECT_TRUE(attribute_map.empty());
+
+  const std::string keys[] = {"attr1", "attr2", "attr3", "attr4"};
+  for (int i = 0; i < 4; i++)
+  {
+    EXPECT_TRUE(attribute_map.SetAttribute(keys[i], i));
+  }
+  EXPECT_TRUE(attribute_map.SetAttribute("attr2", 42));
+
+  // Beyond the inline capacity, the attributes are moved to the heap in the same order.
+  ASSERT_EQ(attribute_map.size(), 4);
+  EXPECT_GE(attribute_map.capacity(), 4);
+  int i = 0;
+  for (const auto &kv : attribute_map)
+  {
+    EXPECT_EQ(kv.first, keys[i]);
+    EXPECT_EQ(opentelemetry::nostd::get<int32_t>(kv.second), i == 1 ? 42 : i);
+    i++;
+  }
+  EXPECT_EQ(opentelemetry::nostd::get<int32_t>(attribute_map.at("attr4")), 3);
+  EXPECT_EQ(attribute_map.count("attr3"), 1);
+  EXPECT_EQ(attribute_map.find("attr5"), attribute_map.end());
+
+  attribute_map.clear();
+  EXPECT_TRUE(attribute_map.empty());
+  EXPECT_GE(attribute_map.capacity(), 4);
+}
+
+TEST(FlatAttributeMapTest, CopyAndMove)
+{
+  for (int count : {1, 3})
+  {
+    opentelemetry::sdk::common::FlatAttributeMap<2> attribute_map;
+    for (int i = 0; i < count; i++)
+    {
+      attribute_map.SetAttribute("attr" + std::to_string(i), "value" + std::to_string(i));
+    }
+
+    opentelemetry::sdk::common::FlatAttributeMap<2> copy(attribute_map);
+    opentelemetry::sdk::common::FlatAttributeMap<2> moved(std::move(attribute_map));
+    EXPECT_TRUE(attribute_map.empty());
+    opentelemetry::sdk::common::FlatAttributeMap<2> assigned;
+    assigned.SetAttribute("other", true);
+    assigned = std::move(moved);
+
+    for (const auto *map : {&copy, &assigned})
+    {
+      ASSERT_EQ(map->size(), count);
+      for (int i = 0; i < count; i++)
+      {
+        EXPECT_EQ(opentelemetry::nostd::get<std::string>(map->at("attr" + std::to_string(i))),
+                  "value" + std::to_string(i));
+      }
+    }
+  }
+}
+
+TEST(FlatAttributeMapTest, SetAttributeTruncation)
+{
+  opentelemetry::sdk::common::FlatAttributeMap<2> attribute_map;
+  opentelemetry::nostd::string_view value("abcdefghijk");
+  attribute_map.SetAttribute("key", value, 5);
+  EXPECT_EQ(opentelemetry::nostd::get<std::string>(attribute_map.at("key")), "abcde");
+}
+
 // ---------------------------------------------------------------------------
 // AttributeConverter truncation
 // ---------------------------------------------------------------------------
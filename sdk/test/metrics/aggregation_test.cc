@@ -3,13 +3,17 @@
 
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include "opentelemetry/nostd/span.h"
 #include "opentelemetry/nostd/string_view.h"
 #include "opentelemetry/nostd/variant.h"
 #include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
@@ -161,6 +165,77 @@ TEST(Aggregation, DoubleSumAggregation)
   EXPECT_EQ(nostd::get<double>(sum_data.value_), 13.0);
 }
 
+TEST(Aggregation, ConcurrentAggregation)
+{
+  constexpr int kThreads      = 4;
+  constexpr int kMeasurements = 10000;
+  LongSumAggregation long_sum(true);
+  DoubleSumAggregation double_sum(true);
+  DoubleLastValueAggregation last_value;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++)
+  {
+    threads.emplace_back([&, t]() {
+      for (int i = 0; i < kMeasurements; i++)
+      {
+        long_sum.Aggregate(static_cast<int64_t>(1), {});
+        double_sum.Aggregate(0.5, {});
+        last_value.Aggregate(static_cast<double>(t), {});
+      }
+    });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+  EXPECT_EQ(nostd::get<int64_t>(nostd::get<SumPointData>(long_sum.ToPoint()).value_),
+            kThreads * kMeasurements);
+  EXPECT_EQ(nostd::get<double>(nostd::get<SumPointData>(double_sum.ToPoint()).value_),
+            kThreads * kMeasurements * 0.5);
+  auto last_value_data = nostd::get<LastValuePointData>(last_value.ToPoint());
+  EXPECT_TRUE(last_value_data.is_lastvalue_valid_);
+  EXPECT_GE(nostd::get<double>(last_value_data.value_), 0.0);
+  EXPECT_LT(nostd::get<double>(last_value_data.value_), kThreads);
+}
+
+TEST(Aggregation, ConcurrentLastValueTimestamps)
+{
+  constexpr int kThreads      = 4;
+  constexpr int kMeasurements = 10000;
+  LongLastValueAggregation last_value;
+  std::atomic<bool> done{false};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++)
+  {
+    threads.emplace_back([&last_value]() {
+      for (int i = 0; i < kMeasurements; i++)
+      {
+        last_value.Aggregate(static_cast<int64_t>(i), {});
+      }
+    });
+  }
+  // The sample timestamps are published in order: a reader never sees an older value replace a
+  // newer one.
+  std::thread reader([&last_value, &done]() {
+    std::chrono::nanoseconds previous{0};
+    while (!done.load())
+    {
+      auto point = nostd::get<LastValuePointData>(last_value.ToPoint());
+      if (point.is_lastvalue_valid_)
+      {
+        EXPECT_GE(point.sample_ts_.time_since_epoch().count(), previous.count());
+        previous = point.sample_ts_.time_since_epoch();
+      }
+    }
+  });
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+  done.store(true);
+  reader.join();
+}
+
 TEST(Aggregation, LongLastValueAggregation)
 {
   LongLastValueAggregation aggr;
@@ -278,6 +353,392 @@ TEST(Aggregation, DoubleHistogramAggregationBoundaries)
   EXPECT_EQ(histogram_data.boundaries_, user_boundaries);
 }
 
+TEST(Aggregation, HistogramAggregationSharedBoundaries)
+{
+  HistogramAggregationConfig aggregation_config;
+  aggregation_config.boundaries_ = {10.0, 100.0};
+  const std::vector<double> *boundaries = &aggregation_config.boundaries_.GetBoundaries();
+
+  // The aggregations of a view and their points share the boundaries of its configuration.
+  LongHistogramAggregation aggr1{&aggregation_config};
+  LongHistogramAggregation aggr2{&aggregation_config};
+  aggr1.Aggregate(static_cast<int64_t>(12), {});
+  aggr2.Aggregate(static_cast<int64_t>(120), {});
+  auto point1 = nostd::get<HistogramPointData>(aggr1.ToPoint());
+  EXPECT_EQ(&point1.boundaries_.GetBoundaries(), boundaries);
+  auto merged = aggr1.Merge(aggr2);
+  auto point2 = nostd::get<HistogramPointData>(merged->ToPoint());
+  EXPECT_EQ(&point2.boundaries_.GetBoundaries(), boundaries);
+  EXPECT_EQ(point2.counts_, std::vector<uint64_t>({0, 1, 1}));
+
+  DoubleHistogramAggregation aggr3{&aggregation_config};
+  auto point3 = nostd::get<HistogramPointData>(aggr3.ToPoint());
+  EXPECT_EQ(&point3.boundaries_.GetBoundaries(), boundaries);
+
+  // Without a configuration, the default boundaries are shared.
+  DoubleHistogramAggregation aggr4;
+  auto point4 = nostd::get<HistogramPointData>(aggr4.ToPoint());
+  EXPECT_EQ(&point4.boundaries_.GetBoundaries(),
+            &HistogramAggregationConfig::DefaultBoundaries().GetBoundaries());
+}
+
+TEST(Aggregation, ResetAggregation)
+{
+  LongSumAggregation long_sum(true);
+  long_sum.Aggregate(static_cast<int64_t>(12), {});
+  EXPECT_TRUE(long_sum.Reset());
+  EXPECT_EQ(nostd::get<int64_t>(nostd::get<SumPointData>(long_sum.ToPoint()).value_), 0);
+
+  DoubleSumAggregation double_sum(false);
+  double_sum.Aggregate(-12.0, {});
+  EXPECT_TRUE(double_sum.Reset());
+  auto sum_data = nostd::get<SumPointData>(double_sum.ToPoint());
+  EXPECT_EQ(nostd::get<double>(sum_data.value_), 0.0);
+  EXPECT_FALSE(sum_data.is_monotonic_);
+
+  DoubleLastValueAggregation last_value;
+  last_value.Aggregate(12.0, {});
+  EXPECT_TRUE(last_value.Reset());
+  EXPECT_FALSE(nostd::get<LastValuePointData>(last_value.ToPoint()).is_lastvalue_valid_);
+
+  HistogramAggregationConfig aggregation_config;
+  aggregation_config.boundaries_ = {10.0, 100.0};
+  LongHistogramAggregation histogram{&aggregation_config};
+  histogram.Aggregate(static_cast<int64_t>(12), {});
+  histogram.Aggregate(static_cast<int64_t>(120), {});
+  EXPECT_TRUE(histogram.Reset());
+  auto histogram_data = nostd::get<HistogramPointData>(histogram.ToPoint());
+  EXPECT_EQ(histogram_data.boundaries_, aggregation_config.boundaries_);
+  EXPECT_EQ(histogram_data.counts_, std::vector<uint64_t>(3, 0));
+  EXPECT_EQ(histogram_data.count_, 0);
+  EXPECT_EQ(nostd::get<int64_t>(histogram_data.sum_), 0);
+  histogram.Aggregate(static_cast<int64_t>(5), {});
+  histogram_data = nostd::get<HistogramPointData>(histogram.ToPoint());
+  EXPECT_EQ(nostd::get<int64_t>(histogram_data.min_), 5);
+  EXPECT_EQ(nostd::get<int64_t>(histogram_data.max_), 5);
+  EXPECT_EQ(histogram_data.counts_[0], 1);
+}
+
+TEST(Aggregation, HistogramAggregationThreadCells)
+{
+  constexpr int kThreads      = 4;
+  constexpr int kMeasurements = 1000;
+  HistogramAggregationConfig aggregation_config;
+  aggregation_config.boundaries_ = {10.0, 100.0};
+  // Fewer cells than threads, so that some of the threads share a cell.
+  aggregation_config.thread_cell_count_ = 3;
+  LongHistogramAggregation long_histogram{&aggregation_config};
+  DoubleHistogramAggregation double_histogram{&aggregation_config};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++)
+  {
+    threads.emplace_back([&, t]() {
+      for (int i = 0; i < kMeasurements; i++)
+      {
+        long_histogram.Aggregate(static_cast<int64_t>(t * 50), {});
+        double_histogram.Aggregate(t * 50.0, {});
+      }
+    });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  // 0 lies in the first bucket, 50 and 100 in the second one, and 150 in the third one.
+  const std::vector<uint64_t> expected_counts = {kMeasurements, 2 * kMeasurements, kMeasurements};
+  auto long_data = nostd::get<HistogramPointData>(long_histogram.ToPoint());
+  EXPECT_EQ(long_data.count_, kThreads * kMeasurements);
+  EXPECT_EQ(long_data.counts_, expected_counts);
+  EXPECT_EQ(nostd::get<int64_t>(long_data.sum_), 300 * kMeasurements);
+  EXPECT_EQ(nostd::get<int64_t>(long_data.min_), 0);
+  EXPECT_EQ(nostd::get<int64_t>(long_data.max_), 150);
+  auto double_data = nostd::get<HistogramPointData>(double_histogram.ToPoint());
+  EXPECT_EQ(double_data.count_, kThreads * kMeasurements);
+  EXPECT_EQ(double_data.counts_, expected_counts);
+  EXPECT_EQ(nostd::get<double>(double_data.sum_), 300.0 * kMeasurements);
+  EXPECT_EQ(nostd::get<double>(double_data.min_), 0.0);
+  EXPECT_EQ(nostd::get<double>(double_data.max_), 150.0);
+
+  // The cells are merged before the aggregations are combined.
+  auto merged      = long_histogram.Merge(long_histogram);
+  auto merged_data = nostd::get<HistogramPointData>(merged->ToPoint());
+  EXPECT_EQ(merged_data.count_, 2 * kThreads * kMeasurements);
+  EXPECT_EQ(merged_data.counts_[1], 4 * kMeasurements);
+
+  EXPECT_TRUE(long_histogram.Reset());
+  long_data = nostd::get<HistogramPointData>(long_histogram.ToPoint());
+  EXPECT_EQ(long_data.count_, 0);
+  EXPECT_EQ(long_data.counts_, std::vector<uint64_t>(3, 0));
+  EXPECT_EQ(nostd::get<int64_t>(long_data.sum_), 0);
+  long_histogram.Aggregate(static_cast<int64_t>(120), {});
+  long_data = nostd::get<HistogramPointData>(long_histogram.ToPoint());
+  EXPECT_EQ(long_data.count_, 1);
+  EXPECT_EQ(long_data.counts_[2], 1);
+  EXPECT_EQ(nostd::get<int64_t>(long_data.min_), 120);
+  EXPECT_EQ(nostd::get<int64_t>(long_data.max_), 120);
+}
+
+// Aggregating a batch of values must give the same point as aggregating the values one by one.
+TEST(Aggregation, HistogramAggregationCompactCounts)
+{
+  HistogramAggregationConfig aggregation_config;
+  aggregation_config.boundaries_ = {10.0, 100.0};
+  HistogramAggregationConfig compact_config;
+  compact_config.boundaries_     = aggregation_config.boundaries_;
+  compact_config.compact_counts_ = true;
+
+  // Enough measurements in the second bucket to widen the compact counts past 8 and 16 bits.
+  LongHistogramAggregation long_histogram{&aggregation_config};
+  LongHistogramAggregation long_compact{&compact_config};
+  DoubleHistogramAggregation double_compact{&compact_config};
+  for (int64_t value : {5, 50, 500})
+  {
+    long_histogram.Aggregate(value, {});
+    long_compact.Aggregate(value, {});
+    double_compact.Aggregate(static_cast<double>(value), {});
+  }
+  const std::vector<int64_t> long_values(70000, 50);
+  const std::vector<double> double_values(70000, 50.0);
+  const nostd::span<const int64_t> long_span = {long_values.data(), long_values.size()};
+  const nostd::span<const double> double_span = {double_values.data(), double_values.size()};
+  long_histogram.AggregateBatch(long_span);
+  long_compact.AggregateBatch(long_span);
+  double_compact.AggregateBatch(double_span);
+
+  const std::vector<uint64_t> expected_counts = {1, 70001, 1};
+  auto long_data = nostd::get<HistogramPointData>(long_compact.ToPoint());
+  EXPECT_EQ(long_data.counts_, expected_counts);
+  EXPECT_EQ(long_data.count_, 70003);
+  EXPECT_EQ(nostd::get<int64_t>(long_data.sum_), 555 + 50 * 70000);
+  EXPECT_EQ(nostd::get<int64_t>(long_data.min_), 5);
+  EXPECT_EQ(nostd::get<int64_t>(long_data.max_), 500);
+  auto double_data = nostd::get<HistogramPointData>(double_compact.ToPoint());
+  EXPECT_EQ(double_data.counts_, expected_counts);
+  EXPECT_EQ(nostd::get<double>(double_data.sum_), 555.0 + 50.0 * 70000);
+
+  // Compact and 64-bit counts are merged into each other.
+  LongHistogramAggregation long_merged{&compact_config};
+  EXPECT_TRUE(long_merged.MergeFrom(long_compact));
+  EXPECT_TRUE(long_merged.MergeFrom(long_histogram));
+  auto merged_data = nostd::get<HistogramPointData>(long_merged.ToPoint());
+  EXPECT_EQ(merged_data.counts_, std::vector<uint64_t>({2, 140002, 2}));
+  EXPECT_EQ(merged_data.count_, 140006);
+  EXPECT_TRUE(long_histogram.MergeFrom(long_compact));
+  EXPECT_EQ(nostd::get<HistogramPointData>(long_histogram.ToPoint()).counts_,
+            merged_data.counts_);
+  auto diff      = long_compact.Diff(long_merged);
+  auto diff_data = nostd::get<HistogramPointData>(diff->ToPoint());
+  EXPECT_EQ(diff_data.counts_, expected_counts);
+
+  EXPECT_TRUE(long_compact.Reset());
+  long_data = nostd::get<HistogramPointData>(long_compact.ToPoint());
+  EXPECT_EQ(long_data.counts_, std::vector<uint64_t>(3, 0));
+  EXPECT_EQ(long_data.count_, 0);
+  long_compact.Aggregate(static_cast<int64_t>(120), {});
+  long_data = nostd::get<HistogramPointData>(long_compact.ToPoint());
+  EXPECT_EQ(long_data.counts_, std::vector<uint64_t>({0, 0, 1}));
+}
+
+TEST(Aggregation, AggregateBatch)
+{
+  const std::vector<int64_t> long_values     = {5, -3, 0, 120, 42, 7, 1000, 15};
+  const std::vector<double> double_values    = {5.5, -3.25, 0.0, 120.0, 42.0, 0.001, 1000.0, 15.0};
+  const nostd::span<const int64_t> long_span = {long_values.data(), long_values.size()};
+  const nostd::span<const double> double_span = {double_values.data(), double_values.size()};
+
+  // The monotonic sums drop the negative values in both cases.
+  for (bool is_monotonic : {true, false})
+  {
+    LongSumAggregation long_sum{is_monotonic}, long_sum_batch{is_monotonic};
+    DoubleSumAggregation double_sum{is_monotonic}, double_sum_batch{is_monotonic};
+    for (size_t i = 0; i < long_values.size(); i++)
+    {
+      long_sum.Aggregate(long_values[i], {});
+      double_sum.Aggregate(double_values[i], {});
+    }
+    long_sum_batch.AggregateBatch(long_span);
+    double_sum_batch.AggregateBatch(double_span);
+    EXPECT_EQ(nostd::get<int64_t>(nostd::get<SumPointData>(long_sum_batch.ToPoint()).value_),
+              nostd::get<int64_t>(nostd::get<SumPointData>(long_sum.ToPoint()).value_));
+    EXPECT_EQ(nostd::get<double>(nostd::get<SumPointData>(double_sum_batch.ToPoint()).value_),
+              nostd::get<double>(nostd::get<SumPointData>(double_sum.ToPoint()).value_));
+  }
+
+  for (size_t thread_cell_count : {size_t{0}, size_t{2}})
+  {
+    HistogramAggregationConfig config;
+    config.boundaries_        = {0.0, 10.0, 100.0};
+    config.thread_cell_count_ = thread_cell_count;
+    LongHistogramAggregation long_histogram{&config}, long_histogram_batch{&config};
+    DoubleHistogramAggregation double_histogram{&config}, double_histogram_batch{&config};
+    for (size_t i = 0; i < long_values.size(); i++)
+    {
+      long_histogram.Aggregate(long_values[i], {});
+      double_histogram.Aggregate(double_values[i], {});
+    }
+    long_histogram_batch.AggregateBatch(long_span);
+    double_histogram_batch.AggregateBatch(double_span);
+    auto expect_same_point = [](const Aggregation &expected_aggregation,
+                                const Aggregation &actual_aggregation) {
+      auto expected = nostd::get<HistogramPointData>(expected_aggregation.ToPoint());
+      auto actual   = nostd::get<HistogramPointData>(actual_aggregation.ToPoint());
+      EXPECT_EQ(actual.count_, expected.count_);
+      EXPECT_EQ(actual.counts_, expected.counts_);
+      EXPECT_TRUE(actual.sum_ == expected.sum_);
+      EXPECT_TRUE(actual.min_ == expected.min_);
+      EXPECT_TRUE(actual.max_ == expected.max_);
+    };
+    expect_same_point(long_histogram, long_histogram_batch);
+    expect_same_point(double_histogram, double_histogram_batch);
+  }
+
+  // Enough values spread over several orders of magnitude to downscale in the middle of a batch.
+  std::vector<double> exponential_values;
+  double value = 1e-4;
+  for (int i = 0; i < kSampleBCount * 2; i++)
+  {
+    exponential_values.push_back(i % 3 == 0 ? -value : (i % 7 == 0 ? 0.0 : value));
+    value *= kSampleBFactor;
+  }
+  const auto config = MakeAggregationConfig(20, 10);
+  Base2ExponentialHistogramAggregation exponential{&config}, exponential_batch{&config};
+  for (double v : exponential_values)
+  {
+    exponential.Aggregate(v, {});
+  }
+  exponential_batch.AggregateBatch(
+      nostd::span<const double>{exponential_values.data(), exponential_values.size()});
+  const auto expected = MakePointData(exponential);
+  const auto actual   = MakePointData(exponential_batch);
+  EXPECT_EQ(actual.count_, expected.count_);
+  EXPECT_EQ(actual.zero_count_, expected.zero_count_);
+  EXPECT_EQ(actual.scale_, expected.scale_);
+  EXPECT_EQ(actual.sum_, expected.sum_);
+  EXPECT_EQ(actual.min_, expected.min_);
+  EXPECT_EQ(actual.max_, expected.max_);
+  ExpectCountInvariant(exponential_values.size(), actual);
+  ExpectBucketsMatchIndexer(exponential_values, *actual.positive_buckets_, actual.scale_, 1.0);
+  ExpectBucketsMatchIndexer(exponential_values, *actual.negative_buckets_, actual.scale_, -1.0);
+}
+
+// Merging deltas in place into an accumulator gives the same point as chaining Merge() calls.
+TEST(Aggregation, MergeFrom)
+{
+  LongSumAggregation long_sum{true}, long_delta{true};
+  DoubleSumAggregation double_sum{false}, double_delta{false};
+  std::unique_ptr<Aggregation> long_merged(new LongSumAggregation(true));
+  std::unique_ptr<Aggregation> double_merged(new DoubleSumAggregation(false));
+  for (int i = 1; i <= 3; i++)
+  {
+    long_delta.Reset();
+    double_delta.Reset();
+    long_delta.Aggregate(int64_t{10} * i, {});
+    double_delta.Aggregate(-0.25 * i, {});
+    EXPECT_TRUE(long_sum.MergeFrom(long_delta));
+    EXPECT_TRUE(double_sum.MergeFrom(double_delta));
+    long_merged   = long_merged->Merge(long_delta);
+    double_merged = double_merged->Merge(double_delta);
+  }
+  EXPECT_EQ(nostd::get<int64_t>(nostd::get<SumPointData>(long_sum.ToPoint()).value_), 60);
+  EXPECT_EQ(nostd::get<int64_t>(nostd::get<SumPointData>(long_merged->ToPoint()).value_), 60);
+  EXPECT_EQ(nostd::get<double>(nostd::get<SumPointData>(double_sum.ToPoint()).value_),
+            nostd::get<double>(nostd::get<SumPointData>(double_merged->ToPoint()).value_));
+
+  // The last value with the most recent sample timestamp is kept.
+  LongLastValueAggregation last_value, older, newer;
+  older.Aggregate(int64_t{1}, {});
+  std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  newer.Aggregate(int64_t{2}, {});
+  EXPECT_TRUE(last_value.MergeFrom(newer));
+  EXPECT_TRUE(last_value.MergeFrom(older));
+  auto last_point = nostd::get<LastValuePointData>(last_value.ToPoint());
+  EXPECT_TRUE(last_point.is_lastvalue_valid_);
+  EXPECT_EQ(nostd::get<int64_t>(last_point.value_), 2);
+  EXPECT_EQ(last_point.sample_ts_, nostd::get<LastValuePointData>(newer.ToPoint()).sample_ts_);
+
+  for (size_t thread_cell_count : {size_t{0}, size_t{2}})
+  {
+    HistogramAggregationConfig config;
+    config.boundaries_        = {0.0, 10.0, 100.0};
+    config.thread_cell_count_ = thread_cell_count;
+    DoubleHistogramAggregation histogram{&config}, delta{&config};
+    std::unique_ptr<Aggregation> merged(new DoubleHistogramAggregation(&config));
+    for (double value : {5.5, -3.25, 120.0, 42.0})
+    {
+      delta.Reset();
+      delta.Aggregate(value, {});
+      delta.Aggregate(value * 2, {});
+      EXPECT_TRUE(histogram.MergeFrom(delta));
+      merged = merged->Merge(delta);
+    }
+    EXPECT_FALSE(histogram.MergeFrom(histogram));
+    auto expected = nostd::get<HistogramPointData>(merged->ToPoint());
+    auto actual   = nostd::get<HistogramPointData>(histogram.ToPoint());
+    EXPECT_EQ(actual.count_, expected.count_);
+    EXPECT_EQ(actual.counts_, expected.counts_);
+    EXPECT_TRUE(actual.sum_ == expected.sum_);
+    EXPECT_TRUE(actual.min_ == expected.min_);
+    EXPECT_TRUE(actual.max_ == expected.max_);
+  }
+
+  // The deltas span more buckets than max_size, which downscales the accumulator.
+  const auto config = MakeAggregationConfig(20, 10);
+  Base2ExponentialHistogramAggregation exponential{&config};
+  std::unique_ptr<Aggregation> exponential_merged(
+      new Base2ExponentialHistogramAggregation(&config));
+  std::vector<double> recorded;
+  double value = kSampleAStart;
+  for (int i = 0; i < kSampleACount; i++)
+  {
+    Base2ExponentialHistogramAggregation exponential_delta{&config};
+    exponential_delta.Aggregate(value, {});
+    exponential_delta.Aggregate(-value * 3, {});
+    recorded.push_back(value);
+    recorded.push_back(-value * 3);
+    EXPECT_TRUE(exponential.MergeFrom(exponential_delta));
+    exponential_merged = exponential_merged->Merge(exponential_delta);
+    value *= kSampleAFactor;
+  }
+  const auto expected = MakePointData(*exponential_merged);
+  const auto actual   = MakePointData(exponential);
+  EXPECT_EQ(actual.count_, expected.count_);
+  EXPECT_EQ(actual.zero_count_, expected.zero_count_);
+  EXPECT_EQ(actual.scale_, expected.scale_);
+  EXPECT_EQ(actual.sum_, expected.sum_);
+  EXPECT_EQ(actual.min_, expected.min_);
+  EXPECT_EQ(actual.max_, expected.max_);
+  ExpectCountInvariant(recorded.size(), actual);
+  ExpectBucketsMatchIndexer(recorded, *actual.positive_buckets_, actual.scale_, 1.0);
+  ExpectBucketsMatchIndexer(recorded, *actual.negative_buckets_, actual.scale_, -1.0);
+}
+TEST(Aggregation, LongSumAggregateBatchLimits)
+{
+  constexpr int64_t kMax = (std::numeric_limits<int64_t>::max)();
+  constexpr int64_t kMin = (std::numeric_limits<int64_t>::min)();
+
+  // The sums of values near the limits wrap around the same way in batches as one by one.
+  for (bool is_monotonic : {true, false})
+  {
+    const std::vector<int64_t> values     = {kMax, 1, kMin, kMax, -1, kMax, 2, kMin};
+    const nostd::span<const int64_t> span = {values.data(), values.size()};
+    LongSumAggregation sum{is_monotonic}, sum_batch{is_monotonic};
+    for (int64_t value : values)
+    {
+      sum.Aggregate(value, {});
+    }
+    sum_batch.AggregateBatch(span);
+    EXPECT_EQ(nostd::get<int64_t>(nostd::get<SumPointData>(sum_batch.ToPoint()).value_),
+              nostd::get<int64_t>(nostd::get<SumPointData>(sum.ToPoint()).value_));
+  }
+
+  LongSumAggregation sum{true};
+  const std::vector<int64_t> values = {kMax, kMax, 2};
+  sum.AggregateBatch(nostd::span<const int64_t>{values.data(), values.size()});
+  EXPECT_EQ(nostd::get<int64_t>(nostd::get<SumPointData>(sum.ToPoint()).value_), 0);
+}
+
+
 TEST(Aggregation, DoubleHistogramAggregation)
 {
   DoubleHistogramAggregation aggr;
@@ -14,8 +14,10 @@
 #include "opentelemetry/nostd/function_ref.h"
 #include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
 #include "opentelemetry/sdk/metrics/aggregation/drop_aggregation.h"
+#include "opentelemetry/sdk/metrics/aggregation/sum_aggregation.h"
 #include "opentelemetry/sdk/metrics/state/attributes_hashmap.h"
 #include "opentelemetry/sdk/metrics/state/filtered_ordered_attribute_map.h"
+#include "opentelemetry/sdk/metrics/state/sharded_attributes_hashmap.h"
 #include "opentelemetry/sdk/metrics/view/attributes_processor.h"
 
 using namespace opentelemetry::sdk::metrics;
@@ -59,6 +61,109 @@ void BM_AttributseHashMap(benchmark::State &state)
 }
 
 BENCHMARK(BM_AttributseHashMap);
+
+// Lookup of existing series in a hash holding as many series as the default cardinality limit.
+void BM_AttributesHashMapLookup(benchmark::State &state)
+{
+  const size_t series_count = static_cast<size_t>(state.range(0));
+  AttributesHashMap hash_map(series_count);
+  std::vector<MetricAttributes> attributes;
+  for (size_t i = 0; i < series_count; i++)
+  {
+    attributes.push_back({{"route", "/api/v1/resource"},
+                          {"status_code", static_cast<int64_t>(200 + i % 5)},
+                          {"series", static_cast<int64_t>(i)}});
+    hash_map.Set(attributes.back(), std::unique_ptr<Aggregation>(new DropAggregation));
+  }
+  size_t i = 0;
+  for (auto _ : state)
+  {
+    // Stride through the series so that consecutive lookups do not hit the same cache lines.
+    benchmark::DoNotOptimize(hash_map.Get(attributes[i]));
+    i = (i + 997) % series_count;
+  }
+}
+
+BENCHMARK(BM_AttributesHashMapLookup)->Arg(100)->Arg(2000)->Arg(10000);
+
+// Multi-threaded recording scaling, each thread recording into its own set of attributes.
+constexpr size_t kAttributesPerThread = 8;
+constexpr int kMaxScalingThreads      = 64;
+
+std::vector<MetricAttributes> ScalingAttributes(int thread_index)
+{
+  std::vector<MetricAttributes> attributes;
+  for (size_t i = 0; i < kAttributesPerThread; i++)
+  {
+    attributes.push_back(
+        {{"thread", static_cast<int64_t>(thread_index)}, {"k", static_cast<int64_t>(i)}});
+  }
+  return attributes;
+}
+
+std::unique_ptr<Aggregation> CreateSumAggregation()
+{
+  return std::unique_ptr<Aggregation>(new LongSumAggregation(true));
+}
+
+AttributesHashMap *g_hash_map = nullptr;
+std::mutex g_hash_map_lock;
+
+void BM_AttributesHashMapSingleLockScaling(benchmark::State &state)
+{
+  if (state.thread_index() == 0)
+  {
+    g_hash_map = new AttributesHashMap();
+  }
+  auto attributes = ScalingAttributes(state.thread_index());
+  size_t i        = 0;
+  for (auto _ : state)
+  {
+    std::lock_guard<std::mutex> guard(g_hash_map_lock);
+    g_hash_map->GetOrSetDefault(attributes[i++ % kAttributesPerThread], CreateSumAggregation)
+        ->Aggregate(static_cast<int64_t>(1));
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0)
+  {
+    delete g_hash_map;
+    g_hash_map = nullptr;
+  }
+}
+
+BENCHMARK(BM_AttributesHashMapSingleLockScaling)->ThreadRange(1, kMaxScalingThreads)->UseRealTime();
+
+ShardedAttributesHashMap *g_sharded_hash_map = nullptr;
+
+void BM_ShardedAttributesHashMapScaling(benchmark::State &state)
+{
+  if (state.thread_index() == 0)
+  {
+    g_sharded_hash_map = new ShardedAttributesHashMap(static_cast<size_t>(state.range(0)));
+  }
+  auto attributes = ScalingAttributes(state.thread_index());
+  auto aggregate  = [](Aggregation &aggregation) {
+    aggregation.Aggregate(static_cast<int64_t>(1));
+  };
+  size_t i        = 0;
+  for (auto _ : state)
+  {
+    g_sharded_hash_map->GetOrSetDefault(attributes[i++ % kAttributesPerThread],
+                                        CreateSumAggregation, aggregate);
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0)
+  {
+    delete g_sharded_hash_map;
+    g_sharded_hash_map = nullptr;
+  }
+}
+
+BENCHMARK(BM_ShardedAttributesHashMapScaling)
+    ->Arg(16)
+    ->Arg(64)
+    ->ThreadRange(1, kMaxScalingThreads)
+    ->UseRealTime();
 }  // namespace
 
 BENCHMARK_MAIN();
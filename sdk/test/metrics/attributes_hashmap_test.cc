@@ -5,16 +5,22 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
+#include "opentelemetry/common/key_value_iterable_view.h"
 #include "opentelemetry/nostd/function_ref.h"
 #include "opentelemetry/nostd/string_view.h"
 #include "opentelemetry/sdk/common/attributemap_hash.h"
 #include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
 #include "opentelemetry/sdk/metrics/aggregation/drop_aggregation.h"
+#include "opentelemetry/sdk/metrics/aggregation/sum_aggregation.h"
+#include "opentelemetry/sdk/metrics/data/metric_data.h"
+#include "opentelemetry/sdk/metrics/data/point_data.h"
 #include "opentelemetry/sdk/metrics/state/attributes_hashmap.h"
 #include "opentelemetry/sdk/metrics/view/attributes_processor.h"
 
@@ -228,4 +234,261 @@ TEST(AttributesHashMap, OverflowCardinalityLimitBehavior)
   }
 }
 
+TEST(AttributesHashMap, GrowthKeepsEntriesAndAggregations)
+{
+  // Above the default limit, so that the slots are reserved upfront.
+  const size_t limit = 5000;
+  AttributesHashMapWithCustomHash<> map(limit);
+  std::vector<Aggregation *> aggregations;
+  for (size_t i = 0; i < limit; ++i)
+  {
+    MetricAttributes attr = {{"k", static_cast<int64_t>(i)}, {"x", "y"}};
+    aggregations.push_back(map.GetOrSetDefault(
+        attr, []() { return std::unique_ptr<Aggregation>(new DropAggregation()); }));
+  }
+  EXPECT_EQ(map.Size(), limit);
+  EXPECT_GE(map.BucketCount(), limit);
+
+  // Aggregations are not moved when the hash grows, and are all found again.
+  for (size_t i = 0; i < limit; ++i)
+  {
+    MetricAttributes attr = {{"x", "y"}, {"k", static_cast<int64_t>(i)}};
+    EXPECT_EQ(map.Get(attr), aggregations[i]);
+  }
+  MetricAttributes missing = {{"k", static_cast<int64_t>(limit)}, {"x", "y"}};
+  EXPECT_FALSE(map.Has(missing));
+
+  // Entries are iterated in insertion order.
+  size_t index = 0;
+  map.GetAllEntries([&](const MetricAttributes &, Aggregation &aggregation) {
+    EXPECT_EQ(&aggregation, aggregations[index++]);
+    return true;
+  });
+  EXPECT_EQ(index, limit);
+
+  // Merging keeps every entry of both hashes once, within the cardinality limit.
+  AttributesHashMapWithCustomHash<> other(limit);
+  for (size_t i = limit / 2; i < limit + 10; ++i)
+  {
+    MetricAttributes attr = {{"k", static_cast<int64_t>(i)}, {"x", "y"}};
+    other.Set(attr, std::unique_ptr<Aggregation>(new DropAggregation()));
+  }
+  map.MergeFrom(std::move(other));
+  EXPECT_EQ(map.Size(), limit + 1);
+  EXPECT_NE(map.Get(GetOverflowAttributes()), nullptr);
+}
+
+TEST(AttributesHashMap, MergeFromKeepsBothOverflows)
+{
+  const size_t limit = 2;
+  auto create        = []() { return std::unique_ptr<Aggregation>(new LongSumAggregation(true)); };
+  auto record        = [&](AttributesHashMap &map, const std::string &value, int64_t measurement) {
+    map.GetOrSetDefault(MetricAttributes{{"k", value}}, create)->Aggregate(measurement);
+  };
+  auto sum = [](const Aggregation *aggregation) {
+    return nostd::get<int64_t>(nostd::get<SumPointData>(aggregation->ToPoint()).value_);
+  };
+
+  AttributesHashMap map(limit);
+  record(map, "a0", 1);
+  record(map, "a1", 1);
+  record(map, "a2", 10);
+  record(map, "a3", 10);
+  AttributesHashMap other(limit);
+  record(other, "b0", 100);
+  record(other, "b1", 100);
+  record(other, "b2", 1000);
+  ASSERT_EQ(sum(map.Get(GetOverflowAttributes())), 20);
+  ASSERT_EQ(sum(other.Get(GetOverflowAttributes())), 1000);
+
+  // The attribute sets of other over the limit, and its own overflow entry, are all merged into
+  // the overflow entry of map.
+  map.MergeFrom(std::move(other));
+  EXPECT_EQ(map.Size(), limit + 1);
+  EXPECT_EQ(sum(map.Get(MetricAttributes{{"k", "a0"}})), 1);
+  EXPECT_EQ(sum(map.Get(MetricAttributes{{"k", "a1"}})), 1);
+  EXPECT_EQ(sum(map.Get(GetOverflowAttributes())), 20 + 100 + 100 + 1000);
+}
+
+TEST(AttributesHashMap, EvictionKeepsLookupsAndOrder)
+{
+  const size_t count = 100;
+  AttributesHashMap map;
+  auto create = []() { return std::unique_ptr<Aggregation>(new DropAggregation()); };
+  auto attr   = [](size_t i) { return MetricAttributes{{"k", static_cast<int64_t>(i)}}; };
+  for (size_t i = 0; i < count; ++i)
+  {
+    map.GetOrSetDefault(attr(i), create);
+  }
+  EXPECT_EQ(map.EvictStale(1), 0);
+
+  // Only the even entries are updated, so the odd ones are evicted.
+  for (size_t i = 0; i < count; i += 2)
+  {
+    map.GetOrSetDefault(attr(i), create);
+  }
+  EXPECT_EQ(map.EvictStale(1), count / 2);
+  EXPECT_EQ(map.Size(), count / 2);
+  for (size_t i = 0; i < count; ++i)
+  {
+    EXPECT_EQ(map.Has(attr(i)), i % 2 == 0);
+  }
+  size_t index = 0;
+  map.GetAllEntries([&](const MetricAttributes &attributes, Aggregation &) {
+    EXPECT_EQ(attributes, attr(index));
+    index += 2;
+    return true;
+  });
+  EXPECT_EQ(index, count);
+
+  // The evicted attribute sets can be added again.
+  for (size_t i = 1; i < count; i += 2)
+  {
+    map.GetOrSetDefault(attr(i), create);
+  }
+  EXPECT_EQ(map.Size(), count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    EXPECT_TRUE(map.Has(attr(i)));
+  }
+}
+
+TEST(AttributesHashMap, LookupKeyValueIterable)
+{
+  std::map<std::string, opentelemetry::common::AttributeValue> recorded = {
+      {"bool", true},
+      {"int", static_cast<int32_t>(1)},
+      {"int64", static_cast<int64_t>(-2)},
+      {"uint", static_cast<uint32_t>(3)},
+      {"double", 4.5},
+      {"cstr", "c"},
+      {"string", nostd::string_view("s")}};
+  opentelemetry::common::KeyValueIterableView<decltype(recorded)> iterable(recorded);
+
+  // The hash of the recorded attributes is the hash of the MetricAttributes built from them.
+  MetricAttributes attributes{iterable, nullptr};
+  EXPECT_EQ(MetricAttributes::ComputeHash(iterable, nullptr), attributes.GetHash());
+  EXPECT_TRUE(attributes.EqualTo(iterable, nullptr));
+
+  // The hash does not depend on the order in which attributes are recorded.
+  MetricAttributes reordered = {{"string", "s"},
+                                {"cstr", "c"},
+                                {"double", 4.5},
+                                {"uint", static_cast<uint32_t>(3)},
+                                {"int64", static_cast<int64_t>(-2)},
+                                {"int", static_cast<int32_t>(1)},
+                                {"bool", true}};
+  EXPECT_EQ(reordered.GetHash(), attributes.GetHash());
+  EXPECT_TRUE(reordered.EqualTo(iterable, nullptr));
+
+  // Nor on the order of the recorded iterable, with more attributes than are sorted inline.
+  std::vector<std::pair<std::string, int32_t>> unsorted;
+  for (int32_t i = 20; i > 0; --i)
+  {
+    unsorted.emplace_back("key" + std::to_string(i), i);
+  }
+  unsorted.emplace_back("key5", 0);
+  opentelemetry::common::KeyValueIterableView<decltype(unsorted)> unsorted_iterable(unsorted);
+  MetricAttributes sorted{unsorted_iterable, nullptr};
+  EXPECT_EQ(sorted.size(), 20);
+  EXPECT_EQ(MetricAttributes::ComputeHash(unsorted_iterable, nullptr), sorted.GetHash());
+  unsorted.resize(3);
+  MetricAttributes sorted_inline{unsorted_iterable, nullptr};
+  EXPECT_EQ(MetricAttributes::ComputeHash(unsorted_iterable, nullptr), sorted_inline.GetHash());
+
+  // Values swapped between keys do not hash the same.
+  MetricAttributes swapped_1 = {{"a", static_cast<int32_t>(1)}, {"b", static_cast<int32_t>(2)}};
+  MetricAttributes swapped_2 = {{"a", static_cast<int32_t>(2)}, {"b", static_cast<int32_t>(1)}};
+  EXPECT_NE(swapped_1.GetHash(), swapped_2.GetHash());
+
+  // Attributes dropped by the processor are neither hashed nor compared.
+  FilteringAttributesProcessor processor({{"int", true}, {"string", true}});
+  MetricAttributes filtered{iterable, &processor};
+  EXPECT_EQ(filtered.size(), 2);
+  EXPECT_EQ(MetricAttributes::ComputeHash(iterable, &processor), filtered.GetHash());
+  EXPECT_TRUE(filtered.EqualTo(iterable, &processor));
+  EXPECT_FALSE(filtered.EqualTo(iterable, nullptr));
+  EXPECT_FALSE(attributes.EqualTo(iterable, &processor));
+
+  // Values of different types or content do not match.
+  std::map<std::string, opentelemetry::common::AttributeValue> other = recorded;
+  other["int"] = static_cast<int64_t>(1);
+  opentelemetry::common::KeyValueIterableView<decltype(other)> other_iterable(other);
+  EXPECT_FALSE(attributes.EqualTo(other_iterable, nullptr));
+  other["int"] = static_cast<int32_t>(2);
+  EXPECT_FALSE(attributes.EqualTo(other_iterable, nullptr));
+
+  // Duplicated keys are not matched by the lookup, the attributes are built instead.
+  std::vector<std::pair<std::string, int32_t>> duplicated = {{"int", 1}, {"int", 1}};
+  opentelemetry::common::KeyValueIterableView<decltype(duplicated)> duplicated_iterable(
+      duplicated);
+  MetricAttributes deduplicated = {{"int", static_cast<int32_t>(1)}};
+  EXPECT_FALSE(deduplicated.EqualTo(duplicated_iterable, nullptr));
+
+  // A hash map is looked up by the recorded attributes.
+  AttributesHashMap map;
+  std::unique_ptr<Aggregation> aggregation(new DropAggregation());
+  Aggregation *stored = aggregation.get();
+  map.Set(filtered, std::move(aggregation));
+  EXPECT_EQ(map.Get(MetricAttributes::ComputeHash(iterable, &processor),
+                    [&](const MetricAttributes &entry) {
+                      return entry.EqualTo(iterable, &processor);
+                    }),
+            stored);
+  EXPECT_EQ(map.Get(MetricAttributes::ComputeHash(iterable, nullptr),
+                    [&](const MetricAttributes &entry) {
+                      return entry.EqualTo(iterable, nullptr);
+                    }),
+            nullptr);
+}
+
+TEST(AttributesHashMap, SharedAttributes)
+{
+  auto create = []() { return std::unique_ptr<Aggregation>(new DropAggregation()); };
+  auto shared_attributes = [](const AttributesHashMap &map) {
+    std::map<std::string, const MetricAttributes *> attributes;
+    map.GetAllSharedEntries(
+        [&attributes](const std::shared_ptr<const MetricAttributes> &entry, Aggregation &) {
+          attributes[entry->begin()->first] = entry.get();
+          return true;
+        });
+    return attributes;
+  };
+
+  AttributesHashMap recorded;
+  recorded.GetOrSetDefault(MetricAttributes{{"k1", "v1"}}, create);
+  recorded.GetOrSetDefault(MetricAttributes{{"k2", "v2"}}, create);
+  auto attributes = shared_attributes(recorded);
+  ASSERT_EQ(attributes.size(), size_t{2});
+
+  // The attribute sets are shared with the hashes they are collected or merged into.
+  AttributesHashMap collected;
+  recorded.CollectInto(collected, 1, create);
+  EXPECT_EQ(shared_attributes(collected), attributes);
+
+  std::shared_ptr<const MetricAttributes> k2;
+  collected.GetAllSharedEntries(
+      [&k2](const std::shared_ptr<const MetricAttributes> &entry, Aggregation &) {
+        if (entry->count("k2"))
+        {
+          k2 = entry;
+        }
+        return true;
+      });
+  ASSERT_NE(k2, nullptr);
+
+  AttributesHashMap merged;
+  merged.GetOrSetDefault(k2, create);
+  merged.MergeFrom(std::move(collected));
+  EXPECT_EQ(shared_attributes(merged), attributes);
+
+  // A point shares the attribute set, and compares equal to a copy of it.
+  PointAttributes point(k2);
+  EXPECT_EQ(&point.GetAttributes(), k2.get());
+  EXPECT_EQ(point, PointAttributes({{"k2", "v2"}}));
+  EXPECT_NE(point, PointAttributes{});
+  EXPECT_EQ(point.size(), size_t{1});
+  EXPECT_EQ(nostd::get<std::string>(point.at("k2")), "v2");
+}
+
 }  // namespace
@@ -3,9 +3,15 @@
 
 #include <benchmark/benchmark.h>
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <random>
+#include <vector>
 
+#include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
+#include "opentelemetry/sdk/metrics/aggregation/aggregation_config.h"
+#include "opentelemetry/sdk/metrics/aggregation/base2_exponential_histogram_aggregation.h"
 #include "opentelemetry/sdk/metrics/aggregation/base2_exponential_histogram_indexer.h"
 
 using namespace opentelemetry::sdk::metrics;
@@ -59,7 +65,97 @@ void BM_ComputeIndex(benchmark::State &state)
   }
 }
 
-BENCHMARK(BM_ComputeIndex)->Arg(-1)->Arg(0)->Arg(1)->Arg(20);
+// Scales up to Base2ExponentialHistogramIndexer::kMaxLookupScale use the lookup
+// tables, 20 uses the logarithm.
+BENCHMARK(BM_ComputeIndex)->Arg(-1)->Arg(0)->Arg(1)->Arg(4)->Arg(10)->Arg(20);
+
+// Latencies in milliseconds: a log-normal body around 5ms, with one measurement
+// in 50 taken from a slow tail around 500ms, as seen in bursty request traffic.
+std::vector<double> MakeLatencyMeasurements(size_t count, unsigned seed)
+{
+  std::default_random_engine generator(seed);
+  std::lognormal_distribution<double> body(1.6, 0.5);
+  std::lognormal_distribution<double> tail(6.2, 0.8);
+  std::vector<double> measurements;
+  measurements.reserve(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    measurements.push_back(i % 50 == 0 ? tail(generator) : body(generator));
+  }
+  return measurements;
+}
+
+constexpr size_t kLatencyMeasurementCount = 4096;
+
+// A long-lived aggregation, which has settled on the scale of the latencies
+// after the first iteration.
+void BM_Aggregate(benchmark::State &state)
+{
+  const std::vector<double> measurements = MakeLatencyMeasurements(kLatencyMeasurementCount, 1);
+  Base2ExponentialHistogramAggregationConfig config;
+  config.max_size_ = static_cast<size_t>(state.range(0));
+  Base2ExponentialHistogramAggregation aggregation(&config);
+
+  for (auto _ : state)
+  {
+    for (double value : measurements)
+    {
+      aggregation.Aggregate(value);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(measurements.size()));
+}
+
+BENCHMARK(BM_Aggregate)->Arg(20)->Arg(160);
+
+// A new aggregation per iteration, which starts at the maximum scale and is
+// rescaled as the range of the recorded latencies grows, like the aggregation
+// of a new attribute set or of a delta collection interval.
+void BM_AggregateFromMaxScale(benchmark::State &state)
+{
+  const std::vector<double> measurements = MakeLatencyMeasurements(kLatencyMeasurementCount, 1);
+  Base2ExponentialHistogramAggregationConfig config;
+  config.max_size_ = static_cast<size_t>(state.range(0));
+
+  for (auto _ : state)
+  {
+    Base2ExponentialHistogramAggregation aggregation(&config);
+    for (double value : measurements)
+    {
+      aggregation.Aggregate(value);
+    }
+    benchmark::DoNotOptimize(aggregation);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(measurements.size()));
+}
+
+BENCHMARK(BM_AggregateFromMaxScale)->Arg(20)->Arg(160);
+
+// Merge of two aggregations of latencies recorded with different seeds, as done
+// for each attribute set when a cumulative point is updated with a delta.
+void BM_Merge(benchmark::State &state)
+{
+  Base2ExponentialHistogramAggregationConfig config;
+  config.max_size_ = static_cast<size_t>(state.range(0));
+  Base2ExponentialHistogramAggregation left(&config);
+  Base2ExponentialHistogramAggregation right(&config);
+  for (double value : MakeLatencyMeasurements(kLatencyMeasurementCount, 1))
+  {
+    left.Aggregate(value);
+  }
+  for (double value : MakeLatencyMeasurements(kLatencyMeasurementCount, 2))
+  {
+    right.Aggregate(value);
+  }
+
+  for (auto _ : state)
+  {
+    std::unique_ptr<Aggregation> merged = left.Merge(right);
+    benchmark::DoNotOptimize(merged);
+  }
+}
+
+BENCHMARK(BM_Merge)->Arg(20)->Arg(160);
 
 }  // namespace
 
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <limits>
 #include <string>
@@ -179,3 +181,33 @@ TEST(Base2ExponentialHistogramIndexerTest, ScaleNegativeFour)
   EXPECT_EQ(compute_index(std::strtod("0x1p-0976", nullptr)), -62);
   EXPECT_EQ(compute_index(std::strtod("0x1p-0975", nullptr)), -61);
 }
+
+// Up to kMaxLookupScale the index comes from the lookup tables, and above it from the logarithm.
+// The middle of every bucket of a few powers of two on both sides of 1 must map to that bucket,
+// and powers of two to the last bucket below them.
+TEST(Base2ExponentialHistogramIndexerTest, LookupScales)
+{
+  const int32_t max_lookup_scale = Base2ExponentialHistogramIndexer::kMaxLookupScale;
+  for (int32_t scale = 1; scale <= max_lookup_scale + 1; ++scale)
+  {
+    const Base2ExponentialHistogramIndexer indexer{scale};
+    const int32_t bucket_count = int32_t{1} << scale;
+    for (int32_t index = -3 * bucket_count; index < 3 * bucket_count; ++index)
+    {
+      const double middle = std::exp2((index + 0.5) / bucket_count);
+      EXPECT_EQ(indexer.ComputeIndex(middle), index) << "scale " << scale << ", value " << middle;
+      EXPECT_EQ(indexer.ComputeIndex(-middle), index) << "scale " << scale << ", value " << -middle;
+    }
+    if (scale > max_lookup_scale)
+    {
+      // Indexing by logarithm is not exact on the bucket boundaries.
+      continue;
+    }
+    for (int32_t exponent : {-1022, -3, -1, 0, 1, 5, 1023})
+    {
+      EXPECT_EQ(indexer.ComputeIndex(std::ldexp(1.0, exponent)), exponent * bucket_count - 1)
+          << "scale " << scale << ", exponent " << exponent;
+    }
+    EXPECT_EQ(indexer.ComputeIndex(std::numeric_limits<double>::max()), 1024 * bucket_count - 1);
+  }
+}
@@ -9,11 +9,13 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 #include "common.h"
 
 #include "opentelemetry/common/key_value_iterable_view.h"
+#include "opentelemetry/common/timestamp.h"
 #include "opentelemetry/context/context.h"
 #include "opentelemetry/nostd/function_ref.h"
 #include "opentelemetry/nostd/span.h"
@@ -28,6 +30,7 @@
 #include "opentelemetry/sdk/metrics/state/attributes_hashmap.h"
 #include "opentelemetry/sdk/metrics/state/filtered_ordered_attribute_map.h"
 #include "opentelemetry/sdk/metrics/state/metric_collector.h"
+#include "opentelemetry/sdk/metrics/state/sharded_attributes_hashmap.h"
 #include "opentelemetry/sdk/metrics/state/sync_metric_storage.h"
 #include "opentelemetry/sdk/metrics/view/attributes_processor.h"
 
@@ -75,10 +78,12 @@ TEST(CardinalityLimit, AttributesHashMapBasicTests)
         ->Aggregate(record_value);
   }
   EXPECT_EQ(hash_map.Size(), 11);  // no new metric point added
+  EXPECT_EQ(hash_map.OverflowCount(), 5);
 
   // get the overflow metric point
   auto agg1 = hash_map.GetOrSetDefault(GetOverflowAttributes(), aggregation_callback);
   EXPECT_NE(agg1, nullptr);
+  EXPECT_EQ(hash_map.OverflowCount(), 5);  // the overflow attributes are not counted
   auto sum_agg1 = static_cast<LongSumAggregation *>(agg1);
   EXPECT_EQ(nostd::get<int64_t>(nostd::get<SumPointData>(sum_agg1->ToPoint()).value_),
             record_value * 5);
@@ -102,11 +107,409 @@ TEST(CardinalityLimit, AttributesHashMapBasicTests)
   }
 }
 
+TEST(CardinalityLimit, AttributesHashMapOverflowCountIgnoresMerges)
+{
+  std::function<std::unique_ptr<Aggregation>()> aggregation_callback =
+      []() -> std::unique_ptr<Aggregation> {
+    return std::unique_ptr<Aggregation>(new LongSumAggregation(true));
+  };
+  AttributesHashMap hash_map(2);
+  for (auto i = 0; i < 4; i++)
+  {
+    FilteredOrderedAttributeMap attributes = {{"key", std::to_string(i)}};
+    hash_map.GetOrSetDefault(attributes, aggregation_callback)->Aggregate(int64_t{100});
+  }
+  EXPECT_EQ(hash_map.OverflowCount(), 2);
+
+  // Merging the attribute sets of other hashes over the limit, as collections do, does not count
+  // them again.
+  AttributesHashMap other(2);
+  for (auto i = 4; i < 6; i++)
+  {
+    FilteredOrderedAttributeMap attributes = {{"key", std::to_string(i)}};
+    other.GetOrSetDefault(attributes, aggregation_callback)->Aggregate(int64_t{100});
+  }
+  hash_map.MergeFrom(std::move(other));
+  LongSumAggregation delta(true);
+  delta.Aggregate(int64_t{100});
+  hash_map.Merge(FilteredOrderedAttributeMap{{"key", "6"}}, delta, aggregation_callback);
+  EXPECT_EQ(hash_map.OverflowCount(), 2);
+  EXPECT_EQ(hash_map.Size(), 3);
+  EXPECT_EQ(nostd::get<int64_t>(
+                nostd::get<SumPointData>(hash_map.Get(GetOverflowAttributes())->ToPoint()).value_),
+            500);
+
+  // Recording with Set() counts.
+  hash_map.Set(FilteredOrderedAttributeMap{{"key", "7"}}, aggregation_callback());
+  EXPECT_EQ(hash_map.OverflowCount(), 3);
+}
+
+TEST(CardinalityLimit, ShardedAttributesHashMapTests)
+{
+  ShardedAttributesHashMap hash_map(4, 10);
+  EXPECT_EQ(hash_map.ShardCount(), 4);
+  std::function<std::unique_ptr<Aggregation>()> aggregation_callback =
+      []() -> std::unique_ptr<Aggregation> {
+    return std::unique_ptr<Aggregation>(new LongSumAggregation(true));
+  };
+  int64_t record_value = 100;
+  auto aggregate       = [record_value](Aggregation &aggregation) {
+    aggregation.Aggregate(record_value);
+  };
+  // The limit applies to all the shards together: 10 unique metric points, and 5 above the limit
+  // which are aggregated in the overflow metric point of their respective shards.
+  for (auto i = 0; i < 15; i++)
+  {
+    FilteredOrderedAttributeMap attributes = {{"key", std::to_string(i)}};
+    hash_map.GetOrSetDefault(attributes, aggregation_callback, aggregate);
+  }
+  // Existing metric points are still aggregated after the limit is reached.
+  for (auto i = 0; i < 5; i++)
+  {
+    FilteredOrderedAttributeMap attributes = {{"key", std::to_string(i)}};
+    hash_map.GetOrSetDefault(attributes, aggregation_callback, aggregate);
+  }
+  EXPECT_TRUE(hash_map.Has(GetOverflowAttributes()));
+  EXPECT_EQ(hash_map.OverflowCount(), 5);
+
+  // Collect merges the shards, and their overflow metric points.
+  auto collected = hash_map.Collect(aggregation_callback);
+  EXPECT_EQ(collected->Size(), 11);
+  auto overflow = static_cast<LongSumAggregation *>(collected->Get(GetOverflowAttributes()));
+  ASSERT_NE(overflow, nullptr);
+  EXPECT_EQ(nostd::get<int64_t>(nostd::get<SumPointData>(overflow->ToPoint()).value_),
+            record_value * 5);
+  for (auto i = 0; i < 10; i++)
+  {
+    FilteredOrderedAttributeMap attributes = {{"key", std::to_string(i)}};
+    auto sum_agg = static_cast<LongSumAggregation *>(collected->Get(attributes));
+    ASSERT_NE(sum_agg, nullptr);
+    EXPECT_EQ(nostd::get<int64_t>(nostd::get<SumPointData>(sum_agg->ToPoint()).value_),
+              record_value * (i < 5 ? 2 : 1));
+  }
+
+  // The limit is reset by the collection.
+  EXPECT_FALSE(hash_map.Has(GetOverflowAttributes()));
+  for (auto i = 15; i < 25; i++)
+  {
+    FilteredOrderedAttributeMap attributes = {{"key", std::to_string(i)}};
+    hash_map.GetOrSetDefault(attributes, aggregation_callback, aggregate);
+  }
+  EXPECT_FALSE(hash_map.Has(GetOverflowAttributes()));
+  EXPECT_EQ(hash_map.Collect(aggregation_callback)->Size(), 10);
+}
+
+TEST(CardinalityLimit, ShardedAttributesHashMapRetainedTests)
+{
+  const size_t max_idle_collections = 2;
+  ShardedAttributesHashMap hash_map(4, 10, max_idle_collections);
+  std::function<std::unique_ptr<Aggregation>()> aggregation_callback =
+      []() -> std::unique_ptr<Aggregation> {
+    return std::unique_ptr<Aggregation>(new LongSumAggregation(true));
+  };
+  int64_t record_value = 100;
+  auto aggregate       = [record_value](Aggregation &aggregation) {
+    aggregation.Aggregate(record_value);
+  };
+  auto value = [](Aggregation *aggregation) {
+    return nostd::get<int64_t>(nostd::get<SumPointData>(aggregation->ToPoint()).value_);
+  };
+
+  for (auto i = 0; i < 10; i++)
+  {
+    std::map<std::string, std::string> attributes = {{"key", std::to_string(i)}};
+    hash_map.GetOrSetDefault(KeyValueIterableView<std::map<std::string, std::string>>(attributes),
+                             nullptr, aggregation_callback, aggregate);
+  }
+  auto collected = hash_map.Collect(aggregation_callback);
+  EXPECT_EQ(collected->Size(), 10);
+  Aggregation *first_aggregation = collected->Get({{"key", "0"}});
+  ASSERT_NE(first_aggregation, nullptr);
+  EXPECT_EQ(value(first_aggregation), record_value);
+  collected.reset();
+
+  // The attribute sets are retained, and their reset aggregations reused.
+  EXPECT_EQ(hash_map.RetainedSize(), 10);
+  EXPECT_FALSE(hash_map.Has({{"key", "0"}}));
+  for (auto i = 0; i < 5; i++)
+  {
+    std::map<std::string, std::string> attributes = {{"key", std::to_string(i)}};
+    hash_map.GetOrSetDefault(KeyValueIterableView<std::map<std::string, std::string>>(attributes),
+                             nullptr, aggregation_callback, aggregate);
+  }
+  // Retained attribute sets do not count towards the cardinality limit.
+  for (auto i = 10; i < 15; i++)
+  {
+    FilteredOrderedAttributeMap attributes = {{"key", std::to_string(i)}};
+    hash_map.GetOrSetDefault(attributes, aggregation_callback, aggregate);
+  }
+  EXPECT_FALSE(hash_map.Has(GetOverflowAttributes()));
+  EXPECT_EQ(hash_map.RetainedSize(), 15);
+
+  collected = hash_map.Collect(aggregation_callback);
+  EXPECT_EQ(collected->Size(), 10);
+  for (auto i = 0; i < 15; i++)
+  {
+    Aggregation *aggregation = collected->Get({{"key", std::to_string(i)}});
+    if (i >= 5 && i < 10)
+    {
+      EXPECT_EQ(aggregation, nullptr);
+      continue;
+    }
+    ASSERT_NE(aggregation, nullptr);
+    EXPECT_EQ(value(aggregation), record_value);
+  }
+  collected.reset();
+
+  // Reactivated attribute sets count towards the cardinality limit.
+  for (auto i = 0; i < 15; i++)
+  {
+    std::map<std::string, std::string> attributes = {{"key", std::to_string(i)}};
+    hash_map.GetOrSetDefault(KeyValueIterableView<std::map<std::string, std::string>>(attributes),
+                             nullptr, aggregation_callback, aggregate);
+  }
+  EXPECT_TRUE(hash_map.Has(GetOverflowAttributes()));
+  collected = hash_map.Collect(aggregation_callback);
+  EXPECT_EQ(collected->Size(), 11);
+  auto overflow = collected->Get(GetOverflowAttributes());
+  ASSERT_NE(overflow, nullptr);
+  EXPECT_EQ(value(overflow), record_value * 5);
+  // Aggregations are exchanged between the shards and the collected hash at each collection.
+  EXPECT_EQ(collected->Get({{"key", "0"}}), first_aggregation);
+
+  // A collected hash still referenced is not reused.
+  auto previous = hash_map.Collect(aggregation_callback);
+  EXPECT_NE(previous, collected);
+  EXPECT_EQ(previous->Size(), 0);
+  collected.reset();
+
+  // Attribute sets are evicted after max_idle_collections collections without measurements.
+  previous.reset();
+  hash_map.Collect(aggregation_callback);
+  EXPECT_EQ(hash_map.RetainedSize(), 0);
+}
+
+TEST(CardinalityLimit, AttributesHashMapEvictStaleTests)
+{
+  const size_t max_stale_collections = 2;
+  AttributesHashMap hash_map(3);
+  std::function<std::unique_ptr<Aggregation>()> aggregation_callback =
+      []() -> std::unique_ptr<Aggregation> {
+    return std::unique_ptr<Aggregation>(new LongSumAggregation(true));
+  };
+  for (auto i = 0; i < 4; i++)
+  {
+    FilteredOrderedAttributeMap attributes = {{"key", std::to_string(i)}};
+    hash_map.GetOrSetDefault(attributes, aggregation_callback)->Aggregate(int64_t{1});
+  }
+  EXPECT_TRUE(hash_map.Has(GetOverflowAttributes()));
+  EXPECT_EQ(hash_map.EvictStale(max_stale_collections), 0);
+  const size_t memory_usage = hash_map.MemoryUsage();
+  EXPECT_GT(memory_usage, 0);
+
+  // Only the attribute sets updated in the last max_stale_collections collections are kept.
+  FilteredOrderedAttributeMap updated = {{"key", "0"}};
+  hash_map.GetOrSetDefault(updated, aggregation_callback)->Aggregate(int64_t{1});
+  EXPECT_EQ(hash_map.EvictStale(max_stale_collections), 0);
+  hash_map.Set(updated, aggregation_callback());
+  EXPECT_EQ(hash_map.EvictStale(max_stale_collections), 3);
+  EXPECT_EQ(hash_map.Size(), 1);
+  EXPECT_TRUE(hash_map.Has(updated));
+  EXPECT_FALSE(hash_map.Has(GetOverflowAttributes()));
+  EXPECT_LT(hash_map.MemoryUsage(), memory_usage);
+
+  // The evicted attribute sets do not count towards the cardinality limit anymore.
+  for (auto i = 1; i < 3; i++)
+  {
+    FilteredOrderedAttributeMap attributes = {{"key", std::to_string(i)}};
+    hash_map.GetOrSetDefault(attributes, aggregation_callback);
+  }
+  EXPECT_FALSE(hash_map.Has(GetOverflowAttributes()));
+  EXPECT_EQ(hash_map.Size(), 3);
+}
+
+TEST(CardinalityLimit, CumulativeStaleAttributesEviction)
+{
+  auto sdk_start_ts               = std::chrono::system_clock::now();
+  InstrumentDescriptor instr_desc = {"name", "desc", "1unit", InstrumentType::kCounter,
+                                     InstrumentValueType::kLong};
+  AggregationConfig aggConfig;
+  aggConfig.max_stale_collections_ = 2;
+  std::shared_ptr<DefaultAttributesProcessor> default_attributes_processor{
+      new DefaultAttributesProcessor{}};
+  SyncMetricStorage storage(instr_desc, AggregationType::kSum, default_attributes_processor,
+#ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
+                            ExemplarFilterType::kAlwaysOff,
+                            ExemplarReservoir::GetNoExemplarReservoir(),
+#endif
+                            &aggConfig);
+  std::shared_ptr<CollectorHandle> collector(
+      new MockCollectorHandle(AggregationTemporality::kCumulative));
+  std::vector<std::shared_ptr<CollectorHandle>> collectors;
+  collectors.push_back(collector);
+
+  auto record = [&storage](int begin, int end) {
+    for (auto i = begin; i < end; i++)
+    {
+      std::map<std::string, std::string> attributes = {{"key", std::to_string(i)}};
+      storage.RecordLong(100, KeyValueIterableView<std::map<std::string, std::string>>(attributes),
+                         opentelemetry::context::Context{});
+    }
+  };
+  opentelemetry::common::SystemTimestamp collection_ts;
+  std::map<std::string, opentelemetry::common::SystemTimestamp> start_ts;
+  auto collect = [&]() {
+    std::map<std::string, int64_t> values;
+    collection_ts = std::chrono::system_clock::now();
+    storage.Collect(collector.get(), collectors, sdk_start_ts, collection_ts,
+                    [&](const MetricData &metric_data) {
+                      EXPECT_EQ(metric_data.start_ts, sdk_start_ts);
+                      for (const auto &data_attr : metric_data.point_data_attr_)
+                      {
+                        auto key = nostd::get<std::string>(data_attr.attributes.at("key"));
+                        values[key] = nostd::get<int64_t>(
+                            nostd::get<SumPointData>(data_attr.point_data).value_);
+                        start_ts[key] = data_attr.start_ts;
+                      }
+                      return true;
+                    });
+    return values;
+  };
+
+  record(0, 5);
+  EXPECT_EQ(collect().size(), 5);
+  const size_t memory_usage = storage.GetMemoryUsage();
+  EXPECT_GT(memory_usage, 0);
+  record(0, 2);
+  EXPECT_EQ(collect().size(), 5);
+
+  // The attribute sets without measurements in the last 2 collections are evicted.
+  record(0, 2);
+  auto values = collect();
+  EXPECT_EQ(values.size(), 2);
+  EXPECT_EQ(values["0"], 300);
+  EXPECT_LT(storage.GetMemoryUsage(), memory_usage);
+
+  // An evicted attribute set restarts from zero, and its start timestamp moves forward to the
+  // collection preceding its new measurements. The other series keep the start of the metric.
+  const opentelemetry::common::SystemTimestamp eviction_ts = collection_ts;
+  record(3, 4);
+  values = collect();
+  EXPECT_EQ(values.size(), 3);
+  EXPECT_EQ(values["3"], 100);
+  EXPECT_EQ(start_ts["3"], eviction_ts);
+  EXPECT_GT(start_ts["3"].time_since_epoch().count(),
+            opentelemetry::common::SystemTimestamp(sdk_start_ts).time_since_epoch().count());
+  EXPECT_EQ(start_ts["0"], opentelemetry::common::SystemTimestamp{});
+}
+
+TEST(CardinalityLimit, CumulativeStaleAttributesEvictionWithMultipleReaders)
+{
+  auto sdk_start_ts               = std::chrono::system_clock::now();
+  InstrumentDescriptor instr_desc = {"name", "desc", "1unit", InstrumentType::kCounter,
+                                     InstrumentValueType::kLong};
+  AggregationConfig aggConfig;
+  aggConfig.max_stale_collections_ = 2;
+  std::shared_ptr<DefaultAttributesProcessor> default_attributes_processor{
+      new DefaultAttributesProcessor{}};
+  SyncMetricStorage storage(instr_desc, AggregationType::kSum, default_attributes_processor,
+#ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
+                            ExemplarFilterType::kAlwaysOff,
+                            ExemplarReservoir::GetNoExemplarReservoir(),
+#endif
+                            &aggConfig);
+  std::vector<std::shared_ptr<CollectorHandle>> collectors;
+  collectors.emplace_back(new MockCollectorHandle(AggregationTemporality::kCumulative));
+  collectors.emplace_back(new MockCollectorHandle(AggregationTemporality::kCumulative));
+  collectors.emplace_back(new MockCollectorHandle(AggregationTemporality::kDelta));
+
+  auto record = [&storage](int begin, int end) {
+    for (auto i = begin; i < end; i++)
+    {
+      std::map<std::string, std::string> attributes = {{"key", std::to_string(i)}};
+      storage.RecordLong(100, KeyValueIterableView<std::map<std::string, std::string>>(attributes),
+                         opentelemetry::context::Context{});
+    }
+  };
+  // Every reader collects once per round, and reports the number of cumulative series.
+  auto collect_round = [&]() {
+    std::vector<size_t> sizes;
+    for (auto &collector : collectors)
+    {
+      storage.Collect(collector.get(), collectors, sdk_start_ts, std::chrono::system_clock::now(),
+                      [&](const MetricData &metric_data) {
+                        if (metric_data.aggregation_temporality ==
+                            AggregationTemporality::kCumulative)
+                        {
+                          sizes.push_back(metric_data.point_data_attr_.size());
+                        }
+                        return true;
+                      });
+    }
+    return sizes;
+  };
+
+  record(0, 5);
+  EXPECT_EQ(collect_round(), (std::vector<size_t>{5, 5}));
+  record(0, 2);
+  EXPECT_EQ(collect_round(), (std::vector<size_t>{5, 5}));
+
+  // The eviction delay counts collection rounds, not the collections of each reader.
+  record(0, 2);
+  EXPECT_EQ(collect_round(), (std::vector<size_t>{2, 2}));
+}
+
+TEST(CardinalityLimit, StorageOverflowCountIgnoresCollections)
+{
+  auto sdk_start_ts               = std::chrono::system_clock::now();
+  InstrumentDescriptor instr_desc = {"name", "desc", "1unit", InstrumentType::kCounter,
+                                     InstrumentValueType::kLong};
+  AggregationConfig aggConfig(2);
+  std::shared_ptr<DefaultAttributesProcessor> default_attributes_processor{
+      new DefaultAttributesProcessor{}};
+  SyncMetricStorage storage(instr_desc, AggregationType::kSum, default_attributes_processor,
+#ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
+                            ExemplarFilterType::kAlwaysOff,
+                            ExemplarReservoir::GetNoExemplarReservoir(),
+#endif
+                            &aggConfig);
+  std::vector<std::shared_ptr<CollectorHandle>> collectors;
+  collectors.emplace_back(new MockCollectorHandle(AggregationTemporality::kCumulative));
+  collectors.emplace_back(new MockCollectorHandle(AggregationTemporality::kDelta));
+
+  auto record = [&storage](int begin, int end) {
+    for (auto i = begin; i < end; i++)
+    {
+      std::map<std::string, std::string> attributes = {{"key", std::to_string(i)}};
+      storage.RecordLong(100, KeyValueIterableView<std::map<std::string, std::string>>(attributes),
+                         opentelemetry::context::Context{});
+    }
+  };
+  auto collect_round = [&]() {
+    for (auto &collector : collectors)
+    {
+      storage.Collect(collector.get(), collectors, sdk_start_ts, std::chrono::system_clock::now(),
+                      [](const MetricData &) { return true; });
+    }
+  };
+
+  record(0, 5);
+  EXPECT_EQ(storage.GetOverflowCount(), 3);
+  // The collections merge the overflow series into the cumulative and unreported metrics, which
+  // are at the limit too, without counting the overflows again.
+  collect_round();
+  collect_round();
+  EXPECT_EQ(storage.GetOverflowCount(), 3);
+  // The limit applies to each collection interval of the recorded measurements.
+  record(0, 5);
+  EXPECT_EQ(storage.GetOverflowCount(), 6);
+}
+
 namespace
 {
 
 class WritableMetricStorageCardinalityLimitTestFixture
-    : public ::testing::TestWithParam<AggregationTemporality>
+    : public ::testing::TestWithParam<std::tuple<AggregationTemporality, size_t, size_t>>
 {};
 
 TEST_P(WritableMetricStorageCardinalityLimitTestFixture, LongCounterSumAggregation)
@@ -116,6 +519,8 @@ TEST_P(WritableMetricStorageCardinalityLimitTestFixture, LongCounterSumAggregati
   InstrumentDescriptor instr_desc = {"name", "desc", "1unit", InstrumentType::kCounter,
                                      InstrumentValueType::kLong};
   AggregationConfig aggConfig(attributes_limit);
+  aggConfig.attributes_shard_count_ = std::get<1>(GetParam());
+  aggConfig.max_idle_collections_   = std::get<2>(GetParam());
   std::shared_ptr<DefaultAttributesProcessor> default_attributes_processor{
       new DefaultAttributesProcessor{}};
   SyncMetricStorage storage(instr_desc, AggregationType::kSum, default_attributes_processor,
@@ -134,7 +539,7 @@ TEST_P(WritableMetricStorageCardinalityLimitTestFixture, LongCounterSumAggregati
                        KeyValueIterableView<std::map<std::string, std::string>>(attributes),
                        opentelemetry::context::Context{});
   }
-  AggregationTemporality temporality = GetParam();
+  AggregationTemporality temporality = std::get<0>(GetParam());
   std::shared_ptr<CollectorHandle> collector(new MockCollectorHandle(temporality));
   std::vector<std::shared_ptr<CollectorHandle>> collectors;
   collectors.push_back(collector);
@@ -163,10 +568,113 @@ TEST_P(WritableMetricStorageCardinalityLimitTestFixture, LongCounterSumAggregati
       });
   EXPECT_EQ(count_attributes, attributes_limit + 1);
   EXPECT_EQ(overflow_present, true);
+
+  // The next collection only reports the measurements recorded since the previous one.
+  for (auto i = 5; i < 20; i++)
+  {
+    std::map<std::string, std::string> attributes = {{"key", std::to_string(i)}};
+    storage.RecordLong(record_value,
+                       KeyValueIterableView<std::map<std::string, std::string>>(attributes),
+                       opentelemetry::context::Context{});
+  }
+  count_attributes = 0;
+  overflow_present = false;
+  storage.Collect(collector.get(), collectors, sdk_start_ts, std::chrono::system_clock::now(),
+                  [&](const MetricData &metric_data) {
+                    for (const auto &data_attr : metric_data.point_data_attr_)
+                    {
+                      const auto &data =
+                          opentelemetry::nostd::get<SumPointData>(data_attr.point_data);
+                      count_attributes++;
+                      if (data_attr.attributes.begin()->first == kAttributesLimitOverflowKey)
+                      {
+                        EXPECT_EQ(nostd::get<int64_t>(data.value_), record_value * 5);
+                        overflow_present = true;
+                      }
+                      else
+                      {
+                        EXPECT_EQ(nostd::get<int64_t>(data.value_), record_value);
+                      }
+                    }
+                    return true;
+                  });
+  EXPECT_EQ(count_attributes, attributes_limit + 1);
+  EXPECT_EQ(overflow_present, true);
+}
+#ifndef OPENTELEMETRY_HAVE_METRICS_BOUND_INSTRUMENTS_PREVIEW
+TEST_P(WritableMetricStorageCardinalityLimitTestFixture, NoAttributesAtLimit)
+{
+  auto sdk_start_ts               = std::chrono::system_clock::now();
+  const size_t attributes_limit   = 3;
+  InstrumentDescriptor instr_desc = {"name", "desc", "1unit", InstrumentType::kCounter,
+                                     InstrumentValueType::kLong};
+  AggregationConfig aggConfig(attributes_limit);
+  aggConfig.attributes_shard_count_ = std::get<1>(GetParam());
+  aggConfig.max_idle_collections_   = std::get<2>(GetParam());
+  std::shared_ptr<DefaultAttributesProcessor> default_attributes_processor{
+      new DefaultAttributesProcessor{}};
+  SyncMetricStorage storage(instr_desc, AggregationType::kSum, default_attributes_processor,
+#  ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
+                            ExemplarFilterType::kAlwaysOff,
+                            ExemplarReservoir::GetNoExemplarReservoir(),
+#  endif
+                            &aggConfig);
+  std::shared_ptr<CollectorHandle> collector(new MockCollectorHandle(std::get<0>(GetParam())));
+  std::vector<std::shared_ptr<CollectorHandle>> collectors;
+  collectors.push_back(collector);
+
+  auto record = [&storage]() {
+    for (auto i = 0; i < 5; i++)
+    {
+      std::map<std::string, std::string> attributes = {{"key", std::to_string(i)}};
+      storage.RecordLong(100, KeyValueIterableView<std::map<std::string, std::string>>(attributes),
+                         opentelemetry::context::Context{});
+    }
+  };
+  auto collect = [&]() {
+    size_t count_attributes = 0;
+    int64_t no_attributes   = 0;
+    int64_t overflow        = 0;
+    storage.Collect(collector.get(), collectors, sdk_start_ts, std::chrono::system_clock::now(),
+                    [&](const MetricData &metric_data) {
+                      for (const auto &data_attr : metric_data.point_data_attr_)
+                      {
+                        const auto value = nostd::get<int64_t>(
+                            nostd::get<SumPointData>(data_attr.point_data).value_);
+                        count_attributes++;
+                        if (data_attr.attributes.empty())
+                        {
+                          no_attributes = value;
+                        }
+                        else if (data_attr.attributes.begin()->first == kAttributesLimitOverflowKey)
+                        {
+                          overflow = value;
+                        }
+                      }
+                      return true;
+                    });
+    EXPECT_EQ(count_attributes, attributes_limit + 1);
+    EXPECT_EQ(no_attributes, 7);
+    EXPECT_EQ(overflow, 300);
+  };
+
+  // Once the instrument recorded without attributes, a slot of the limit is reserved for these
+  // measurements, which are merged after the attribute sets and are never routed to the overflow
+  // point, whether they are recorded before or after the attribute sets reach the limit.
+  storage.RecordLong(7, opentelemetry::context::Context{});
+  record();
+  collect();
+  record();
+  storage.RecordLong(7, opentelemetry::context::Context{});
+  collect();
 }
+#endif
+
 INSTANTIATE_TEST_SUITE_P(All,
                          WritableMetricStorageCardinalityLimitTestFixture,
-                         ::testing::Values(AggregationTemporality::kDelta));
+                         ::testing::Combine(::testing::Values(AggregationTemporality::kDelta),
+                                            ::testing::Values(size_t{1}, size_t{4}),
+                                            ::testing::Values(size_t{0}, size_t{2})));
 
 // Pin the overflow attribute key and value to the contract defined in the
 // OpenTelemetry Metrics SDK specification. The previous key value
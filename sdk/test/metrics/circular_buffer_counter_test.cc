@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
@@ -507,4 +508,141 @@ TEST(AdaptingCircularBufferCounterTest, DownscaleMatchesReferenceImplementation)
   }
 }
 
+TEST(AdaptingCircularBufferCounterTest, MergeFrom)
+{
+  AdaptingCircularBufferCounter counter{8};
+  EXPECT_TRUE(counter.Increment(5, 1));
+  EXPECT_TRUE(counter.Increment(3, 2));
+
+  // The other counter is wrapped around its backing array differently.
+  AdaptingCircularBufferCounter other{8};
+  EXPECT_TRUE(other.Increment(4, 4));
+  EXPECT_TRUE(other.Increment(2, 8));
+  EXPECT_TRUE(other.Increment(5, 16));
+
+  EXPECT_TRUE(counter.MergeFrom(other));
+
+  EXPECT_EQ(counter.StartIndex(), 2);
+  EXPECT_EQ(counter.EndIndex(), 5);
+  EXPECT_EQ(counter.Get(2), 8);
+  EXPECT_EQ(counter.Get(3), 2);
+  EXPECT_EQ(counter.Get(4), 4);
+  EXPECT_EQ(counter.Get(5), 17);
+  EXPECT_EQ(TotalCount(counter), 31);
+  // The merged counter is left untouched.
+  EXPECT_EQ(TotalCount(other), 28);
+}
+
+TEST(AdaptingCircularBufferCounterTest, MergeFromEmpty)
+{
+  AdaptingCircularBufferCounter empty{4};
+  AdaptingCircularBufferCounter counter{6};
+  EXPECT_TRUE(counter.Increment(-2, 3));
+  EXPECT_TRUE(counter.Increment(1, 5));
+
+  EXPECT_TRUE(counter.MergeFrom(empty));
+  EXPECT_EQ(TotalCount(counter), 8);
+
+  // A counter of another size can be merged into an empty one as long as the
+  // range fits.
+  EXPECT_TRUE(empty.MergeFrom(counter));
+  EXPECT_EQ(empty.StartIndex(), -2);
+  EXPECT_EQ(empty.EndIndex(), 1);
+  EXPECT_EQ(empty.Get(-2), 3);
+  EXPECT_EQ(empty.Get(1), 5);
+  EXPECT_EQ(empty.MaxSize(), 4);
+
+  // The counter stays usable afterwards.
+  EXPECT_TRUE(empty.Increment(-1, 1));
+  EXPECT_FALSE(empty.Increment(2, 1));
+  EXPECT_EQ(TotalCount(empty), 9);
+}
+
+TEST(AdaptingCircularBufferCounterTest, MergeFromFailsWhenTheUnionDoesNotFit)
+{
+  AdaptingCircularBufferCounter counter{4};
+  EXPECT_TRUE(counter.Increment(0, 1));
+  EXPECT_TRUE(counter.Increment(3, 1));
+  AdaptingCircularBufferCounter other{4};
+  EXPECT_TRUE(other.Increment(4, 1));
+
+  EXPECT_FALSE(counter.MergeFrom(other));
+
+  EXPECT_EQ(counter.StartIndex(), 0);
+  EXPECT_EQ(counter.EndIndex(), 3);
+  EXPECT_EQ(TotalCount(counter), 2);
+}
+
+TEST(AdaptingCircularBufferCounterTest, MergeFromWidensCells)
+{
+  const uint64_t deltas[] = {200, std::numeric_limits<uint8_t>::max() + 1ull,
+                             std::numeric_limits<uint16_t>::max() + 1ull,
+                             std::numeric_limits<uint32_t>::max() + 1ull};
+  for (uint64_t delta : deltas)
+  {
+    AdaptingCircularBufferCounter counter{4};
+    EXPECT_TRUE(counter.Increment(0, 1));
+    EXPECT_TRUE(counter.Increment(1, delta));
+    AdaptingCircularBufferCounter other{4};
+    EXPECT_TRUE(other.Increment(0, 2));
+    EXPECT_TRUE(other.Increment(1, delta));
+
+    EXPECT_TRUE(counter.MergeFrom(other));
+
+    EXPECT_EQ(counter.Get(0), 3);
+    EXPECT_EQ(counter.Get(1), 2 * delta);
+  }
+}
+
+TEST(AdaptingCircularBufferCounterTest, MergeFromMatchesReferenceImplementation)
+{
+  uint32_t state = 0x85ebca6bu;
+  auto next      = [&state](uint32_t bound) {
+    state = (state * 1664525u) + 1013904223u;
+    return (state >> 8) % bound;
+  };
+  auto fill = [&next](AdaptingCircularBufferCounter &counter, int32_t base) {
+    const uint64_t magnitudes[] = {1, 250, 65000, 4000000000ull};
+    const uint32_t max_size     = static_cast<uint32_t>(counter.MaxSize());
+    EXPECT_TRUE(counter.Increment(base, magnitudes[next(4)] + next(97)));
+    for (uint32_t i = 0; i < 2 * max_size; ++i)
+    {
+      counter.Increment(base + static_cast<int32_t>(next(max_size)) -
+                            static_cast<int32_t>(max_size / 2),
+                        magnitudes[next(4)] + next(97));
+    }
+  };
+
+  for (uint32_t trial = 0; trial < 1000; ++trial)
+  {
+    const std::size_t max_size = 2 + next(30);
+    const int32_t base         = static_cast<int32_t>(next(41)) - 20;
+    AdaptingCircularBufferCounter counter{max_size};
+    AdaptingCircularBufferCounter other{max_size};
+    fill(counter, base);
+    fill(other, base + static_cast<int32_t>(next(5)) - 2);
+
+    AdaptingCircularBufferCounter expected = counter;
+    bool fits                              = true;
+    for (int32_t index = other.StartIndex(); index <= other.EndIndex(); ++index)
+    {
+      if (other.Get(index) > 0 && !expected.Increment(index, other.Get(index)))
+      {
+        fits = false;
+      }
+    }
+    const int64_t union_size =
+        static_cast<int64_t>((std::max)(counter.EndIndex(), other.EndIndex())) -
+        (std::min)(counter.StartIndex(), other.StartIndex()) + 1;
+    if (union_size > static_cast<int64_t>(max_size))
+    {
+      EXPECT_FALSE(counter.MergeFrom(other)) << "trial " << trial;
+      continue;
+    }
+    ASSERT_TRUE(fits);
+    EXPECT_TRUE(counter.MergeFrom(other)) << "trial " << trial;
+    ExpectSameBuckets(expected, counter);
+  }
+}
+
 }  // namespace
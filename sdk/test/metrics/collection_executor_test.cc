@@ -0,0 +1,134 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "common.h"
+
+#include "opentelemetry/context/context.h"
+#include "opentelemetry/metrics/meter.h"
+#include "opentelemetry/metrics/sync_instruments.h"
+#include "opentelemetry/nostd/shared_ptr.h"
+#include "opentelemetry/nostd/unique_ptr.h"
+#include "opentelemetry/nostd/variant.h"
+#include "opentelemetry/sdk/metrics/data/metric_data.h"
+#include "opentelemetry/sdk/metrics/data/point_data.h"
+#include "opentelemetry/sdk/metrics/export/metric_producer.h"
+#include "opentelemetry/sdk/metrics/meter_provider.h"
+#include "opentelemetry/sdk/metrics/metric_reader.h"
+#include "opentelemetry/sdk/metrics/state/collection_executor.h"
+
+using namespace opentelemetry;
+using namespace opentelemetry::sdk::metrics;
+
+namespace
+{
+
+// Collect the name and sum of each metric, in the order of the collected data.
+std::vector<std::pair<std::string, int64_t>> CollectSums(MetricReader &reader)
+{
+  std::vector<std::pair<std::string, int64_t>> sums;
+  reader.Collect([&sums](ResourceMetrics &resource_metrics) {
+    for (const ScopeMetrics &scope_metrics : resource_metrics.scope_metric_data_)
+    {
+      for (const MetricData &metric_data : scope_metrics.metric_data_)
+      {
+        for (const PointDataAttributes &point : metric_data.point_data_attr_)
+        {
+          sums.emplace_back(metric_data.instrument_descriptor.name_,
+                            nostd::get<int64_t>(nostd::get<SumPointData>(point.point_data).value_));
+        }
+      }
+    }
+    return true;
+  });
+  return sums;
+}
+
+}  // namespace
+
+TEST(CollectionExecutor, ForEachRunsEveryTaskOnce)
+{
+  for (size_t parallelism : {size_t{1}, size_t{2}, size_t{4}})
+  {
+    CollectionExecutor executor(parallelism);
+    EXPECT_EQ(executor.GetParallelism(), parallelism);
+    for (size_t count : {size_t{0}, size_t{1}, size_t{3}, size_t{1000}})
+    {
+      std::vector<std::atomic<int>> calls(count);
+      for (auto &call : calls)
+      {
+        call.store(0);
+      }
+      executor.ForEach(count, [&calls](size_t i) { calls[i].fetch_add(1); });
+      for (size_t i = 0; i < count; i++)
+      {
+        EXPECT_EQ(calls[i].load(), 1) << "parallelism: " << parallelism << ", task: " << i;
+      }
+    }
+  }
+}
+
+TEST(CollectionExecutor, DefaultParallelism)
+{
+  CollectionExecutor executor;
+  EXPECT_GE(executor.GetParallelism(), size_t{1});
+}
+
+TEST(CollectionExecutor, NestedForEachRunsSequentially)
+{
+  CollectionExecutor executor(4);
+  std::atomic<size_t> inner_calls{0};
+  executor.ForEach(8, [&](size_t) {
+    executor.ForEach(8, [&](size_t) { inner_calls.fetch_add(1); });
+  });
+  EXPECT_EQ(inner_calls.load(), size_t{64});
+}
+
+// The metrics collected in parallel are the same, and in the same order, as the metrics collected
+// sequentially.
+TEST(CollectionExecutor, MeterProviderCollection)
+{
+  MeterProvider sequential_provider;
+  MeterProvider parallel_provider;
+  parallel_provider.SetCollectionExecutor(std::make_shared<CollectionExecutor>(4));
+
+  std::shared_ptr<MetricReader> sequential_reader(new MockMetricReader());
+  std::shared_ptr<MetricReader> parallel_reader(new MockMetricReader());
+  sequential_provider.AddMetricReader(sequential_reader);
+  parallel_provider.AddMetricReader(parallel_reader);
+
+  std::vector<nostd::unique_ptr<metrics::Counter<uint64_t>>> counters;
+  for (MeterProvider *provider : {&sequential_provider, &parallel_provider})
+  {
+    for (int m = 0; m < 3; m++)
+    {
+      auto meter = provider->GetMeter("meter" + std::to_string(m));
+      for (int i = 0; i < 100; i++)
+      {
+        counters.push_back(meter->CreateUInt64Counter("counter" + std::to_string(i)));
+        counters.back()->Add(static_cast<uint64_t>(m * 1000 + i));
+      }
+    }
+  }
+
+  auto sequential_sums = CollectSums(*sequential_reader);
+  auto parallel_sums   = CollectSums(*parallel_reader);
+  EXPECT_EQ(sequential_sums.size(), size_t{300});
+  EXPECT_EQ(parallel_sums, sequential_sums);
+
+  // The cumulative state of the storages is kept across parallel collections.
+  for (auto &counter : counters)
+  {
+    counter->Add(1);
+  }
+  sequential_sums = CollectSums(*sequential_reader);
+  parallel_sums   = CollectSums(*parallel_reader);
+  EXPECT_EQ(parallel_sums, sequential_sums);
+}
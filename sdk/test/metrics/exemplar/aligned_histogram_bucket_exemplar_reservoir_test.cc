@@ -55,7 +55,42 @@ TEST_F(AlignedHistogramBucketExemplarReservoirTestPeer, OfferMeasurementWithNonE
   histogram_exemplar_reservoir->OfferMeasurement(static_cast<int64_t>(1), MetricAttributes{},
                                                  opentelemetry::context::Context{});
   auto exemplar_data = histogram_exemplar_reservoir->CollectAndReset(MetricAttributes{});
-  ASSERT_TRUE(!exemplar_data.empty());
+  ASSERT_EQ(exemplar_data.size(), 1u);
+}
+
+// The exemplar data released by the exporter is reused by the next collection, and the data still
+// held by the exporter is left untouched.
+TEST_F(AlignedHistogramBucketExemplarReservoirTestPeer, ReusesReleasedExemplarData)
+{
+  std::vector<double> boundaries{1, 5.0, 10, 15, 20};
+  auto histogram_exemplar_reservoir = ExemplarReservoir::GetAlignedHistogramBucketExemplarReservoir(
+      boundaries.size(),
+      AlignedHistogramBucketExemplarReservoir::GetHistogramCellSelector(boundaries),
+      &ReservoirCell::GetAndResetDouble);
+  std::vector<std::shared_ptr<ExemplarData>> exemplars;
+
+  histogram_exemplar_reservoir->OfferMeasurement(1.0, MetricAttributes{},
+                                                 opentelemetry::context::Context{});
+  histogram_exemplar_reservoir->CollectAndReset(MetricAttributes{}, exemplars);
+  ASSERT_EQ(exemplars.size(), 1u);
+  const ExemplarData *released = exemplars[0].get();
+  exemplars.clear();
+
+  histogram_exemplar_reservoir->OfferMeasurement(0.5, MetricAttributes{},
+                                                 opentelemetry::context::Context{});
+  histogram_exemplar_reservoir->CollectAndReset(MetricAttributes{}, exemplars);
+  ASSERT_EQ(exemplars.size(), 1u);
+  EXPECT_EQ(exemplars[0].get(), released);
+
+  histogram_exemplar_reservoir->OfferMeasurement(0.25, MetricAttributes{},
+                                                 opentelemetry::context::Context{});
+  std::vector<std::shared_ptr<ExemplarData>> next_exemplars;
+  histogram_exemplar_reservoir->CollectAndReset(MetricAttributes{}, next_exemplars);
+  ASSERT_EQ(next_exemplars.size(), 1u);
+  EXPECT_NE(next_exemplars[0].get(), exemplars[0].get());
+
+  // Nothing was offered since the last collection.
+  EXPECT_TRUE(histogram_exemplar_reservoir->CollectAndReset(MetricAttributes{}).empty());
 }
 
 }  // namespace
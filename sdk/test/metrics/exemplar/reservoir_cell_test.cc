@@ -4,15 +4,21 @@
 #ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
 
 #  include <gtest/gtest.h>
+#  include <atomic>
+#  include <cstddef>
 #  include <cstdint>
 #  include <memory>
 #  include <string>
+#  include <thread>
 #  include <utility>
+#  include <vector>
 
 #  include "opentelemetry/common/timestamp.h"
 #  include "opentelemetry/context/context.h"
 #  include "opentelemetry/nostd/variant.h"
 #  include "opentelemetry/sdk/metrics/data/exemplar_data.h"
+#  include "opentelemetry/sdk/metrics/data/metric_data.h"
+#  include "opentelemetry/sdk/metrics/data/point_attributes.h"
 #  include "opentelemetry/sdk/metrics/exemplar/reservoir_cell.h"
 #  include "opentelemetry/trace/span_context.h"
 #  include "opentelemetry/version.h"
@@ -41,6 +47,18 @@ class ReservoirCellTestPeer : public ::testing::Test
     return reservoir_cell.record_time_;
   }
 
+  const PointAttributes &GetFilteredAttributes(
+      const opentelemetry::sdk::metrics::ReservoirCell &reservoir_cell)
+  {
+    return reservoir_cell.filtered_attributes_;
+  }
+
+  static ExemplarData EmptyExemplar()
+  {
+    return ExemplarData::Create(opentelemetry::trace::SpanContext::GetInvalid(),
+                                opentelemetry::common::SystemTimestamp{}, PointDataAttributes{});
+  }
+
   void FilteredTest()
   {
     MetricAttributes original{{"k1", "v1"}, {"k2", "v2"}, {"k3", "v3"}};
@@ -66,13 +84,12 @@ TEST_F(ReservoirCellTestPeer, recordMeasurement)
 TEST_F(ReservoirCellTestPeer, GetAndReset)
 {
   opentelemetry::sdk::metrics::ReservoirCell reservoir_cell;
-  auto double_data = reservoir_cell.GetAndResetDouble(MetricAttributes{});
+  ExemplarData exemplar = EmptyExemplar();
+  ASSERT_FALSE(reservoir_cell.GetAndResetDouble(MetricAttributes{}, exemplar));
   ASSERT_TRUE(GetRecordTime(reservoir_cell) == opentelemetry::common::SystemTimestamp{});
-  ASSERT_TRUE(double_data == nullptr);
 
-  auto long_data = reservoir_cell.GetAndResetLong(MetricAttributes{});
+  ASSERT_FALSE(reservoir_cell.GetAndResetLong(MetricAttributes{}, exemplar));
   ASSERT_TRUE(GetRecordTime(reservoir_cell) == opentelemetry::common::SystemTimestamp{});
-  ASSERT_TRUE(long_data == nullptr);
 }
 
 TEST_F(ReservoirCellTestPeer, ProducesExemplarWithoutSpanContext)
@@ -80,9 +97,10 @@ TEST_F(ReservoirCellTestPeer, ProducesExemplarWithoutSpanContext)
   opentelemetry::sdk::metrics::ReservoirCell reservoir_cell;
   reservoir_cell.RecordLongMeasurement(static_cast<int64_t>(42), MetricAttributes{},
                                        opentelemetry::context::Context{});
-  auto data = reservoir_cell.GetAndResetLong(MetricAttributes{});
-  ASSERT_NE(data, nullptr);
-  EXPECT_FALSE(data->GetSpanContext().IsValid());
+  ExemplarData exemplar = EmptyExemplar();
+  ASSERT_TRUE(reservoir_cell.GetAndResetLong(MetricAttributes{}, exemplar));
+  EXPECT_FALSE(exemplar.GetSpanContext().IsValid());
+  EXPECT_NE(exemplar.GetEpochNanos(), opentelemetry::common::SystemTimestamp{});
 }
 
 TEST_F(ReservoirCellTestPeer, GetAndResetClearsCell)
@@ -90,8 +108,76 @@ TEST_F(ReservoirCellTestPeer, GetAndResetClearsCell)
   opentelemetry::sdk::metrics::ReservoirCell reservoir_cell;
   reservoir_cell.RecordLongMeasurement(static_cast<int64_t>(42), MetricAttributes{},
                                        opentelemetry::context::Context{});
-  ASSERT_NE(reservoir_cell.GetAndResetLong(MetricAttributes{}), nullptr);
-  EXPECT_EQ(reservoir_cell.GetAndResetLong(MetricAttributes{}), nullptr);
+  ExemplarData exemplar = EmptyExemplar();
+  ASSERT_TRUE(reservoir_cell.GetAndResetLong(MetricAttributes{}, exemplar));
+  EXPECT_FALSE(reservoir_cell.GetAndResetLong(MetricAttributes{}, exemplar));
+}
+
+// Measurements are recorded concurrently with each other and with the collection of the cell.
+TEST_F(ReservoirCellTestPeer, ConcurrentRecordAndCollect)
+{
+  opentelemetry::sdk::metrics::ReservoirCell reservoir_cell;
+  std::atomic<bool> done{false};
+  std::vector<std::thread> writers;
+  for (int t = 0; t < 4; t++)
+  {
+    writers.emplace_back([&reservoir_cell, &done, t]() {
+      MetricAttributes attributes{{"thread", static_cast<int64_t>(t)}};
+      while (!done.load())
+      {
+        reservoir_cell.RecordLongMeasurement(static_cast<int64_t>(t), attributes,
+                                             opentelemetry::context::Context{});
+      }
+    });
+  }
+  ExemplarData exemplar = EmptyExemplar();
+  size_t collected      = 0;
+  for (int i = 0; collected < 100 && i < 1000000; i++)
+  {
+    if (reservoir_cell.GetAndResetLong(MetricAttributes{}, exemplar))
+    {
+      collected++;
+    }
+    std::this_thread::yield();
+  }
+  done.store(true);
+  for (auto &writer : writers)
+  {
+    writer.join();
+  }
+  EXPECT_EQ(collected, size_t{100});
+}
+
+// The filtered attributes are only built again when the offered or the point attributes change.
+TEST_F(ReservoirCellTestPeer, ReusesFilteredAttributes)
+{
+  opentelemetry::sdk::metrics::ReservoirCell reservoir_cell;
+  MetricAttributes attributes{{"k1", "v1"}, {"k2", "v2"}};
+  MetricAttributes point_attributes{{"k2", "v2"}};
+  ExemplarData exemplar = EmptyExemplar();
+
+  reservoir_cell.RecordLongMeasurement(static_cast<int64_t>(1), attributes,
+                                       opentelemetry::context::Context{});
+  ASSERT_TRUE(reservoir_cell.GetAndResetLong(point_attributes, exemplar));
+  const auto *first = &GetFilteredAttributes(reservoir_cell).GetAttributes();
+  EXPECT_EQ(GetFilteredAttributes(reservoir_cell), (PointAttributes{{"k1", "v1"}}));
+
+  reservoir_cell.RecordLongMeasurement(static_cast<int64_t>(2), attributes,
+                                       opentelemetry::context::Context{});
+  ASSERT_TRUE(reservoir_cell.GetAndResetLong(point_attributes, exemplar));
+  EXPECT_EQ(first, &GetFilteredAttributes(reservoir_cell).GetAttributes());
+
+  reservoir_cell.RecordLongMeasurement(static_cast<int64_t>(3),
+                                       MetricAttributes{{"k1", "v3"}, {"k2", "v2"}},
+                                       opentelemetry::context::Context{});
+  ASSERT_TRUE(reservoir_cell.GetAndResetLong(point_attributes, exemplar));
+  EXPECT_EQ(GetFilteredAttributes(reservoir_cell), (PointAttributes{{"k1", "v3"}}));
+
+  reservoir_cell.RecordLongMeasurement(static_cast<int64_t>(4),
+                                       MetricAttributes{{"k1", "v3"}, {"k2", "v2"}},
+                                       opentelemetry::context::Context{});
+  ASSERT_TRUE(reservoir_cell.GetAndResetLong(MetricAttributes{{"k1", "v3"}}, exemplar));
+  EXPECT_EQ(GetFilteredAttributes(reservoir_cell), (PointAttributes{{"k2", "v2"}}));
 }
 
 TEST_F(ReservoirCellTestPeer, Filtered)
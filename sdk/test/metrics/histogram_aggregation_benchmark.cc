@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <functional>
 #include <initializer_list>  // IWYU pragma: keep
+#include <memory>
 #include <random>
 #include <string>
 #include <thread>
@@ -19,12 +20,16 @@
 #include "opentelemetry/metrics/meter.h"
 #include "opentelemetry/metrics/sync_instruments.h"
 #include "opentelemetry/nostd/shared_ptr.h"
+#include "opentelemetry/nostd/span.h"
 #include "opentelemetry/nostd/string_view.h"
 #include "opentelemetry/nostd/unique_ptr.h"
 #include "opentelemetry/nostd/variant.h"
 #include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
+#include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
 #include "opentelemetry/sdk/metrics/aggregation/aggregation_config.h"
 #include "opentelemetry/sdk/metrics/aggregation/base2_exponential_histogram_aggregation.h"
+#include "opentelemetry/sdk/metrics/aggregation/histogram_aggregation.h"
+#include "opentelemetry/sdk/metrics/aggregation/histogram_bucket_indexer.h"
 #include "opentelemetry/sdk/metrics/data/metric_data.h"
 #include "opentelemetry/sdk/metrics/data/point_data.h"
 #include "opentelemetry/sdk/metrics/export/metric_producer.h"
@@ -112,7 +117,7 @@ std::unique_ptr<ViewRegistry> MakeBase2ExponentialViewRegistry(int32_t max_scale
 {
   std::string instrument_unit = "histogram1_unit";
   std::unique_ptr<InstrumentSelector> histogram_instrument_selector{
-      new InstrumentSelector(InstrumentType::kHistogram, ".*", instrument_unit)};
+      new InstrumentSelector(InstrumentType::kHistogram, "*", instrument_unit)};
   std::unique_ptr<MeterSelector> histogram_meter_selector{
       new MeterSelector("meter1", "version1", "schema1")};
 
@@ -171,6 +176,173 @@ void BM_Base2ExponentialHistogramAggregationSixteenScale(benchmark::State &state
 }
 BENCHMARK(BM_Base2ExponentialHistogramAggregationSixteenScale);
 
+// ---------------------------------------------------------------------------
+// Bucket search of the explicit bucket histogram, with the default boundaries
+// (0 below) and with custom boundaries either side of the linear search
+// threshold of HistogramBucketIndexer.
+// ---------------------------------------------------------------------------
+
+constexpr size_t kExplicitMeasurementCount = 4096;
+
+std::vector<double> MakeExplicitBoundaries(size_t count)
+{
+  if (count == 0)
+  {
+    return HistogramAggregationConfig::DefaultBoundaries();
+  }
+  std::vector<double> boundaries;
+  boundaries.reserve(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    boundaries.push_back(static_cast<double>(i + 1) * 10.0);
+  }
+  return boundaries;
+}
+
+// Values spread evenly, in a non-monotonic order, over the whole range of the
+// boundaries plus one bucket width on each side, so that every bucket is hit
+// and the branches of a binary search cannot be predicted.
+std::vector<double> MakeExplicitMeasurements(const std::vector<double> &boundaries)
+{
+  constexpr double kGoldenRatioConjugate = 0.6180339887498949;
+  const double width = boundaries.back() / static_cast<double>(boundaries.size());
+  const double low   = boundaries.front() - width;
+  const double range = boundaries.back() + width - low;
+
+  std::vector<double> measurements;
+  measurements.reserve(kExplicitMeasurementCount);
+  for (size_t i = 0; i < kExplicitMeasurementCount; ++i)
+  {
+    const double position = static_cast<double>(i + 1) * kGoldenRatioConjugate;
+    measurements.push_back(low + range * (position - std::floor(position)));
+  }
+  return measurements;
+}
+
+void BM_ExplicitBucketBinarySearch(benchmark::State &state)
+{
+  const std::vector<double> boundaries =
+      MakeExplicitBoundaries(static_cast<size_t>(state.range(0)));
+  const std::vector<double> measurements = MakeExplicitMeasurements(boundaries);
+
+  for (auto _ : state)
+  {
+    for (double value : measurements)
+    {
+      benchmark::DoNotOptimize(BucketBinarySearch(value, boundaries));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(measurements.size()));
+}
+BENCHMARK(BM_ExplicitBucketBinarySearch)->Arg(0)->Arg(30)->Arg(500);
+
+void BM_ExplicitBucketIndexer(benchmark::State &state)
+{
+  const std::vector<double> boundaries =
+      MakeExplicitBoundaries(static_cast<size_t>(state.range(0)));
+  const std::vector<double> measurements = MakeExplicitMeasurements(boundaries);
+  const HistogramBucketIndexer indexer{boundaries};
+
+  for (auto _ : state)
+  {
+    for (double value : measurements)
+    {
+      benchmark::DoNotOptimize(indexer.ComputeIndex(value));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(measurements.size()));
+}
+BENCHMARK(BM_ExplicitBucketIndexer)->Arg(0)->Arg(30)->Arg(500);
+
+// The same measurements recorded by the aggregation, which adds the lock and
+// the sum, count, min and max updates to the bucket search.
+void BM_ExplicitHistogramAggregate(benchmark::State &state)
+{
+  HistogramAggregationConfig config;
+  config.boundaries_ = MakeExplicitBoundaries(static_cast<size_t>(state.range(0)));
+  const std::vector<double> measurements = MakeExplicitMeasurements(config.boundaries_);
+  const PointAttributes attributes;
+  DoubleHistogramAggregation aggregation(&config);
+
+  for (auto _ : state)
+  {
+    for (double value : measurements)
+    {
+      aggregation.Aggregate(value, attributes);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(measurements.size()));
+}
+BENCHMARK(BM_ExplicitHistogramAggregate)->Arg(0)->Arg(30)->Arg(500);
+
+// The same measurements recorded with compact bucket counts, which trade the
+// cost of the variable width counts for the memory of the 64-bit counts.
+void BM_ExplicitHistogramAggregateCompact(benchmark::State &state)
+{
+  HistogramAggregationConfig config;
+  config.boundaries_     = MakeExplicitBoundaries(static_cast<size_t>(state.range(0)));
+  config.compact_counts_ = true;
+  const std::vector<double> measurements = MakeExplicitMeasurements(config.boundaries_);
+  const PointAttributes attributes;
+  DoubleHistogramAggregation aggregation(&config);
+
+  for (auto _ : state)
+  {
+    for (double value : measurements)
+    {
+      aggregation.Aggregate(value, attributes);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(measurements.size()));
+}
+BENCHMARK(BM_ExplicitHistogramAggregateCompact)->Arg(0)->Arg(30)->Arg(500);
+
+// The same measurements recorded as a single batch, which takes the lock once
+// and updates the sum, count, min and max outside of the bucket search loop.
+void BM_ExplicitHistogramAggregateBatch(benchmark::State &state)
+{
+  HistogramAggregationConfig config;
+  config.boundaries_ = MakeExplicitBoundaries(static_cast<size_t>(state.range(0)));
+  const std::vector<double> measurements = MakeExplicitMeasurements(config.boundaries_);
+  DoubleHistogramAggregation aggregation(&config);
+
+  for (auto _ : state)
+  {
+    aggregation.AggregateBatch(
+        opentelemetry::nostd::span<const double>{measurements.data(), measurements.size()});
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(measurements.size()));
+}
+BENCHMARK(BM_ExplicitHistogramAggregateBatch)->Arg(0)->Arg(30)->Arg(500);
+
+// Measurements recorded concurrently by all the threads to the same
+// aggregation, i.e. to the same attribute set of a histogram, either in the
+// shared bucket counts or with one thread cell per thread.
+std::unique_ptr<Aggregation> contended_histogram;
+
+void BM_ExplicitHistogramAggregateContended(benchmark::State &state)
+{
+  const std::vector<double> &boundaries  = HistogramAggregationConfig::DefaultBoundaries();
+  const std::vector<double> measurements = MakeExplicitMeasurements(boundaries);
+  if (state.thread_index() == 0)
+  {
+    HistogramAggregationConfig config;
+    config.boundaries_        = boundaries;
+    config.thread_cell_count_ = static_cast<size_t>(state.range(0));
+    contended_histogram.reset(new DoubleHistogramAggregation(&config));
+  }
+  const PointAttributes attributes;
+  size_t index = static_cast<size_t>(state.thread_index()) * 64;
+
+  for (auto _ : state)
+  {
+    contended_histogram->Aggregate(measurements[index % measurements.size()], attributes);
+    ++index;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ExplicitHistogramAggregateContended)->Arg(0)->Arg(8)->ThreadRange(1, 8)->UseRealTime();
+
 // ---------------------------------------------------------------------------
 // Multi-threaded aggregation throughput for the base2 exponential histogram.
 // See https://github.com/open-telemetry/opentelemetry-cpp/issues/3366.
@@ -290,6 +462,23 @@ void BM_Base2ExponentialHistogramAggregate(benchmark::State &state)
 }
 BENCHMARK(BM_Base2ExponentialHistogramAggregate)->Arg(160)->ThreadRange(1, 8);
 
+// Batch counterpart of the benchmark above, on a single thread.
+void BM_Base2ExponentialHistogramAggregateBatch(benchmark::State &state)
+{
+  const Base2ExponentialHistogramAggregationConfig config =
+      MakeBase2Config(static_cast<size_t>(state.range(0)), kBase2MaxScale);
+  const std::vector<double> &measurements = WideRangeMeasurements();
+  Base2ExponentialHistogramAggregation aggregation(&config);
+
+  for (auto _ : state)
+  {
+    aggregation.AggregateBatch(
+        opentelemetry::nostd::span<const double>{measurements.data(), measurements.size()});
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(measurements.size()));
+}
+BENCHMARK(BM_Base2ExponentialHistogramAggregateBatch)->Arg(160);
+
 // Downscaling-dominated counterpart of the benchmark above: every iteration
 // folds a completely full bucket buffer twice. This is the workload that shows
 // the cost of the buffer that DownscaleBuckets() allocates per downscale, and
@@ -380,5 +569,26 @@ BENCHMARK_DEFINE_F(SharedBase2InstrumentFixture, Record)(benchmark::State &state
 }
 BENCHMARK_REGISTER_F(SharedBase2InstrumentFixture, Record)->ThreadRange(1, 8);
 
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+// Same as Record, with the measurements recorded in batches of 64 values, so
+// that the attributes are resolved and the storage entry is locked once per
+// batch.
+BENCHMARK_DEFINE_F(SharedBase2InstrumentFixture, RecordBatch)(benchmark::State &state)
+{
+  constexpr size_t kBatchSize             = 64;
+  const std::vector<double> &measurements = WideRangeMeasurements();
+  size_t index = (static_cast<size_t>(state.thread_index()) * kBatchSize) % measurements.size();
+
+  for (auto _ : state)
+  {
+    histogram_->RecordBatch(
+        opentelemetry::nostd::span<const double>{measurements.data() + index, kBatchSize}, {});
+    index = (index + kBatchSize) % measurements.size();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatchSize));
+}
+BENCHMARK_REGISTER_F(SharedBase2InstrumentFixture, RecordBatch)->ThreadRange(1, 8);
+#endif
+
 }  // namespace
 BENCHMARK_MAIN();
@@ -0,0 +1,116 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "opentelemetry/sdk/metrics/aggregation/aggregation_config.h"
+#include "opentelemetry/sdk/metrics/aggregation/histogram_aggregation.h"
+#include "opentelemetry/sdk/metrics/aggregation/histogram_bucket_indexer.h"
+
+using namespace opentelemetry::sdk::metrics;
+
+namespace
+{
+
+std::vector<double> MakeBoundaries(size_t count)
+{
+  std::vector<double> boundaries;
+  for (size_t i = 0; i < count; ++i)
+  {
+    boundaries.push_back(static_cast<double>(i) * 10.0 - 50.0);
+  }
+  return boundaries;
+}
+
+// Every boundary, a value between each pair of boundaries, and values beyond both ends.
+std::vector<double> MakeValues(const std::vector<double> &boundaries)
+{
+  std::vector<double> values = {-std::numeric_limits<double>::infinity(),
+                                std::numeric_limits<double>::lowest(),
+                                (std::numeric_limits<double>::max)(),
+                                std::numeric_limits<double>::infinity(), 0.0, -0.0};
+  for (double boundary : boundaries)
+  {
+    values.push_back(boundary);
+    values.push_back(boundary - 0.5);
+    values.push_back(boundary + 0.5);
+  }
+  return values;
+}
+
+}  // namespace
+
+TEST(HistogramBucketIndexerTest, DefaultBoundaries)
+{
+  const HistogramBucketIndexer indexer{HistogramAggregationConfig::DefaultBoundaries()};
+
+  EXPECT_EQ(indexer.ComputeIndex(-1.0), 0);
+  EXPECT_EQ(indexer.ComputeIndex(0.0), 0);
+  EXPECT_EQ(indexer.ComputeIndex(0.5), 1);
+  EXPECT_EQ(indexer.ComputeIndex(5.0), 1);
+  EXPECT_EQ(indexer.ComputeIndex(5.5), 2);
+  EXPECT_EQ(indexer.ComputeIndex(500.0), 8);
+  EXPECT_EQ(indexer.ComputeIndex(9999.0), 14);
+  EXPECT_EQ(indexer.ComputeIndex(10000.0), 14);
+  EXPECT_EQ(indexer.ComputeIndex(10000.5), 15);
+  EXPECT_EQ(indexer.ComputeIndex(std::numeric_limits<double>::infinity()), 15);
+}
+
+TEST(HistogramBucketIndexerTest, NoBoundaries)
+{
+  const HistogramBucketIndexer indexer{std::vector<double>{}};
+
+  EXPECT_EQ(indexer.ComputeIndex(-1.0), 0);
+  EXPECT_EQ(indexer.ComputeIndex(1.0), 0);
+  EXPECT_EQ(indexer.ComputeIndex(std::numeric_limits<double>::quiet_NaN()), 0);
+}
+
+TEST(HistogramBucketIndexerTest, NaN)
+{
+  for (size_t count : {size_t{1}, size_t{15}, size_t{100}})
+  {
+    const HistogramBucketIndexer indexer{MakeBoundaries(count)};
+    EXPECT_EQ(indexer.ComputeIndex(std::numeric_limits<double>::quiet_NaN()), 0);
+  }
+}
+
+// The linear and the Eytzinger searches must both find the same bucket as the binary search, on
+// either side of kMaxLinearSearchBoundaries and for every shape of the Eytzinger tree.
+TEST(HistogramBucketIndexerTest, MatchesBinarySearch)
+{
+  for (size_t count = 0; count <= 2 * HistogramBucketIndexer::kMaxLinearSearchBoundaries + 3;
+       ++count)
+  {
+    const std::vector<double> boundaries = MakeBoundaries(count);
+    const HistogramBucketIndexer indexer{boundaries};
+    for (double value : MakeValues(boundaries))
+    {
+      EXPECT_EQ(indexer.ComputeIndex(value), BucketBinarySearch(value, boundaries))
+          << "boundaries: " << count << ", value: " << value;
+    }
+  }
+
+  const std::vector<double> boundaries = MakeBoundaries(1000);
+  const HistogramBucketIndexer indexer{boundaries};
+  for (double value : MakeValues(boundaries))
+  {
+    EXPECT_EQ(indexer.ComputeIndex(value), BucketBinarySearch(value, boundaries))
+        << "value: " << value;
+  }
+}
+
+TEST(HistogramBucketIndexerTest, CopiedIndexer)
+{
+  const std::vector<double> boundaries = MakeBoundaries(100);
+  HistogramBucketIndexer indexer{boundaries};
+  const HistogramBucketIndexer copy = indexer;
+  indexer                           = HistogramBucketIndexer{};
+
+  EXPECT_EQ(copy.ComputeIndex(-1000.0), 0);
+  EXPECT_EQ(copy.ComputeIndex(0.0), 5);
+  EXPECT_EQ(copy.ComputeIndex(1000.0), 100);
+  EXPECT_EQ(indexer.ComputeIndex(1000.0), 0);
+}
@@ -2,8 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <gtest/gtest.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #include "common.h"
@@ -15,13 +20,19 @@
 #include "opentelemetry/common/macros.h"
 #include "opentelemetry/metrics/meter.h"
 #include "opentelemetry/nostd/string_view.h"
+#include "opentelemetry/nostd/variant.h"
 #include "opentelemetry/sdk/common/global_log_handler.h"
+#include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
+#include "opentelemetry/sdk/metrics/data/metric_data.h"
+#include "opentelemetry/sdk/metrics/data/point_data.h"
+#include "opentelemetry/sdk/metrics/export/metric_producer.h"
 #include "opentelemetry/sdk/metrics/instruments.h"
 #include "opentelemetry/sdk/metrics/meter.h"
 #include "opentelemetry/sdk/metrics/meter_provider.h"
 #include "opentelemetry/sdk/metrics/meter_provider_factory.h"
 #include "opentelemetry/sdk/metrics/metric_reader.h"
 #include "opentelemetry/sdk/metrics/push_metric_exporter.h"
+#include "opentelemetry/sdk/metrics/self_observability.h"
 #include "opentelemetry/sdk/metrics/view/instrument_selector.h"
 #include "opentelemetry/sdk/metrics/view/meter_selector.h"
 #include "opentelemetry/sdk/metrics/view/view.h"
@@ -520,3 +531,121 @@ TEST(MeterProvider, ExplicitShutdownNotWarnOnDestructionCheck)
   logs     = log_handler.Drain();
   EXPECT_TRUE(logs.empty());
 }
+
+TEST(MeterProvider, SelfObservability)
+{
+  MeterProvider mp;
+  std::shared_ptr<MetricReader> reader{new MockMetricReader()};
+  mp.AddMetricReader(reader);
+  mp.EnableSelfObservability();
+  // Enabling the self-observability again has no effect.
+  mp.EnableSelfObservability();
+
+  auto meter   = mp.GetMeter("test");
+  auto counter = meter->CreateUInt64Counter("requests");
+  counter->Add(1, {{"key", "a"}});
+  counter->Add(1, {{"key", "b"}});
+
+  // The self-observability metrics are observed before the storages of the test meter are
+  // collected: they reflect the first collection in the second one.
+  reader->Collect([](ResourceMetrics &) { return true; });
+
+  std::map<std::string, int64_t> counter_values;
+  size_t self_scopes = 0;
+  reader->Collect([&](ResourceMetrics &metric_data) {
+    for (const auto &scope_metrics : metric_data.scope_metric_data_)
+    {
+      if (scope_metrics.scope_->GetName() != kSelfObservabilityMeterName)
+      {
+        continue;
+      }
+      self_scopes++;
+      for (const auto &metric : scope_metrics.metric_data_)
+      {
+        for (const auto &point : metric.point_data_attr_)
+        {
+          auto name = point.attributes.find("otel.metric.name");
+          if (name != point.attributes.end() &&
+              opentelemetry::nostd::get<std::string>(name->second) != "requests")
+          {
+            continue;
+          }
+          if (opentelemetry::nostd::holds_alternative<LastValuePointData>(point.point_data))
+          {
+            const auto &value =
+                opentelemetry::nostd::get<LastValuePointData>(point.point_data).value_;
+            if (opentelemetry::nostd::holds_alternative<int64_t>(value))
+            {
+              counter_values[metric.instrument_descriptor.name_] =
+                  opentelemetry::nostd::get<int64_t>(value);
+            }
+          }
+          else if (opentelemetry::nostd::holds_alternative<SumPointData>(point.point_data))
+          {
+            const auto &value = opentelemetry::nostd::get<SumPointData>(point.point_data).value_;
+            if (opentelemetry::nostd::holds_alternative<int64_t>(value))
+            {
+              counter_values[metric.instrument_descriptor.name_] =
+                  opentelemetry::nostd::get<int64_t>(value);
+            }
+          }
+        }
+      }
+    }
+    return true;
+  });
+
+  EXPECT_EQ(self_scopes, 1);
+  EXPECT_EQ(counter_values["otel.sdk.metric.storage.series"], 2);
+  EXPECT_EQ(counter_values["otel.sdk.metric.storage.overflow"], 0);
+  EXPECT_GT(counter_values["otel.sdk.metric.storage.memory"], 0);
+  EXPECT_EQ(counter_values["otel.sdk.metric_reader.collection.count"], 1);
+  // The mock reader does not export.
+  EXPECT_EQ(counter_values["otel.sdk.metric_reader.export.count"], 0);
+}
+
+TEST(MeterProvider, SelfObservabilityWithConcurrentMeters)
+{
+  // The self-observability callbacks iterate a snapshot of the meters, while meters are added.
+  MeterProvider mp;
+  std::shared_ptr<MetricReader> reader{new MockMetricReader()};
+  mp.AddMetricReader(reader);
+  mp.EnableSelfObservability();
+
+  std::atomic<bool> done{false};
+  std::thread creator([&mp, &done]() {
+    for (int i = 0; i < 100; i++)
+    {
+      mp.GetMeter("meter" + std::to_string(i))->CreateUInt64Counter("requests")->Add(1);
+    }
+    done.store(true);
+  });
+  size_t collections = 0;
+  while (!done.load() || collections < 2)
+  {
+    reader->Collect([](ResourceMetrics &) { return true; });
+    collections++;
+  }
+  creator.join();
+
+  size_t meter_series = 0;
+  reader->Collect([&](ResourceMetrics &metric_data) {
+    for (const auto &scope_metrics : metric_data.scope_metric_data_)
+    {
+      if (scope_metrics.scope_->GetName() != kSelfObservabilityMeterName)
+      {
+        continue;
+      }
+      for (const auto &metric : scope_metrics.metric_data_)
+      {
+        if (metric.instrument_descriptor.name_ == "otel.sdk.metric.storage.series")
+        {
+          meter_series += metric.point_data_attr_.size();
+        }
+      }
+    }
+    return true;
+  });
+  // One series per storage of the 100 meters, and of the self-observability meter.
+  EXPECT_GE(meter_series, 100u);
+}
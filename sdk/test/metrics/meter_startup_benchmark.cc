@@ -0,0 +1,131 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "opentelemetry/metrics/meter.h"
+#include "opentelemetry/metrics/sync_instruments.h"
+#include "opentelemetry/nostd/shared_ptr.h"
+#include "opentelemetry/nostd/unique_ptr.h"
+#include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
+#include "opentelemetry/sdk/metrics/instrument_metadata_validator.h"
+#include "opentelemetry/sdk/metrics/instruments.h"
+#include "opentelemetry/sdk/metrics/meter_provider.h"
+#include "opentelemetry/sdk/metrics/view/instrument_selector.h"
+#include "opentelemetry/sdk/metrics/view/meter_selector.h"
+#include "opentelemetry/sdk/metrics/view/view.h"
+#include "opentelemetry/sdk/metrics/view/view_registry.h"
+
+using namespace opentelemetry;
+using namespace opentelemetry::sdk::instrumentationscope;
+using namespace opentelemetry::sdk::metrics;
+
+namespace
+{
+
+constexpr size_t kMeterCount           = 10;
+constexpr size_t kInstrumentsPerMeter  = 100;
+constexpr size_t kWildcardViewFraction = 10;
+
+std::string InstrumentName(size_t meter, size_t instrument)
+{
+  return "meter" + std::to_string(meter) + ".instrument" + std::to_string(instrument);
+}
+
+// Register view_count views: most of them select an instrument by its exact name, and one in
+// kWildcardViewFraction selects instruments with a wildcard pattern.
+template <class AddView>
+void AddViews(size_t view_count, AddView add_view)
+{
+  for (size_t i = 0; i < view_count; i++)
+  {
+    std::string name = i % kWildcardViewFraction == 0
+                           ? "meter" + std::to_string(i % kMeterCount) + ".instrument" +
+                                 std::to_string(i % kInstrumentsPerMeter) + "*"
+                           : InstrumentName(i % kMeterCount, i % kInstrumentsPerMeter);
+    add_view(std::unique_ptr<InstrumentSelector>(
+                 new InstrumentSelector(InstrumentType::kCounter, name, "")),
+             std::unique_ptr<MeterSelector>(new MeterSelector("", "", "")),
+             std::unique_ptr<View>(new View("view" + std::to_string(i))));
+  }
+}
+
+void BM_ViewRegistryFindViews(benchmark::State &state)
+{
+  ViewRegistry registry;
+  AddViews(static_cast<size_t>(state.range(0)),
+           [&registry](std::unique_ptr<InstrumentSelector> instrument_selector,
+                       std::unique_ptr<MeterSelector> meter_selector, std::unique_ptr<View> view) {
+             registry.AddView(std::move(instrument_selector), std::move(meter_selector),
+                              std::move(view));
+           });
+  auto scope = InstrumentationScope::Create("meter0");
+  std::vector<InstrumentDescriptor> descriptors;
+  for (size_t i = 0; i < kInstrumentsPerMeter; i++)
+  {
+    descriptors.push_back({InstrumentName(0, i), "", "", InstrumentType::kCounter,
+                           InstrumentValueType::kLong});
+  }
+
+  size_t i = 0;
+  for (auto _ : state)
+  {
+    size_t views = 0;
+    registry.FindViews(descriptors[i++ % descriptors.size()], *scope, [&views](const View &) {
+      views++;
+      return true;
+    });
+    benchmark::DoNotOptimize(views);
+  }
+}
+BENCHMARK(BM_ViewRegistryFindViews)->Arg(10)->Arg(100)->Arg(1000);
+
+void BM_InstrumentMetadataValidation(benchmark::State &state)
+{
+  InstrumentMetaDataValidator validator;
+  const std::string name = InstrumentName(kMeterCount, kInstrumentsPerMeter);
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(validator.ValidateName(name));
+    benchmark::DoNotOptimize(validator.ValidateUnit("ms"));
+  }
+}
+BENCHMARK(BM_InstrumentMetadataValidation);
+
+// Create a meter provider with the given number of views, then kMeterCount meters with
+// kInstrumentsPerMeter counters each.
+void BM_MeterStartup(benchmark::State &state)
+{
+  const size_t view_count = static_cast<size_t>(state.range(0));
+  for (auto _ : state)
+  {
+    MeterProvider provider;
+    AddViews(view_count, [&provider](std::unique_ptr<InstrumentSelector> instrument_selector,
+                                     std::unique_ptr<MeterSelector> meter_selector,
+                                     std::unique_ptr<View> view) {
+      provider.AddView(std::move(instrument_selector), std::move(meter_selector), std::move(view));
+    });
+    std::vector<nostd::unique_ptr<opentelemetry::metrics::Counter<uint64_t>>> counters;
+    counters.reserve(kMeterCount * kInstrumentsPerMeter);
+    for (size_t m = 0; m < kMeterCount; m++)
+    {
+      auto meter = provider.GetMeter("meter" + std::to_string(m));
+      for (size_t i = 0; i < kInstrumentsPerMeter; i++)
+      {
+        counters.push_back(meter->CreateUInt64Counter(InstrumentName(m, i)));
+      }
+    }
+    benchmark::DoNotOptimize(counters.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kMeterCount * kInstrumentsPerMeter);
+}
+BENCHMARK(BM_MeterStartup)->Arg(0)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+
+BENCHMARK_MAIN();
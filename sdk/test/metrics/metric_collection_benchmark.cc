@@ -0,0 +1,91 @@
+// Copyright The OpenTelemetry Authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "common.h"
+
+#include "opentelemetry/metrics/meter.h"
+#include "opentelemetry/metrics/sync_instruments.h"
+#include "opentelemetry/nostd/shared_ptr.h"
+#include "opentelemetry/nostd/unique_ptr.h"
+#include "opentelemetry/sdk/metrics/data/metric_data.h"
+#include "opentelemetry/sdk/metrics/export/metric_producer.h"
+#include "opentelemetry/sdk/metrics/meter_provider.h"
+#include "opentelemetry/sdk/metrics/metric_reader.h"
+#include "opentelemetry/sdk/metrics/state/collection_executor.h"
+
+using namespace opentelemetry;
+using namespace opentelemetry::sdk::metrics;
+
+namespace
+{
+
+constexpr int kMeterCount              = 10;
+constexpr int kInstrumentsPerMeter     = 1000;
+constexpr int kAttributeSetsPerCounter = 4;
+
+// Collection of a synthetic registry of 10k counters spread over 10 meters, each recorded to with
+// a few attribute sets, with state.range(0) collecting threads. 0 collects without an executor.
+void BM_CollectInstruments(benchmark::State &state)
+{
+  MeterProvider provider;
+  if (state.range(0) > 0)
+  {
+    provider.SetCollectionExecutor(
+        std::make_shared<CollectionExecutor>(static_cast<size_t>(state.range(0))));
+  }
+  std::shared_ptr<MetricReader> reader(new MockMetricReader());
+  provider.AddMetricReader(reader);
+
+  std::vector<nostd::unique_ptr<metrics::Counter<uint64_t>>> counters;
+  for (int m = 0; m < kMeterCount; m++)
+  {
+    auto meter = provider.GetMeter("meter" + std::to_string(m));
+    for (int i = 0; i < kInstrumentsPerMeter; i++)
+    {
+      counters.push_back(meter->CreateUInt64Counter("counter" + std::to_string(i)));
+    }
+  }
+
+  size_t points = 0;
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    for (auto &counter : counters)
+    {
+      for (int a = 0; a < kAttributeSetsPerCounter; a++)
+      {
+        counter->Add(1, {{"attribute", a}});
+      }
+    }
+    state.ResumeTiming();
+    reader->Collect([&points](ResourceMetrics &resource_metrics) {
+      for (const ScopeMetrics &scope_metrics : resource_metrics.scope_metric_data_)
+      {
+        for (const MetricData &metric_data : scope_metrics.metric_data_)
+        {
+          points += metric_data.point_data_attr_.size();
+        }
+      }
+      return true;
+    });
+  }
+  benchmark::DoNotOptimize(points);
+}
+
+BENCHMARK(BM_CollectInstruments)
+    ->Arg(0)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
+
+BENCHMARK_MAIN();
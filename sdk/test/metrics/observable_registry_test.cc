@@ -2,10 +2,36 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "common.h"
 
+#include "opentelemetry/metrics/async_instruments.h"
+#include "opentelemetry/metrics/meter.h"
+#include "opentelemetry/metrics/observer_result.h"
+#include "opentelemetry/nostd/shared_ptr.h"
+#include "opentelemetry/nostd/variant.h"
+#include "opentelemetry/sdk/metrics/async_instruments.h"
+#include "opentelemetry/sdk/metrics/data/metric_data.h"
+#include "opentelemetry/sdk/metrics/data/point_data.h"
+#include "opentelemetry/sdk/metrics/export/metric_producer.h"
+#include "opentelemetry/sdk/metrics/instruments.h"
+#include "opentelemetry/sdk/metrics/meter_provider.h"
+#include "opentelemetry/sdk/metrics/metric_reader.h"
+#include "opentelemetry/sdk/metrics/state/attributes_hashmap.h"
+#include "opentelemetry/sdk/metrics/state/metric_storage.h"
+#include "opentelemetry/sdk/metrics/state/observable_callback_executor.h"
 #include "opentelemetry/sdk/metrics/state/observable_registry.h"
 
+using namespace opentelemetry;
 using namespace opentelemetry::sdk::metrics;
 
 #if 0
@@ -73,3 +99,203 @@ TEST(ObservableRegistry, BasicTests)
   ObservableRegistry registry;
   EXPECT_EQ(1, 1);
 }
+
+namespace
+{
+
+// Collect the sum of each metric by name.
+std::map<std::string, int64_t> CollectSums(MetricReader &reader)
+{
+  std::map<std::string, int64_t> sums;
+  reader.Collect([&sums](ResourceMetrics &resource_metrics) {
+    for (const ScopeMetrics &scope_metrics : resource_metrics.scope_metric_data_)
+    {
+      for (const MetricData &metric_data : scope_metrics.metric_data_)
+      {
+        for (const PointDataAttributes &point : metric_data.point_data_attr_)
+        {
+          sums[metric_data.instrument_descriptor.name_] =
+              nostd::get<int64_t>(nostd::get<SumPointData>(point.point_data).value_);
+        }
+      }
+    }
+    return true;
+  });
+  return sums;
+}
+
+struct CallbackState
+{
+  int64_t value = 0;
+  // Set to block the callback until it is cleared.
+  std::atomic<bool> blocked{false};
+  std::atomic<size_t> calls{0};
+  std::atomic<size_t> returns{0};
+};
+
+void ObserveState(metrics::ObserverResult observer_result, void *state)
+{
+  auto *callback_state = static_cast<CallbackState *>(state);
+  callback_state->calls++;
+  // Bounded, so that a failing test does not hang.
+  for (int i = 0; callback_state->blocked && i < 10000; i++)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  nostd::get<nostd::shared_ptr<metrics::ObserverResultT<int64_t>>>(observer_result)
+      ->Observe(callback_state->value);
+  callback_state->returns++;
+}
+
+// Count the measurements stored into the storage of an instrument.
+class CountingAsyncStorage : public AsyncWritableMetricStorage
+{
+public:
+  void RecordLong(
+      const std::unordered_map<MetricAttributes, int64_t, AttributeHashGenerator> &measurements,
+      opentelemetry::common::SystemTimestamp /* observation_time */) noexcept override
+  {
+    count += measurements.size();
+  }
+
+  void RecordDouble(
+      const std::unordered_map<MetricAttributes, double, AttributeHashGenerator> &measurements,
+      opentelemetry::common::SystemTimestamp /* observation_time */) noexcept override
+  {
+    count += measurements.size();
+  }
+
+  std::atomic<size_t> count{0};
+};
+
+}  // namespace
+
+// An Observe() call concurrent to another one waits for the callbacks it invokes.
+TEST(ObservableRegistry, ConcurrentObserve)
+{
+  auto registry = std::make_shared<ObservableRegistry>();
+  auto *storage = new CountingAsyncStorage();
+  ObservableInstrument counter(
+      {"counter", "", "", InstrumentType::kObservableCounter, InstrumentValueType::kLong},
+      std::unique_ptr<AsyncWritableMetricStorage>(storage), registry);
+  CallbackState state;
+  state.value = 1;
+  state.blocked.store(true);
+  counter.AddCallback(ObserveState, &state);
+
+  std::thread first([&registry]() { registry->Observe(std::chrono::system_clock::now()); });
+  for (int i = 0; state.calls.load() == 0 && i < 1000; i++)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  std::thread second([&registry]() { registry->Observe(std::chrono::system_clock::now()); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  state.blocked.store(false);
+  first.join();
+  second.join();
+
+  EXPECT_EQ(state.calls.load(), 2u);
+  EXPECT_EQ(storage->count.load(), 2u);
+}
+
+TEST(ObservableRegistry, ParallelCallbacks)
+{
+  auto executor = std::make_shared<ObservableCallbackExecutor>(4, std::chrono::milliseconds(5000));
+  MeterProvider provider;
+  provider.SetObservableCallbackExecutor(executor);
+  std::shared_ptr<MetricReader> reader(new MockMetricReader());
+  provider.AddMetricReader(reader);
+
+  auto meter = provider.GetMeter("meter");
+  std::vector<CallbackState> states(20);
+  std::vector<nostd::shared_ptr<metrics::ObservableInstrument>> counters;
+  for (size_t i = 0; i < states.size(); i++)
+  {
+    states[i].value = static_cast<int64_t>(i);
+    counters.push_back(meter->CreateInt64ObservableCounter("counter" + std::to_string(i)));
+    counters.back()->AddCallback(ObserveState, &states[i]);
+  }
+
+  for (int collection = 0; collection < 3; collection++)
+  {
+    auto sums = CollectSums(*reader);
+    ASSERT_EQ(sums.size(), states.size());
+    for (size_t i = 0; i < states.size(); i++)
+    {
+      EXPECT_EQ(sums["counter" + std::to_string(i)], static_cast<int64_t>(i));
+      EXPECT_EQ(states[i].calls.load(), static_cast<size_t>(collection + 1));
+    }
+  }
+  EXPECT_EQ(executor->GetLateCallbackCount(), 0u);
+  EXPECT_EQ(executor->GetSkippedCallbackCount(), 0u);
+}
+
+// The measurements of a late callback are dropped, and the callback is skipped until it returned.
+TEST(ObservableRegistry, LateCallback)
+{
+  auto executor = std::make_shared<ObservableCallbackExecutor>(3, std::chrono::milliseconds(20));
+  MeterProvider provider;
+  provider.SetObservableCallbackExecutor(executor);
+  std::shared_ptr<MetricReader> reader(new MockMetricReader());
+  provider.AddMetricReader(reader);
+
+  auto meter = provider.GetMeter("meter");
+  CallbackState slow_state;
+  CallbackState fast_state;
+  slow_state.value = 1;
+  fast_state.value = 2;
+  slow_state.blocked.store(true);
+  auto slow_counter = meter->CreateInt64ObservableCounter("slow");
+  auto fast_counter = meter->CreateInt64ObservableCounter("fast");
+  slow_counter->AddCallback(ObserveState, &slow_state);
+  fast_counter->AddCallback(ObserveState, &fast_state);
+
+  auto sums = CollectSums(*reader);
+  EXPECT_EQ(sums.count("slow"), 0u);
+  EXPECT_EQ(sums["fast"], 2);
+  EXPECT_EQ(executor->GetLateCallbackCount(), 1u);
+
+  sums = CollectSums(*reader);
+  EXPECT_EQ(sums.count("slow"), 0u);
+  EXPECT_EQ(sums["fast"], 2);
+  EXPECT_EQ(slow_state.calls.load(), 1u);
+  EXPECT_EQ(fast_state.calls.load(), 2u);
+  EXPECT_EQ(executor->GetSkippedCallbackCount(), 1u);
+
+  // Once the late callback returned, it is invoked again by the next collections.
+  slow_state.blocked.store(false);
+  for (int i = 0; sums.count("slow") == 0 && i < 1000; i++)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    sums = CollectSums(*reader);
+  }
+  EXPECT_EQ(sums["slow"], 1);
+  EXPECT_EQ(sums["fast"], 2);
+  EXPECT_EQ(slow_state.calls.load(), 2u);
+  EXPECT_EQ(executor->GetLateCallbackCount(), 1u);
+}
+
+// Removing a callback waits until it returned.
+TEST(ObservableRegistry, RemoveLateCallback)
+{
+  auto executor = std::make_shared<ObservableCallbackExecutor>(2, std::chrono::milliseconds(10));
+  MeterProvider provider;
+  provider.SetObservableCallbackExecutor(executor);
+  std::shared_ptr<MetricReader> reader(new MockMetricReader());
+  provider.AddMetricReader(reader);
+
+  CallbackState state;
+  state.blocked.store(true);
+  auto counter = provider.GetMeter("meter")->CreateInt64ObservableCounter("counter");
+  counter->AddCallback(ObserveState, &state);
+  CollectSums(*reader);
+  EXPECT_EQ(executor->GetLateCallbackCount(), 1u);
+
+  std::thread unblock([&state]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    state.blocked.store(false);
+  });
+  counter->RemoveCallback(ObserveState, &state);
+  EXPECT_EQ(state.returns.load(), 1u);
+  unblock.join();
+}
@@ -4,27 +4,47 @@
 #include <benchmark/benchmark.h>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <initializer_list>
+#include <map>
+#include <memory>
 #include <random>
+#include <string>
 #include <thread>
 #include <utility>
 #include <vector>
 #include "common.h"
 
+#include "opentelemetry/common/key_value_iterable_view.h"
+#include "opentelemetry/common/timestamp.h"
+#include "opentelemetry/context/context.h"
 #include "opentelemetry/metrics/meter.h"
 #include "opentelemetry/metrics/sync_instruments.h"
 #include "opentelemetry/nostd/function_ref.h"
 #include "opentelemetry/nostd/shared_ptr.h"
 #include "opentelemetry/nostd/string_view.h"
+#include "opentelemetry/nostd/unique_ptr.h"
 #include "opentelemetry/nostd/variant.h"
 #include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
+#include "opentelemetry/sdk/metrics/aggregation/aggregation.h"
+#include "opentelemetry/sdk/metrics/aggregation/aggregation_config.h"
+#include "opentelemetry/sdk/metrics/aggregation/sum_aggregation.h"
 #include "opentelemetry/sdk/metrics/data/metric_data.h"
 #include "opentelemetry/sdk/metrics/data/point_data.h"
 #include "opentelemetry/sdk/metrics/export/metric_producer.h"
+#include "opentelemetry/sdk/metrics/instruments.h"
 #include "opentelemetry/sdk/metrics/meter_provider.h"
 #include "opentelemetry/sdk/metrics/metric_reader.h"
 #include "opentelemetry/sdk/metrics/push_metric_exporter.h"
+#include "opentelemetry/sdk/metrics/state/metric_collector.h"
+#include "opentelemetry/sdk/metrics/state/sync_metric_storage.h"
+#include "opentelemetry/sdk/metrics/view/attributes_processor.h"
+
+#ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
+#  include "opentelemetry/sdk/metrics/exemplar/filter_type.h"
+#  include "opentelemetry/sdk/metrics/exemplar/reservoir.h"
+#endif
 
 using namespace opentelemetry;
 using namespace opentelemetry::sdk::instrumentationscope;
@@ -87,5 +107,115 @@ void BM_SumAggregation(benchmark::State &state)
 
 BENCHMARK(BM_SumAggregation);
 
+// Measurements recorded concurrently by all the threads to the same sum aggregation, i.e. to the
+// same attribute set of a counter.
+std::unique_ptr<Aggregation> contended_aggregation;
+
+void BM_LongSumAggregationContended(benchmark::State &state)
+{
+  if (state.thread_index() == 0)
+  {
+    contended_aggregation.reset(new LongSumAggregation(true));
+  }
+  for (auto _ : state)
+  {
+    contended_aggregation->Aggregate(static_cast<int64_t>(1));
+  }
+}
+
+BENCHMARK(BM_LongSumAggregationContended)->ThreadRange(1, 8)->UseRealTime();
+
+void BM_DoubleSumAggregationContended(benchmark::State &state)
+{
+  if (state.thread_index() == 0)
+  {
+    contended_aggregation.reset(new DoubleSumAggregation(true));
+  }
+  for (auto _ : state)
+  {
+    contended_aggregation->Aggregate(1.0);
+  }
+}
+
+BENCHMARK(BM_DoubleSumAggregationContended)->ThreadRange(1, 8)->UseRealTime();
+
+// Measurements recorded concurrently by all the threads to a counter without attributes.
+std::unique_ptr<MeterProvider> no_attributes_provider;
+nostd::unique_ptr<opentelemetry::metrics::Counter<uint64_t>> no_attributes_counter;
+
+void BM_CounterAddNoAttributes(benchmark::State &state)
+{
+  if (state.thread_index() == 0)
+  {
+    no_attributes_provider.reset(new MeterProvider());
+    std::shared_ptr<MetricReader> reader{new MockMetricReader()};
+    no_attributes_provider->AddMetricReader(reader);
+    no_attributes_counter =
+        no_attributes_provider->GetMeter("meter1")->CreateUInt64Counter("counter1");
+  }
+  for (auto _ : state)
+  {
+    no_attributes_counter->Add(1);
+  }
+  if (state.thread_index() == 0)
+  {
+    no_attributes_counter  = nullptr;
+    no_attributes_provider = nullptr;
+  }
+}
+
+BENCHMARK(BM_CounterAddNoAttributes)->ThreadRange(1, 8)->UseRealTime();
+
+// Cumulative collection of a counter with state.range(0) attribute sets, each recorded to once
+// between two collections, by two readers with cumulative temporality and one with delta
+// temporality.
+void BM_CumulativeCollection(benchmark::State &state)
+{
+  const size_t series_count = static_cast<size_t>(state.range(0));
+  InstrumentDescriptor instrument_descriptor = {"counter", "desc", "1", InstrumentType::kCounter,
+                                                InstrumentValueType::kLong};
+  AggregationConfig aggregation_config(series_count + 1);
+  SyncMetricStorage storage(instrument_descriptor, AggregationType::kSum,
+                            std::make_shared<DefaultAttributesProcessor>(),
+#ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
+                            ExemplarFilterType::kAlwaysOff,
+                            ExemplarReservoir::GetNoExemplarReservoir(),
+#endif
+                            &aggregation_config);
+  std::vector<std::shared_ptr<CollectorHandle>> collectors{
+      std::make_shared<MockCollectorHandle>(AggregationTemporality::kCumulative),
+      std::make_shared<MockCollectorHandle>(AggregationTemporality::kCumulative),
+      std::make_shared<MockCollectorHandle>(AggregationTemporality::kDelta)};
+
+  std::vector<std::map<std::string, std::string>> attributes(series_count);
+  for (size_t i = 0; i < series_count; i++)
+  {
+    attributes[i]["series"] = std::to_string(i);
+  }
+  const common::SystemTimestamp sdk_start_ts = std::chrono::system_clock::now();
+
+  size_t points = 0;
+  for (auto _ : state)
+  {
+    for (const auto &series_attributes : attributes)
+    {
+      storage.RecordLong(
+          1, common::KeyValueIterableView<std::map<std::string, std::string>>(series_attributes),
+          context::Context{});
+    }
+    for (const auto &collector : collectors)
+    {
+      storage.Collect(collector.get(), collectors, sdk_start_ts, std::chrono::system_clock::now(),
+                      [&points](const MetricData &metric_data) {
+                        points += metric_data.point_data_attr_.size();
+                        return true;
+                      });
+    }
+  }
+  benchmark::DoNotOptimize(points);
+}
+
+BENCHMARK(BM_CumulativeCollection)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
 }  // namespace
 BENCHMARK_MAIN();
@@ -2,14 +2,17 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <gtest/gtest.h>
+#include <cstdint>
 #include <limits>
 #include <map>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "opentelemetry/common/key_value_iterable_view.h"
 #include "opentelemetry/context/context.h"
+#include "opentelemetry/nostd/span.h"
 #include "opentelemetry/nostd/utility.h"
 #include "opentelemetry/sdk/metrics/instruments.h"
 #include "opentelemetry/sdk/metrics/state/metric_storage.h"
@@ -186,3 +189,89 @@ TEST(SyncInstruments, DoubleHistogram)
   histogram.Record(10.10, opentelemetry::common::KeyValueIterableView<M>({}),
                    opentelemetry::context::Context{});
 }
+
+#if OPENTELEMETRY_ABI_VERSION_NO >= 2
+namespace
+{
+
+// Keeps the values of the batches it records.
+class BatchRecordingStorage : public SyncWritableMetricStorage
+{
+public:
+  void RecordLong(int64_t, const opentelemetry::context::Context &) noexcept override {}
+  void RecordLong(int64_t,
+                  const opentelemetry::common::KeyValueIterable &,
+                  const opentelemetry::context::Context &) noexcept override
+  {}
+  void RecordDouble(double, const opentelemetry::context::Context &) noexcept override {}
+  void RecordDouble(double,
+                    const opentelemetry::common::KeyValueIterable &,
+                    const opentelemetry::context::Context &) noexcept override
+  {}
+
+  void RecordLongBatch(nostd::span<const int64_t> values,
+                       const opentelemetry::common::KeyValueIterable &,
+                       const opentelemetry::context::Context &) noexcept override
+  {
+    long_values_.insert(long_values_.end(), values.begin(), values.end());
+  }
+
+  void RecordDoubleBatch(nostd::span<const double> values,
+                         const opentelemetry::common::KeyValueIterable &,
+                         const opentelemetry::context::Context &) noexcept override
+  {
+    double_values_.insert(double_values_.end(), values.begin(), values.end());
+  }
+
+  std::vector<int64_t> long_values_;
+  std::vector<double> double_values_;
+};
+
+}  // namespace
+
+TEST(SyncInstruments, BatchRecording)
+{
+  const std::vector<uint64_t> long_values   = {1, 2, std::numeric_limits<uint64_t>::max(), 3};
+  const std::vector<double> double_values   = {1.5, -2.5, 3.5};
+  const std::vector<int64_t> expected_long  = {1, 2, 3};
+  const std::vector<double> expected_double = {1.5, 3.5};
+  const nostd::span<const uint64_t> long_span{long_values.data(), long_values.size()};
+  const nostd::span<const double> double_span{double_values.data(), double_values.size()};
+
+  // Values exceeding int64_t max and negative values are not recorded.
+  InstrumentDescriptor counter_descriptor = {
+      "long_counter", "description", "1", InstrumentType::kCounter, InstrumentValueType::kLong};
+  auto *long_counter_storage = new BatchRecordingStorage();
+  LongCounter long_counter(counter_descriptor,
+                           std::unique_ptr<SyncWritableMetricStorage>(long_counter_storage));
+  long_counter.AddBatch(long_span, opentelemetry::common::KeyValueIterableView<M>({}));
+  EXPECT_EQ(long_counter_storage->long_values_, expected_long);
+  // The overloads taking the attributes as a list are declared by the API instrument.
+  opentelemetry::metrics::Counter<uint64_t> &api_counter = long_counter;
+  api_counter.AddBatch(long_span, {{"abc", "123"}});
+  EXPECT_EQ(long_counter_storage->long_values_.size(), 2 * expected_long.size());
+
+  counter_descriptor.value_type_ = InstrumentValueType::kDouble;
+  auto *double_counter_storage   = new BatchRecordingStorage();
+  DoubleCounter double_counter(counter_descriptor,
+                               std::unique_ptr<SyncWritableMetricStorage>(double_counter_storage));
+  double_counter.AddBatch(double_span, opentelemetry::common::KeyValueIterableView<M>({}));
+  EXPECT_EQ(double_counter_storage->double_values_, expected_double);
+
+  InstrumentDescriptor histogram_descriptor = {
+      "long_histogram", "description", "1", InstrumentType::kHistogram, InstrumentValueType::kLong};
+  auto *long_histogram_storage = new BatchRecordingStorage();
+  LongHistogram long_histogram(histogram_descriptor,
+                               std::unique_ptr<SyncWritableMetricStorage>(long_histogram_storage));
+  long_histogram.RecordBatch(long_span, opentelemetry::common::KeyValueIterableView<M>({}));
+  EXPECT_EQ(long_histogram_storage->long_values_, expected_long);
+
+  histogram_descriptor.value_type_ = InstrumentValueType::kDouble;
+  auto *double_histogram_storage   = new BatchRecordingStorage();
+  DoubleHistogram double_histogram(
+      histogram_descriptor, std::unique_ptr<SyncWritableMetricStorage>(double_histogram_storage));
+  opentelemetry::metrics::Histogram<double> &api_histogram = double_histogram;
+  api_histogram.RecordBatch(double_span, {{"abc", "123"}});
+  EXPECT_EQ(double_histogram_storage->double_values_, expected_double);
+}
+#endif
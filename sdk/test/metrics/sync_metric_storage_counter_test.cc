@@ -2,12 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <gtest/gtest.h>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #include "common.h"
@@ -499,6 +501,189 @@ TEST(SyncMetricStorageTest, DeltaCounterMultiCollectorFirstIntervalUsesInstrumen
   EXPECT_GT(metric_data.start_ts.time_since_epoch(), sdk_start_ts.time_since_epoch());
   EXPECT_EQ(metric_data.end_ts, collection_ts);
 }
+
+TEST(SyncMetricStorageTest, MixedTemporalityCollectors)
+{
+  // The collectors with cumulative temporality share the cumulative state, while each collector
+  // with delta temporality only reports what was recorded since its own last collection.
+  InstrumentDescriptor instr_desc = {"name", "desc", "1unit", InstrumentType::kCounter,
+                                     InstrumentValueType::kLong};
+  std::shared_ptr<DefaultAttributesProcessor> default_attributes_processor{
+      new DefaultAttributesProcessor{}};
+  opentelemetry::sdk::metrics::SyncMetricStorage storage(
+      instr_desc, AggregationType::kSum, default_attributes_processor,
+#ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
+      ExemplarFilterType::kAlwaysOff, ExemplarReservoir::GetNoExemplarReservoir(),
+#endif
+      nullptr);
+
+  std::shared_ptr<CollectorHandle> cumulative_a(
+      new MockCollectorHandle(AggregationTemporality::kCumulative));
+  std::shared_ptr<CollectorHandle> cumulative_b(
+      new MockCollectorHandle(AggregationTemporality::kCumulative));
+  std::shared_ptr<CollectorHandle> delta(new MockCollectorHandle(AggregationTemporality::kDelta));
+  std::vector<std::shared_ptr<CollectorHandle>> collectors{cumulative_a, cumulative_b, delta};
+
+  std::map<std::string, std::string> attributes = {{"RequestType", "GET"}};
+  auto record = [&](int64_t value) {
+    storage.RecordLong(value,
+                       KeyValueIterableView<std::map<std::string, std::string>>(attributes),
+                       opentelemetry::context::Context{});
+  };
+  auto sdk_start_ts = std::chrono::system_clock::now();
+  // Returns the collected sum, or -1 when nothing was reported.
+  auto collect = [&](const std::shared_ptr<CollectorHandle> &collector) {
+    int64_t sum = -1;
+    storage.Collect(collector.get(), collectors, sdk_start_ts, std::chrono::system_clock::now(),
+                    [&](const MetricData &metric_data) {
+                      EXPECT_EQ(metric_data.point_data_attr_.size(), size_t{1});
+                      const auto &data = opentelemetry::nostd::get<SumPointData>(
+                          metric_data.point_data_attr_[0].point_data);
+                      sum = opentelemetry::nostd::get<int64_t>(data.value_);
+                      return true;
+                    });
+    return sum;
+  };
+
+  record(10);
+  EXPECT_EQ(collect(cumulative_a), 10);
+  record(5);
+  EXPECT_EQ(collect(delta), 15);
+  EXPECT_EQ(collect(cumulative_b), 15);
+  EXPECT_EQ(collect(cumulative_a), 15);
+  EXPECT_EQ(collect(delta), -1);
+  record(1);
+  EXPECT_EQ(collect(cumulative_b), 16);
+  EXPECT_EQ(collect(delta), 1);
+  EXPECT_EQ(collect(cumulative_a), 16);
+}
+
+TEST(SyncMetricStorageTest, NoAttributesMeasurements)
+{
+  // Measurements without attributes, or with an empty attribute set, are reported in a single
+  // point alongside the points of the other attribute sets.
+  InstrumentDescriptor instr_desc = {"name", "desc", "1unit", InstrumentType::kCounter,
+                                     InstrumentValueType::kLong};
+  std::shared_ptr<DefaultAttributesProcessor> default_attributes_processor{
+      new DefaultAttributesProcessor{}};
+  opentelemetry::sdk::metrics::SyncMetricStorage storage(
+      instr_desc, AggregationType::kSum, default_attributes_processor,
+#ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
+      ExemplarFilterType::kAlwaysOff, ExemplarReservoir::GetNoExemplarReservoir(),
+#endif
+      nullptr);
+
+  std::shared_ptr<CollectorHandle> cumulative(
+      new MockCollectorHandle(AggregationTemporality::kCumulative));
+  std::shared_ptr<CollectorHandle> delta(new MockCollectorHandle(AggregationTemporality::kDelta));
+  std::vector<std::shared_ptr<CollectorHandle>> collectors{cumulative, delta};
+
+  std::map<std::string, std::string> no_attributes;
+  std::map<std::string, std::string> attributes = {{"RequestType", "GET"}};
+  auto sdk_start_ts                             = std::chrono::system_clock::now();
+  // Returns the collected sums of the empty and GET attribute sets, -1 when not reported.
+  auto collect = [&](const std::shared_ptr<CollectorHandle> &collector) {
+    std::pair<int64_t, int64_t> sums{-1, -1};
+    storage.Collect(collector.get(), collectors, sdk_start_ts, std::chrono::system_clock::now(),
+                    [&](const MetricData &metric_data) {
+                      for (const auto &data_attr : metric_data.point_data_attr_)
+                      {
+                        const auto &data =
+                            opentelemetry::nostd::get<SumPointData>(data_attr.point_data);
+                        int64_t value = opentelemetry::nostd::get<int64_t>(data.value_);
+                        if (data_attr.attributes.empty())
+                        {
+                          EXPECT_EQ(sums.first, -1);
+                          sums.first = value;
+                        }
+                        else
+                        {
+                          EXPECT_EQ(sums.second, -1);
+                          sums.second = value;
+                        }
+                      }
+                      return true;
+                    });
+    return sums;
+  };
+
+  storage.RecordLong(10, opentelemetry::context::Context{});
+  storage.RecordLong(5, KeyValueIterableView<std::map<std::string, std::string>>(no_attributes),
+                     opentelemetry::context::Context{});
+  storage.RecordLong(7, KeyValueIterableView<std::map<std::string, std::string>>(attributes),
+                     opentelemetry::context::Context{});
+  int64_t batch[] = {1, 2};
+  storage.RecordLongBatch(opentelemetry::nostd::span<const int64_t>(batch),
+                          KeyValueIterableView<std::map<std::string, std::string>>(no_attributes),
+                          opentelemetry::context::Context{});
+  EXPECT_EQ(collect(cumulative), std::make_pair(int64_t{18}, int64_t{7}));
+
+  storage.RecordLong(2, opentelemetry::context::Context{});
+  EXPECT_EQ(collect(delta), std::make_pair(int64_t{20}, int64_t{7}));
+  EXPECT_EQ(collect(cumulative), std::make_pair(int64_t{20}, int64_t{7}));
+  EXPECT_EQ(collect(delta), std::make_pair(int64_t{-1}, int64_t{-1}));
+  storage.RecordLong(3, opentelemetry::context::Context{});
+  EXPECT_EQ(collect(delta), std::make_pair(int64_t{3}, int64_t{-1}));
+  EXPECT_EQ(collect(cumulative), std::make_pair(int64_t{23}, int64_t{7}));
+}
+
+TEST(SyncMetricStorageTest, NoAttributesConcurrentCollection)
+{
+  // No measurement recorded without attributes is lost or reported twice while collecting.
+  InstrumentDescriptor instr_desc = {"name", "desc", "1unit", InstrumentType::kCounter,
+                                     InstrumentValueType::kLong};
+  std::shared_ptr<DefaultAttributesProcessor> default_attributes_processor{
+      new DefaultAttributesProcessor{}};
+  opentelemetry::sdk::metrics::SyncMetricStorage storage(
+      instr_desc, AggregationType::kSum, default_attributes_processor,
+#ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
+      ExemplarFilterType::kAlwaysOff, ExemplarReservoir::GetNoExemplarReservoir(),
+#endif
+      nullptr);
+  std::shared_ptr<CollectorHandle> collector(
+      new MockCollectorHandle(AggregationTemporality::kDelta));
+  std::vector<std::shared_ptr<CollectorHandle>> collectors{collector};
+
+  int64_t collected = 0;
+  auto collect      = [&]() {
+    storage.Collect(collector.get(), collectors, std::chrono::system_clock::now(),
+                    std::chrono::system_clock::now(), [&](const MetricData &metric_data) {
+                      for (const auto &data_attr : metric_data.point_data_attr_)
+                      {
+                        const auto &data =
+                            opentelemetry::nostd::get<SumPointData>(data_attr.point_data);
+                        collected += opentelemetry::nostd::get<int64_t>(data.value_);
+                      }
+                      return true;
+                    });
+  };
+
+  constexpr int kThreads          = 4;
+  constexpr int kRecordsPerThread = 20000;
+  std::atomic<int> finished_threads{0};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; i++)
+  {
+    threads.emplace_back([&]() {
+      for (int j = 0; j < kRecordsPerThread; j++)
+      {
+        storage.RecordLong(1, opentelemetry::context::Context{});
+      }
+      finished_threads.fetch_add(1);
+    });
+  }
+  while (finished_threads.load() < kThreads)
+  {
+    collect();
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+  collect();
+  EXPECT_EQ(collected, int64_t{kThreads} * kRecordsPerThread);
+}
+
 INSTANTIATE_TEST_SUITE_P(WritableMetricStorageTestDouble,
                          CounterWritableMetricStorageTestFixture,
                          ::testing::Values(AggregationTemporality::kCumulative,
@@ -542,4 +542,63 @@ INSTANTIATE_TEST_SUITE_P(WritableMetricStorageHistogramTestBase2ExponentialDoubl
                          ::testing::Values(AggregationTemporality::kCumulative,
                                            AggregationTemporality::kDelta));
 
+TEST(WritableMetricStorageHistogramTest, RecordDoubleBatch)
+{
+  InstrumentDescriptor instr_desc = {"name", "desc", "1unit", InstrumentType::kHistogram,
+                                     InstrumentValueType::kDouble};
+  std::map<std::string, std::string> attributes_batch  = {{"RequestType", "BATCH"}};
+  std::map<std::string, std::string> attributes_single = {{"RequestType", "SINGLE"}};
+  const std::vector<double> values                     = {3.5, 0.0, 240.0, 12.25, 7000.0};
+
+  std::shared_ptr<DefaultAttributesProcessor> default_attributes_processor{
+      new DefaultAttributesProcessor{}};
+  opentelemetry::sdk::metrics::SyncMetricStorage storage(
+      instr_desc, AggregationType::kHistogram, default_attributes_processor,
+#ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
+      ExemplarFilterType::kAlwaysOff, ExemplarReservoir::GetNoExemplarReservoir(),
+#endif
+      nullptr);
+
+  storage.RecordDoubleBatch(
+      opentelemetry::nostd::span<const double>{values.data(), values.size()},
+      KeyValueIterableView<std::map<std::string, std::string>>(attributes_batch),
+      opentelemetry::context::Context{});
+  for (double value : values)
+  {
+    storage.RecordDouble(
+        value, KeyValueIterableView<std::map<std::string, std::string>>(attributes_single),
+        opentelemetry::context::Context{});
+  }
+  // An empty batch does not create a point.
+  storage.RecordDoubleBatch(opentelemetry::nostd::span<const double>{},
+                            KeyValueIterableView<std::map<std::string, std::string>>({}),
+                            opentelemetry::context::Context{});
+
+  std::shared_ptr<CollectorHandle> collector(
+      new MockCollectorHandle(AggregationTemporality::kDelta));
+  std::vector<std::shared_ptr<CollectorHandle>> collectors;
+  collectors.push_back(collector);
+
+  auto collection_ts = std::chrono::system_clock::now();
+  std::vector<HistogramPointData> points;
+  storage.Collect(collector.get(), collectors, collection_ts, collection_ts,
+                  [&](const MetricData &metric_data) {
+                    for (const auto &data_attr : metric_data.point_data_attr_)
+                    {
+                      points.push_back(
+                          opentelemetry::nostd::get<HistogramPointData>(data_attr.point_data));
+                    }
+                    return true;
+                  });
+  ASSERT_EQ(points.size(), 2);
+  EXPECT_EQ(points[0].count_, values.size());
+  EXPECT_EQ(points[0].count_, points[1].count_);
+  EXPECT_EQ(points[0].counts_, points[1].counts_);
+  EXPECT_EQ(opentelemetry::nostd::get<double>(points[0].sum_),
+            opentelemetry::nostd::get<double>(points[1].sum_));
+  EXPECT_EQ(opentelemetry::nostd::get<double>(points[0].min_), 0.0);
+  EXPECT_EQ(opentelemetry::nostd::get<double>(points[0].max_), 7000.0);
+  EXPECT_EQ(opentelemetry::nostd::get<double>(points[1].max_), 7000.0);
+}
+
 }  // namespace
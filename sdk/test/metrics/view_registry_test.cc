@@ -4,16 +4,21 @@
 #include <gtest/gtest.h>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "opentelemetry/common/macros.h"
 #include "opentelemetry/nostd/function_ref.h"
 #include "opentelemetry/nostd/unique_ptr.h"
+#include "opentelemetry/sdk/common/global_log_handler.h"
 #include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
 #include "opentelemetry/sdk/metrics/instruments.h"
 #include "opentelemetry/sdk/metrics/view/instrument_selector.h"
 #include "opentelemetry/sdk/metrics/view/meter_selector.h"
+#include "opentelemetry/sdk/metrics/view/predicate.h"
+#include "opentelemetry/sdk/metrics/view/predicate_factory.h"
 #include "opentelemetry/sdk/metrics/view/view.h"
 #include "opentelemetry/sdk/metrics/view/view_registry.h"
+#include "opentelemetry/test_common/sdk/common/scoped_test_log_handler.h"
 
 using namespace opentelemetry::sdk::metrics;
 using namespace opentelemetry::sdk::instrumentationscope;
@@ -135,3 +140,97 @@ TEST(ViewRegistry, AddViewWithAllNullParameters)
   // Should not throw or abort, just log and ignore
   registry.AddView(nullptr, nullptr, nullptr);
 }
+
+TEST(ViewRegistry, PatternPredicate)
+{
+  EXPECT_TRUE(PatternPredicate("*").Match(""));
+  EXPECT_TRUE(PatternPredicate("*").Match("http.server.duration"));
+  EXPECT_TRUE(PatternPredicate("http.*").Match("http.server.duration"));
+  EXPECT_TRUE(PatternPredicate("http.*").Match("http."));
+  EXPECT_FALSE(PatternPredicate("http.*").Match("http"));
+  EXPECT_FALSE(PatternPredicate("http.*").Match("https.server.duration"));
+  EXPECT_TRUE(PatternPredicate("*.duration").Match("http.server.duration"));
+  EXPECT_FALSE(PatternPredicate("*.duration").Match("http.server.duration.max"));
+  EXPECT_TRUE(PatternPredicate("http.*.duration").Match("http.server.duration"));
+  EXPECT_TRUE(PatternPredicate("http.**.duration").Match("http..duration"));
+  EXPECT_TRUE(PatternPredicate("a*b*c").Match("aXbYbZc"));
+  EXPECT_FALSE(PatternPredicate("a*b*c").Match("aXbYbZ"));
+  EXPECT_TRUE(PatternPredicate("counter?").Match("counter1"));
+  EXPECT_FALSE(PatternPredicate("counter?").Match("counter"));
+  EXPECT_FALSE(PatternPredicate("counter?").Match("counter12"));
+  EXPECT_TRUE(PatternPredicate("?*?").Match("ab"));
+  EXPECT_FALSE(PatternPredicate("?*?").Match("a"));
+
+  // A pattern without wildcard is an exact predicate, which can be indexed by the name it matches.
+  auto exact = PredicateFactory::GetPredicate("counter.total", PredicateType::kPattern);
+  ASSERT_NE(exact->GetExactMatch(), nullptr);
+  EXPECT_EQ(*exact->GetExactMatch(), "counter.total");
+  EXPECT_TRUE(exact->Match("counter.total"));
+  EXPECT_FALSE(exact->Match("counterXtotal"));
+  EXPECT_EQ(PredicateFactory::GetPredicate("counter.*", PredicateType::kPattern)->GetExactMatch(),
+            nullptr);
+}
+
+TEST(ViewRegistry, PatternWithRegexSyntaxWarns)
+{
+  using opentelemetry::sdk::common::internal_log::LogLevel;
+  opentelemetry::test_common::ScopedTestLogHandler log_handler{LogLevel::Warning};
+
+  // Instrument name patterns used to be regular expressions.
+  EXPECT_TRUE(PatternPredicate::HasRegexSyntax(".*"));
+  EXPECT_TRUE(PatternPredicate::HasRegexSyntax("http.server.+"));
+  EXPECT_TRUE(PatternPredicate::HasRegexSyntax("(a|b)"));
+  EXPECT_TRUE(PatternPredicate::HasRegexSyntax("^counter$"));
+  EXPECT_TRUE(PatternPredicate::HasRegexSyntax("counter[0-9]"));
+  EXPECT_FALSE(PatternPredicate::HasRegexSyntax("http.server.duration"));
+  EXPECT_FALSE(PatternPredicate::HasRegexSyntax("http.*"));
+  EXPECT_FALSE(PatternPredicate::HasRegexSyntax("counter?"));
+
+  auto predicate = PredicateFactory::GetPredicate(".*", PredicateType::kPattern);
+  EXPECT_FALSE(predicate->Match("counter"));
+  auto logs = log_handler.Drain();
+  ASSERT_EQ(logs.size(), 1);
+  EXPECT_EQ(logs[0].level, LogLevel::Warning);
+  EXPECT_NE(logs[0].msg.find("\".*\""), std::string::npos);
+
+  PredicateFactory::GetPredicate("http.*", PredicateType::kPattern);
+  PredicateFactory::GetPredicate("http.server.duration", PredicateType::kPattern);
+  EXPECT_TRUE(log_handler.Drain().empty());
+}
+
+TEST(ViewRegistry, FindViewsInRegistrationOrder)
+{
+  ViewRegistry registry;
+  auto add_view = [&registry](const std::string &instrument_name, const std::string &view_name) {
+    registry.AddView(std::unique_ptr<InstrumentSelector>(
+                         new InstrumentSelector(InstrumentType::kCounter, instrument_name, "")),
+                     std::unique_ptr<MeterSelector>(new MeterSelector("", "", "")),
+                     std::unique_ptr<View>(new View(view_name)));
+  };
+  add_view("requests.*", "wildcard1");
+  add_view("requests.total", "exact1");
+  add_view("other", "other");
+  add_view("*", "wildcard2");
+  add_view("requests.total", "exact2");
+  add_view("requests.total.*", "wildcard3");
+
+  auto scope                   = InstrumentationScope::Create("meter");
+  InstrumentDescriptor counter = {"requests.total", "", "", InstrumentType::kCounter,
+                                  InstrumentValueType::kLong};
+  std::vector<std::string> views;
+  registry.FindViews(counter, *scope, [&views](const View &view) {
+    views.push_back(view.GetName());
+    return true;
+  });
+  EXPECT_EQ(views, (std::vector<std::string>{"wildcard1", "exact1", "wildcard2", "exact2"}));
+
+  // The views with a matching name still select the instrument type.
+  InstrumentDescriptor histogram = {"requests.total", "", "", InstrumentType::kHistogram,
+                                    InstrumentValueType::kLong};
+  views.clear();
+  registry.FindViews(histogram, *scope, [&views](const View &view) {
+    views.push_back(view.GetName());
+    return true;
+  });
+  EXPECT_EQ(views, (std::vector<std::string>{""}));
+}
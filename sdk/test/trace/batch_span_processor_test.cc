@@ -7,6 +7,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdlib>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <utility>
@@ -105,6 +106,105 @@ class MockSpanExporter final : public sdk::trace::SpanExporter
   std::chrono::milliseconds export_delay_;
 };
 
+/**
+ * A span exporter which only counts the recordables it makes and records the names of the exported
+ * spans, leaving the recordables to the processor.
+ */
+class SpanNameExporter final : public sdk::trace::SpanExporter
+{
+public:
+  SpanNameExporter(std::shared_ptr<std::atomic<std::size_t>> made_count,
+                   std::shared_ptr<std::vector<std::string>> names) noexcept
+      : made_count_(std::move(made_count)), names_(std::move(names))
+  {}
+
+  std::unique_ptr<sdk::trace::Recordable> MakeRecordable() noexcept override
+  {
+    ++(*made_count_);
+    return std::unique_ptr<sdk::trace::Recordable>(new sdk::trace::SpanData);
+  }
+
+  sdk::common::ExportResult Export(
+      const nostd::span<std::unique_ptr<sdk::trace::Recordable>> &recordables) noexcept override
+  {
+    for (auto &recordable : recordables)
+    {
+      names_->push_back(
+          std::string(static_cast<sdk::trace::SpanData *>(recordable.get())->GetName()));
+    }
+    return sdk::common::ExportResult::kSuccess;
+  }
+
+  bool ForceFlush(std::chrono::microseconds /*timeout*/) noexcept override { return true; }
+
+  bool Shutdown(std::chrono::microseconds /* timeout */) noexcept override { return true; }
+
+private:
+  std::shared_ptr<std::atomic<std::size_t>> made_count_;
+  std::shared_ptr<std::vector<std::string>> names_;
+};
+
+/**
+ * A span exporter which allows concurrent exports, records the names of the exported spans and the
+ * maximum number of exports running at once.
+ */
+class ConcurrentSpanExporter final : public sdk::trace::SpanExporter
+{
+public:
+  ConcurrentSpanExporter(std::size_t max_concurrent_exports,
+                         std::chrono::milliseconds export_delay,
+                         std::shared_ptr<std::atomic<std::size_t>> max_running_exports,
+                         std::shared_ptr<std::vector<std::string>> names) noexcept
+      : max_concurrent_exports_(max_concurrent_exports),
+        export_delay_(export_delay),
+        max_running_exports_(std::move(max_running_exports)),
+        names_(std::move(names))
+  {}
+
+  std::unique_ptr<sdk::trace::Recordable> MakeRecordable() noexcept override
+  {
+    return std::unique_ptr<sdk::trace::Recordable>(new sdk::trace::SpanData);
+  }
+
+  sdk::common::ExportResult Export(
+      const nostd::span<std::unique_ptr<sdk::trace::Recordable>> &recordables) noexcept override
+  {
+    std::size_t running = ++running_exports_;
+    std::size_t max_running = max_running_exports_->load();
+    while (running > max_running &&
+           !max_running_exports_->compare_exchange_weak(max_running, running))
+    {
+    }
+
+    std::this_thread::sleep_for(export_delay_);
+    {
+      std::lock_guard<std::mutex> guard(names_m_);
+      for (auto &recordable : recordables)
+      {
+        names_->push_back(
+            std::string(static_cast<sdk::trace::SpanData *>(recordable.get())->GetName()));
+      }
+    }
+
+    --running_exports_;
+    return sdk::common::ExportResult::kSuccess;
+  }
+
+  std::size_t GetMaxConcurrentExports() const noexcept override { return max_concurrent_exports_; }
+
+  bool ForceFlush(std::chrono::microseconds /*timeout*/) noexcept override { return true; }
+
+  bool Shutdown(std::chrono::microseconds /* timeout */) noexcept override { return true; }
+
+private:
+  std::size_t max_concurrent_exports_;
+  std::chrono::milliseconds export_delay_;
+  std::atomic<std::size_t> running_exports_{0};
+  std::shared_ptr<std::atomic<std::size_t>> max_running_exports_;
+  std::mutex names_m_;
+  std::shared_ptr<std::vector<std::string>> names_;
+};
+
 /**
  * Fixture Class
  */
@@ -372,6 +472,183 @@ TEST_F(BatchSpanProcessorTestPeer, TestScheduleDelayMillis)
   }
 }
 
+TEST_F(BatchSpanProcessorTestPeer, TestRecordableReuse)
+{
+  /* Test that the exported recordables are reset and reused, up to recordable_pool_size */
+
+  std::shared_ptr<std::atomic<std::size_t>> made_count(new std::atomic<std::size_t>(0));
+  std::shared_ptr<std::vector<std::string>> names(new std::vector<std::string>);
+  const int num_spans = 4;
+  sdk::trace::BatchSpanProcessorOptions options{};
+  options.recordable_pool_size = num_spans;
+
+  auto batch_processor =
+      std::shared_ptr<sdk::trace::BatchSpanProcessor>(new sdk::trace::BatchSpanProcessor(
+          std::unique_ptr<sdk::trace::SpanExporter>(new SpanNameExporter(made_count, names)),
+          options));
+
+  auto test_spans = GetTestSpans(batch_processor, num_spans + 1);
+  std::vector<sdk::trace::Recordable *> exported;
+  for (auto &span : *test_spans)
+  {
+    exported.push_back(span.get());
+    batch_processor->OnEnd(std::move(span));
+  }
+  EXPECT_TRUE(batch_processor->ForceFlush());
+  ASSERT_EQ(num_spans + 1, names->size());
+
+  EXPECT_EQ(num_spans + 1, made_count->load());
+
+  std::vector<std::unique_ptr<sdk::trace::Recordable>> reused_spans;
+  for (int i = 0; i < num_spans; ++i)
+  {
+    reused_spans.push_back(batch_processor->MakeRecordable());
+    EXPECT_NE(exported.end(),
+              std::find(exported.begin(), exported.end(), reused_spans.back().get()));
+    EXPECT_EQ("", static_cast<sdk::trace::SpanData *>(reused_spans.back().get())->GetName());
+  }
+  EXPECT_EQ(num_spans + 1, made_count->load());
+
+  // The pool is empty, the next recordable is made by the exporter.
+  auto recordable = batch_processor->MakeRecordable();
+  EXPECT_NE(nullptr, recordable);
+  EXPECT_EQ(num_spans + 2, made_count->load());
+}
+
+TEST_F(BatchSpanProcessorTestPeer, TestExportBatchesInFlight)
+{
+  /* Test that the batches in flight are exported in order, by force flush and by shutdown */
+
+  std::shared_ptr<std::atomic<std::size_t>> shut_down_counter(new std::atomic<std::size_t>(0));
+  std::shared_ptr<std::atomic<bool>> is_shutdown(new std::atomic<bool>(false));
+  std::shared_ptr<std::atomic<bool>> is_export_completed(new std::atomic<bool>(false));
+  std::shared_ptr<std::vector<std::unique_ptr<sdk::trace::SpanData>>> spans_received(
+      new std::vector<std::unique_ptr<sdk::trace::SpanData>>);
+  const std::chrono::milliseconds export_delay(5);
+  const int num_spans = 200;
+  sdk::trace::BatchSpanProcessorOptions options{};
+  options.max_export_batch_size        = 16;
+  options.max_export_batches_in_flight = 3;
+
+  auto batch_processor =
+      std::shared_ptr<sdk::trace::BatchSpanProcessor>(new sdk::trace::BatchSpanProcessor(
+          std::unique_ptr<sdk::trace::SpanExporter>(new MockSpanExporter(
+              spans_received, shut_down_counter, is_shutdown, is_export_completed, export_delay)),
+          options));
+
+  auto test_spans = GetTestSpans(batch_processor, num_spans);
+  for (int i = 0; i < num_spans; ++i)
+  {
+    batch_processor->OnEnd(std::move(test_spans->at(i)));
+  }
+
+  EXPECT_TRUE(batch_processor->ForceFlush());
+  EXPECT_GE(shut_down_counter->load(), 1);
+
+  ASSERT_EQ(num_spans, spans_received->size());
+  for (int i = 0; i < num_spans; ++i)
+  {
+    EXPECT_EQ("Span " + std::to_string(i), spans_received->at(i)->GetName());
+  }
+
+  auto more_test_spans = GetTestSpans(batch_processor, num_spans);
+  for (int i = 0; i < num_spans; ++i)
+  {
+    batch_processor->OnEnd(std::move(more_test_spans->at(i)));
+  }
+
+  EXPECT_TRUE(batch_processor->Shutdown());
+  EXPECT_TRUE(is_shutdown->load());
+
+  ASSERT_EQ(num_spans * 2, spans_received->size());
+  for (int i = 0; i < num_spans; ++i)
+  {
+    EXPECT_EQ("Span " + std::to_string(i), spans_received->at(num_spans + i)->GetName());
+  }
+}
+
+TEST_F(BatchSpanProcessorTestPeer, TestConcurrentExports)
+{
+  /* Test that an exporter allowing concurrent exports exports several batches at once */
+
+  std::shared_ptr<std::atomic<std::size_t>> max_running_exports(new std::atomic<std::size_t>(0));
+  std::shared_ptr<std::vector<std::string>> names(new std::vector<std::string>);
+  const int num_spans = 128;
+  sdk::trace::BatchSpanProcessorOptions options{};
+  options.max_export_batch_size        = 16;
+  options.max_export_batches_in_flight = 4;
+
+  auto batch_processor =
+      std::shared_ptr<sdk::trace::BatchSpanProcessor>(new sdk::trace::BatchSpanProcessor(
+          std::unique_ptr<sdk::trace::SpanExporter>(new ConcurrentSpanExporter(
+              4, std::chrono::milliseconds(50), max_running_exports, names)),
+          options));
+
+  auto test_spans = GetTestSpans(batch_processor, num_spans);
+  for (int i = 0; i < num_spans; ++i)
+  {
+    batch_processor->OnEnd(std::move(test_spans->at(i)));
+  }
+
+  // Let the worker thread take the spans from the queue in batches, a force flush takes them all.
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  EXPECT_TRUE(batch_processor->ForceFlush());
+  EXPECT_GE(max_running_exports->load(), 2);
+  EXPECT_LE(max_running_exports->load(), 4);
+
+  // The batches may be exported in any order, but each span is exported once.
+  ASSERT_EQ(num_spans, names->size());
+  std::sort(names->begin(), names->end());
+  std::vector<std::string> expected_names;
+  for (int i = 0; i < num_spans; ++i)
+  {
+    expected_names.push_back("Span " + std::to_string(i));
+  }
+  std::sort(expected_names.begin(), expected_names.end());
+  EXPECT_EQ(expected_names, *names);
+
+  EXPECT_TRUE(batch_processor->Shutdown());
+}
+
+TEST_F(BatchSpanProcessorTestPeer, TestShutdownTimeoutWithExportBatchesInFlight)
+{
+  /* Test that shutdown drops the batches in flight not exported before the timeout */
+
+  std::shared_ptr<std::atomic<std::size_t>> shut_down_counter(new std::atomic<std::size_t>(0));
+  std::shared_ptr<std::atomic<bool>> is_shutdown(new std::atomic<bool>(false));
+  std::shared_ptr<std::atomic<bool>> is_export_completed(new std::atomic<bool>(false));
+  std::shared_ptr<std::vector<std::unique_ptr<sdk::trace::SpanData>>> spans_received(
+      new std::vector<std::unique_ptr<sdk::trace::SpanData>>);
+  const std::chrono::milliseconds export_delay(300);
+  const int num_spans = 48;
+  sdk::trace::BatchSpanProcessorOptions options{};
+  options.max_export_batch_size        = 16;
+  options.max_export_batches_in_flight = 3;
+
+  auto batch_processor =
+      std::shared_ptr<sdk::trace::BatchSpanProcessor>(new sdk::trace::BatchSpanProcessor(
+          std::unique_ptr<sdk::trace::SpanExporter>(new MockSpanExporter(
+              spans_received, shut_down_counter, is_shutdown, is_export_completed, export_delay)),
+          options));
+
+  auto test_spans = GetTestSpans(batch_processor, num_spans);
+  for (int i = 0; i < num_spans; ++i)
+  {
+    batch_processor->OnEnd(std::move(test_spans->at(i)));
+  }
+
+  EXPECT_TRUE(batch_processor->Shutdown(std::chrono::milliseconds(100)));
+  EXPECT_TRUE(is_shutdown->load());
+
+  // The export running when the timeout elapsed completes, the batches queued after it are dropped.
+  EXPECT_LT(spans_received->size(), num_spans);
+  for (std::size_t i = 0; i < spans_received->size(); ++i)
+  {
+    EXPECT_EQ("Span " + std::to_string(i), spans_received->at(i)->GetName());
+  }
+}
+
 TEST(BatchSpanProcessorOptionsEnvTest, TestDefaultValues)
 {
   sdk::trace::BatchSpanProcessorOptions options;
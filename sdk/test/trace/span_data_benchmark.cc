@@ -76,6 +76,7 @@
 #include "opentelemetry/nostd/shared_ptr.h"
 #include "opentelemetry/nostd/string_view.h"
 #include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
+#include "opentelemetry/sdk/trace/span_data.h"
 #include "opentelemetry/sdk/trace/tracer_provider.h"
 #include "opentelemetry/test_common/sdk/trace/test_utils.h"
 #include "opentelemetry/trace/span.h"
@@ -204,6 +205,62 @@ BENCHMARK_REGISTER_F(SpanDataFixture, RecordSpanWithLinks)
     ->Arg(test_utils::kSpanLinkLimit)
     ->Unit(benchmark::kNanosecond);
 
+namespace
+{
+
+// Set attributes on a SpanData, as done by a recording span.
+void BM_SpanDataSetAttributes(benchmark::State &state)
+{
+  const std::vector<test_utils::SpanAttribute> attributes =
+      test_utils::MakeAttributes(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state)
+  {
+    trace_sdk::SpanData span_data;
+    for (const auto &attribute : attributes)
+    {
+      span_data.SetAttribute(attribute.first, attribute.second);
+    }
+    benchmark::DoNotOptimize(span_data.GetAttributes().size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpanDataSetAttributes)
+    ->ArgName("attribute_count")
+    ->Arg(1)
+    ->Arg(10)
+    ->Arg(test_utils::kSpanAttributeLimit)
+    ->Unit(benchmark::kNanosecond);
+
+// Iterate the attributes of a SpanData, as done by an exporter.
+void BM_SpanDataIterateAttributes(benchmark::State &state)
+{
+  const std::vector<test_utils::SpanAttribute> attributes =
+      test_utils::MakeAttributes(static_cast<std::size_t>(state.range(0)));
+  trace_sdk::SpanData span_data;
+  for (const auto &attribute : attributes)
+  {
+    span_data.SetAttribute(attribute.first, attribute.second);
+  }
+  for (auto _ : state)
+  {
+    std::size_t key_size = 0;
+    for (const auto &kv : span_data.GetAttributes())
+    {
+      key_size += kv.first.size() + kv.second.index();
+    }
+    benchmark::DoNotOptimize(key_size);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpanDataIterateAttributes)
+    ->ArgName("attribute_count")
+    ->Arg(1)
+    ->Arg(10)
+    ->Arg(test_utils::kSpanAttributeLimit)
+    ->Unit(benchmark::kNanosecond);
+
+}  // namespace
+
 int main(int argc, char **argv)
 {
   benchmark::Initialize(&argc, argv);
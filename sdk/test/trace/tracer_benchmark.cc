@@ -46,19 +46,33 @@
 
 #include <benchmark/benchmark.h>
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
 #include <utility>
 #include <vector>
 
+#include "opentelemetry/common/macros.h"
 #include "opentelemetry/context/context.h"
 #include "opentelemetry/exporters/memory/in_memory_span_exporter.h"
 #include "opentelemetry/nostd/shared_ptr.h"
+#include "opentelemetry/nostd/span.h"
 #include "opentelemetry/nostd/string_view.h"
 #include "opentelemetry/nostd/variant.h"
 #include "opentelemetry/sdk/instrumentationscope/scope_configurator.h"
+#include "opentelemetry/sdk/common/exporter_utils.h"
 #include "opentelemetry/sdk/resource/resource.h"
+#include "opentelemetry/sdk/trace/batch_span_processor.h"
+#include "opentelemetry/sdk/trace/batch_span_processor_options.h"
+#include "opentelemetry/sdk/trace/exporter.h"
 #include "opentelemetry/sdk/trace/processor.h"
+#include "opentelemetry/sdk/trace/recordable.h"
 #include "opentelemetry/sdk/trace/simple_processor.h"
+#include "opentelemetry/sdk/trace/span_data.h"
 #include "opentelemetry/sdk/trace/tracer.h"
 #include "opentelemetry/sdk/trace/tracer_config.h"
 #include "opentelemetry/sdk/trace/tracer_context.h"
@@ -78,8 +92,100 @@ using opentelemetry::exporter::memory::InMemorySpanExporter;
 
 namespace
 {
+// The number of allocations made by all the threads of the benchmark.
+std::atomic<uint64_t> allocation_count{0};
+}  // namespace
 
-std::shared_ptr<trace_api::Tracer> CreateTracer(bool is_enabled = true)
+void *operator new(std::size_t size)
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  void *memory = std::malloc(size == 0 ? 1 : size);
+  if (memory == nullptr)
+  {
+#if OPENTELEMETRY_HAVE_EXCEPTIONS
+    throw std::bad_alloc();
+#else
+    std::abort();
+#endif
+  }
+  return memory;
+}
+
+void operator delete(void *memory) noexcept
+{
+  std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+  std::free(memory);
+}
+
+namespace
+{
+
+// Report the average number of allocations made by an iteration, that is by a span.
+class AllocationCounter
+{
+public:
+  explicit AllocationCounter(benchmark::State &state)
+      : state_(state), start_count_(allocation_count.load(std::memory_order_relaxed))
+  {}
+
+  ~AllocationCounter()
+  {
+    state_.counters["allocs_per_span"] = benchmark::Counter(
+        static_cast<double>(allocation_count.load(std::memory_order_relaxed) - start_count_),
+        benchmark::Counter::kAvgIterations);
+  }
+
+private:
+  benchmark::State &state_;
+  uint64_t start_count_;
+};
+
+// An exporter dropping the spans, and leaving their recordables to the processor.
+class DiscardingSpanExporter final : public trace_sdk::SpanExporter
+{
+public:
+  std::unique_ptr<trace_sdk::Recordable> MakeRecordable() noexcept override
+  {
+    return std::unique_ptr<trace_sdk::Recordable>(new trace_sdk::SpanData);
+  }
+
+  opentelemetry::sdk::common::ExportResult Export(
+      const opentelemetry::nostd::span<std::unique_ptr<trace_sdk::Recordable>> &) noexcept override
+  {
+    return opentelemetry::sdk::common::ExportResult::kSuccess;
+  }
+
+  bool ForceFlush(std::chrono::microseconds) noexcept override { return true; }
+
+  bool Shutdown(std::chrono::microseconds) noexcept override { return true; }
+};
+
+// Create a tracer pooling its spans, with a batch span processor reusing the exported recordables.
+std::shared_ptr<trace_api::Tracer> CreatePooledTracer()
+{
+  constexpr std::size_t kPoolSize = 4096;
+
+  trace_sdk::BatchSpanProcessorOptions options{};
+  options.max_queue_size        = 2048;
+  options.max_export_batch_size = 512;
+  options.recordable_pool_size  = kPoolSize;
+
+  auto processor = std::make_unique<trace_sdk::BatchSpanProcessor>(
+      std::make_unique<DiscardingSpanExporter>(), options);
+  std::vector<std::unique_ptr<trace_sdk::SpanProcessor>> processors;
+  processors.push_back(std::move(processor));
+  auto resource = opentelemetry::sdk::resource::Resource::Create({});
+  auto context  = std::make_shared<trace_sdk::TracerContext>(std::move(processors), resource);
+  context->SetSpanPoolSize(kPoolSize);
+
+  return std::make_shared<trace_sdk::Tracer>(context);
+}
+
+std::shared_ptr<trace_api::Tracer> CreateTracer(const trace_sdk::TracerConfig &config)
 {
   // Set the batch size to 0 so the InMemorySpanExporter's circular buffer has a capcity of 1 and
   // rejects the span from the first iteration. This will force destruction of the span in the
@@ -93,23 +199,25 @@ std::shared_ptr<trace_api::Tracer> CreateTracer(bool is_enabled = true)
   auto resource = opentelemetry::sdk::resource::Resource::Create({});
   auto context  = std::make_shared<trace_sdk::TracerContext>(std::move(processors), resource);
 
-  if (!is_enabled)
-  {
-    auto disabled_config = std::make_unique<scope_sdk::ScopeConfigurator<trace_sdk::TracerConfig>>(
-        scope_sdk::ScopeConfigurator<trace_sdk::TracerConfig>::Builder(
-            trace_sdk::TracerConfig::Disabled())
-            .Build());
-    context->SetTracerConfigurator(std::move(disabled_config));
-  }
+  context->SetTracerConfigurator(
+      std::make_unique<scope_sdk::ScopeConfigurator<trace_sdk::TracerConfig>>(
+          scope_sdk::ScopeConfigurator<trace_sdk::TracerConfig>::Builder(config).Build()));
   auto tracer = std::make_shared<trace_sdk::Tracer>(context);
 
   return tracer;
 }
 
+std::shared_ptr<trace_api::Tracer> CreateTracer(bool is_enabled = true)
+{
+  return CreateTracer(is_enabled ? trace_sdk::TracerConfig::Default()
+                                 : trace_sdk::TracerConfig::Disabled());
+}
+
 // Test to measure performance for span creation
 void BM_StartSpanTracerDisabled(benchmark::State &state)
 {
   auto tracer = CreateTracer(false);
+  AllocationCounter allocation_counter(state);
   while (state.KeepRunning())
   {
     auto span = tracer->StartSpan("span");
@@ -122,6 +230,7 @@ BENCHMARK(BM_StartSpanTracerDisabled);
 void BM_StartSpan(benchmark::State &state)
 {
   auto tracer = CreateTracer();
+  AllocationCounter allocation_counter(state);
   while (state.KeepRunning())
   {
     auto span = tracer->StartSpan("span");
@@ -130,10 +239,43 @@ void BM_StartSpan(benchmark::State &state)
 }
 BENCHMARK(BM_StartSpan);
 
+// Test to measure performance for span creation with pooled spans and recordables
+void BM_StartSpanPooled(benchmark::State &state)
+{
+  auto tracer = CreatePooledTracer();
+  AllocationCounter allocation_counter(state);
+  while (state.KeepRunning())
+  {
+    auto span = tracer->StartSpan("span");
+    span->End();
+  }
+}
+BENCHMARK(BM_StartSpanPooled);
+
+// Test to measure performance for span creation and modification, with spans locked on each call
+// (state.range(0) == 0) or thread-confined (state.range(0) == 1)
+void BM_SpanOperations(benchmark::State &state)
+{
+  auto tracer = CreateTracer(state.range(0) == 0 ? trace_sdk::TracerConfig::Default()
+                                                 : trace_sdk::TracerConfig::ThreadConfinedSpans());
+  AllocationCounter allocation_counter(state);
+  while (state.KeepRunning())
+  {
+    auto span = tracer->StartSpan("span");
+    span->SetAttribute("attr1", 1);
+    span->SetAttribute("attr2", "value");
+    span->AddEvent("event");
+    span->SetStatus(trace_api::StatusCode::kOk);
+    span->End();
+  }
+}
+BENCHMARK(BM_SpanOperations)->Arg(0)->Arg(1);
+
 // Test to measure performance for single span creation with scope
 void BM_StartSpanWithScope(benchmark::State &state)
 {
   auto tracer = CreateTracer();
+  AllocationCounter allocation_counter(state);
   while (state.KeepRunning())
   {
     auto span = tracer->StartSpan("span");
@@ -149,6 +291,7 @@ void BM_StartSpanWithImplicitParent(benchmark::State &state)
   auto tracer      = CreateTracer();
   auto parent_span = tracer->StartSpan("parent");
   trace_api::Scope parent_scope{parent_span};
+  AllocationCounter allocation_counter(state);
   while (state.KeepRunning())
   {
     auto span = tracer->StartSpan("span");
@@ -168,6 +311,7 @@ void BM_StartSpanWithExplicitParentContext(benchmark::State &state)
   auto init_context   = context::Context{};
   auto parent_context = trace_api::SetSpan(init_context, parent_span);
 
+  AllocationCounter allocation_counter(state);
   while (state.KeepRunning())
   {
     trace_api::StartSpanOptions options;
@@ -184,6 +328,7 @@ void BM_StartSpanWithExplicitRootContext(benchmark::State &state)
 
   auto root_context = context::Context{trace_api::kIsRootSpanKey, true};
 
+  AllocationCounter allocation_counter(state);
   while (state.KeepRunning())
   {
     trace_api::StartSpanOptions options;
@@ -34,6 +34,15 @@ TEST(TracerConfig, CheckDefaultConfigWorksAccToSpec)
   ASSERT_TRUE(default_config.IsEnabled());
 }
 
+TEST(TracerConfig, CheckThreadConfinedSpansWorksAsExpected)
+{
+  trace_sdk::TracerConfig thread_confined_config = trace_sdk::TracerConfig::ThreadConfinedSpans();
+  ASSERT_TRUE(thread_confined_config.IsEnabled());
+  ASSERT_TRUE(thread_confined_config.IsSpanThreadConfined());
+  ASSERT_FALSE(trace_sdk::TracerConfig::Default().IsSpanThreadConfined());
+  ASSERT_FALSE(thread_confined_config == trace_sdk::TracerConfig::Enabled());
+}
+
 /** Tests to verify the behavior of trace_sdk::TracerConfig::DefaultConfigurator */
 
 static std::pair<opentelemetry::nostd::string_view, opentelemetry::common::AttributeValue> &
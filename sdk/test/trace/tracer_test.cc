@@ -8,7 +8,9 @@
 #include <functional>
 #include <initializer_list>
 #include <map>
+#include <memory>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -110,6 +112,51 @@ class MockSampler final : public Sampler
   nostd::string_view GetDescription() const noexcept override { return "MockSampler"; }
 };
 
+/**
+ * The recordables made, started and ended by a MockRecordingProcessor.
+ */
+struct RecordedSpans
+{
+  std::vector<const Recordable *> made;
+  std::vector<const Recordable *> started;
+  std::vector<const Recordable *> ended;
+};
+
+/**
+ * A mock processor keeping track of the recordables it is given, to check that it is given back
+ * the ones it made.
+ */
+class MockRecordingProcessor final : public SpanProcessor
+{
+public:
+  explicit MockRecordingProcessor(std::shared_ptr<RecordedSpans> spans) : spans_(std::move(spans))
+  {}
+
+  std::unique_ptr<Recordable> MakeRecordable() noexcept override
+  {
+    std::unique_ptr<Recordable> recordable(new SpanData);
+    spans_->made.push_back(recordable.get());
+    return recordable;
+  }
+
+  void OnStart(Recordable &span, const SpanContext & /* parent_context */) noexcept override
+  {
+    spans_->started.push_back(&span);
+  }
+
+  void OnEnd(std::unique_ptr<Recordable> &&span) noexcept override
+  {
+    spans_->ended.push_back(span.get());
+  }
+
+  bool ForceFlush(std::chrono::microseconds /* timeout */) noexcept override { return true; }
+
+  bool Shutdown(std::chrono::microseconds /* timeout */) noexcept override { return true; }
+
+private:
+  std::shared_ptr<RecordedSpans> spans_;
+};
+
 /**
  * A mock sampler with ShouldSample returning
  * a decision based on the span name.
@@ -240,6 +287,112 @@ TEST(Tracer, ToInMemorySpanExporter)
   EXPECT_EQ(span2.at(0)->GetParentSpanId(), span1.at(0)->GetSpanId());
 }
 
+TEST(Tracer, StartSpanWithSpanPool)
+{
+  InMemorySpanExporter *exporter              = new InMemorySpanExporter();
+  std::shared_ptr<InMemorySpanData> span_data = exporter->GetData();
+  auto processor = std::unique_ptr<SpanProcessor>(
+      new SimpleSpanProcessor(std::unique_ptr<SpanExporter>{exporter}));
+  std::vector<std::unique_ptr<SpanProcessor>> processors;
+  processors.push_back(std::move(processor));
+  auto context = std::make_shared<TracerContext>(std::move(processors));
+  context->SetSpanPoolSize(1);
+  EXPECT_EQ(1, context->GetSpanPoolSize());
+  auto tracer = std::shared_ptr<opentelemetry::trace::Tracer>(new Tracer(context));
+
+  auto span_first                            = tracer->StartSpan("span 1");
+  opentelemetry::trace::Span *first_span_ptr = span_first.get();
+  span_first->End();
+  span_first = nullptr;
+
+  // The memory of the first span is reused by the second one.
+  auto span_second = tracer->StartSpan("span 2");
+  EXPECT_EQ(first_span_ptr, span_second.get());
+  span_second->End();
+
+  auto spans = span_data->GetSpans();
+  ASSERT_EQ(2, spans.size());
+  EXPECT_EQ("span 1", spans.at(0)->GetName());
+  EXPECT_EQ("span 2", spans.at(1)->GetName());
+  EXPECT_NE(spans.at(0)->GetSpanId(), spans.at(1)->GetSpanId());
+}
+
+TEST(Tracer, EndSpanAfterAddProcessor)
+{
+  InMemorySpanExporter *exporter1              = new InMemorySpanExporter();
+  std::shared_ptr<InMemorySpanData> span_data1 = exporter1->GetData();
+  InMemorySpanExporter *exporter2              = new InMemorySpanExporter();
+  std::shared_ptr<InMemorySpanData> span_data2 = exporter2->GetData();
+  std::vector<std::unique_ptr<SpanProcessor>> processors;
+  processors.push_back(std::unique_ptr<SpanProcessor>(
+      new SimpleSpanProcessor(std::unique_ptr<SpanExporter>{exporter1})));
+  auto context = std::make_shared<TracerContext>(std::move(processors));
+  auto tracer  = std::shared_ptr<opentelemetry::trace::Tracer>(new Tracer(context));
+
+  // The span is recorded by the processors active when it started.
+  auto span_first = tracer->StartSpan("span 1");
+  context->AddProcessor(std::unique_ptr<SpanProcessor>(
+      new SimpleSpanProcessor(std::unique_ptr<SpanExporter>{exporter2})));
+  auto span_second = tracer->StartSpan("span 2");
+  span_first->End();
+  span_second->End();
+
+  auto spans1 = span_data1->GetSpans();
+  ASSERT_EQ(2, spans1.size());
+  EXPECT_EQ("span 1", spans1.at(0)->GetName());
+  EXPECT_EQ("span 2", spans1.at(1)->GetName());
+  auto spans2 = span_data2->GetSpans();
+  ASSERT_EQ(1, spans2.size());
+  EXPECT_EQ("span 2", spans2.at(0)->GetName());
+}
+
+TEST(Tracer, RecordSpanWithSingleProcessor)
+{
+  auto spans = std::make_shared<RecordedSpans>();
+  std::vector<std::unique_ptr<SpanProcessor>> processors;
+  processors.push_back(std::unique_ptr<SpanProcessor>(new MockRecordingProcessor(spans)));
+  auto context                  = std::make_shared<TracerContext>(std::move(processors));
+  SpanProcessor &only_processor = context->GetRecordingProcessor();
+
+  // The only processor records the spans itself, without the MultiSpanProcessor.
+  EXPECT_NE(&only_processor, &context->GetProcessor());
+  auto tracer = std::shared_ptr<opentelemetry::trace::Tracer>(new Tracer(context));
+  tracer->StartSpan("span 1")->End();
+
+  // It is given its own recordable, rather than a MultiRecordable wrapping it.
+  ASSERT_EQ(1, spans->made.size());
+  ASSERT_EQ(1, spans->started.size());
+  ASSERT_EQ(1, spans->ended.size());
+  EXPECT_EQ(spans->made[0], spans->started[0]);
+  EXPECT_EQ(spans->made[0], spans->ended[0]);
+}
+
+TEST(Tracer, RecordSpanWithMultipleProcessors)
+{
+  auto spans1 = std::make_shared<RecordedSpans>();
+  auto spans2 = std::make_shared<RecordedSpans>();
+  std::vector<std::unique_ptr<SpanProcessor>> processors;
+  processors.push_back(std::unique_ptr<SpanProcessor>(new MockRecordingProcessor(spans1)));
+  processors.push_back(std::unique_ptr<SpanProcessor>(new MockRecordingProcessor(spans2)));
+  auto context = std::make_shared<TracerContext>(std::move(processors));
+
+  // The spans are recorded through the MultiSpanProcessor.
+  EXPECT_EQ(&context->GetRecordingProcessor(), &context->GetProcessor());
+  auto tracer = std::shared_ptr<opentelemetry::trace::Tracer>(new Tracer(context));
+  tracer->StartSpan("span 1")->End();
+
+  // Each processor is given back its own recordable, unwrapped from the MultiRecordable.
+  for (const auto &spans : {spans1, spans2})
+  {
+    ASSERT_EQ(1, spans->made.size());
+    ASSERT_EQ(1, spans->started.size());
+    ASSERT_EQ(1, spans->ended.size());
+    EXPECT_EQ(spans->made[0], spans->started[0]);
+    EXPECT_EQ(spans->made[0], spans->ended[0]);
+  }
+  EXPECT_NE(spans1->made[0], spans2->made[0]);
+}
+
 TEST(Tracer, StartSpanSampleOn)
 {
   InMemorySpanExporter *exporter              = new InMemorySpanExporter();
@@ -615,6 +768,53 @@ TEST(Tracer, StartSpanWithEnabledConfig)
 #endif
 }
 
+TEST(Tracer, StartSpanWithThreadConfinedSpansConfig)
+{
+  InMemorySpanExporter *exporter              = new InMemorySpanExporter();
+  std::shared_ptr<InMemorySpanData> span_data = exporter->GetData();
+  ScopeConfigurator<TracerConfig> thread_confined_tracer =
+      ScopeConfigurator<TracerConfig>::Builder(TracerConfig::ThreadConfinedSpans()).Build();
+  auto tracer = initTracer(std::unique_ptr<SpanExporter>{exporter}, new AlwaysOnSampler(),
+                           new RandomIdGenerator(), thread_confined_tracer);
+  auto span   = tracer->StartSpan("span 1");
+
+  EXPECT_TRUE(span->IsRecording());
+  span->SetAttribute("attr1", 314159);
+  span->AddEvent("event 1");
+  span->SetStatus(opentelemetry::trace::StatusCode::kOk, "");
+  span->End();
+
+  // The span may be released by another thread once it ended.
+  std::thread release_thread([&span]() { span = nullptr; });
+  release_thread.join();
+
+  auto spans = span_data->GetSpans();
+  ASSERT_EQ(1, spans.size());
+  EXPECT_EQ("span 1", spans.at(0)->GetName());
+  EXPECT_EQ(314159, nostd::get<int32_t>(spans.at(0)->GetAttributes().at("attr1")));
+  EXPECT_EQ(1, spans.at(0)->GetEvents().size());
+  EXPECT_EQ(opentelemetry::trace::StatusCode::kOk, spans.at(0)->GetStatus());
+}
+
+#if !defined(NDEBUG) && GTEST_HAS_DEATH_TEST
+TEST(Tracer, ThreadConfinedSpanUsedByAnotherThread)
+{
+  ScopeConfigurator<TracerConfig> thread_confined_tracer =
+      ScopeConfigurator<TracerConfig>::Builder(TracerConfig::ThreadConfinedSpans()).Build();
+  auto tracer = initTracer(std::unique_ptr<SpanExporter>{new InMemorySpanExporter()},
+                           new AlwaysOnSampler(), new RandomIdGenerator(), thread_confined_tracer);
+  auto span   = tracer->StartSpan("span 1");
+
+  EXPECT_DEATH(
+      {
+        std::thread other_thread([&span]() { span->SetAttribute("attr1", 1); });
+        other_thread.join();
+      },
+      "");
+  span->End();
+}
+#endif
+
 TEST(Tracer, StartSpanWithCustomConfig)
 {
   auto check_if_version_present = [](const InstrumentationScope &scope_info) {